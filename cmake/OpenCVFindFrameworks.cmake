@@ -36,6 +36,11 @@ if(WITH_OPENMP)
   set(HAVE_OPENMP "${OPENMP_FOUND}")
 endif()
 
+ocv_clear_vars(HAVE_WORKSTEALING_PF)
+if(WITH_WORKSTEALING_PF)
+  set(HAVE_WORKSTEALING_PF 1)
+endif()
+
 ocv_clear_vars(HAVE_PTHREADS_PF)
 if(WITH_PTHREADS_PF AND HAVE_PTHREAD)
   set(HAVE_PTHREADS_PF 1)
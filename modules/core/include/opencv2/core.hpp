@@ -216,7 +216,13 @@ enum KmeansFlags {
         user-supplied labels instead of computing them from the initial centers. For the second and
         further attempts, use the random or semi-random centers. Use one of KMEANS_\*_CENTERS flag
         to specify the exact method.*/
-    KMEANS_USE_INITIAL_LABELS = 1
+    KMEANS_USE_INITIAL_LABELS = 1,
+    /** Use the mini-batch k-means (Sculley, 2010): each iteration updates the centers using
+        a random batch of the samples (OPENCV_KMEANS_MINI_BATCH_SIZE, 1024 by default), the number of
+        iterations is criteria.maxCount (100 by default). The labels of all the samples are computed
+        once in the end, so some clusters may be empty. Together with #KMEANS_PP_CENTERS the initial
+        centers are chosen by the parallel k-means|| algorithm (Bahmani et al., 2012).*/
+    KMEANS_MINI_BATCH         = 4
 };
 
 //! @} core_cluster
@@ -1660,6 +1666,24 @@ input matrices.
 CV_EXPORTS_W void gemm(InputArray src1, InputArray src2, double alpha,
                        InputArray src3, double beta, OutputArray dst, int flags = 0);
 
+/** @brief Multiplies the sparse matrix by the dense one.
+
+The function computes
+\f[\texttt{dst} =  \texttt{alpha} \cdot op(\texttt{src1}) \cdot op(\texttt{src2}) +  \texttt{beta} \cdot op(\texttt{src3})\f]
+like the dense gemm, where op() is the matrix itself or its transposition (see cv::GemmFlags). If
+src2 is a single column, that is the sparse matrix-vector product. The rows of the result are
+processed by several threads.
+@param src1 the sparse matrix.
+@param src2 the dense matrix of the same type as src1.
+@param alpha weight of the matrix product.
+@param src3 optional dense matrix of the same type added to the product, may be noArray().
+@param beta weight of src3.
+@param dst output dense matrix.
+@param flags operation flags (cv::GemmFlags)
+*/
+CV_EXPORTS void gemm(const SparseMatCSR& src1, InputArray src2, double alpha,
+                     InputArray src3, double beta, OutputArray dst, int flags = 0);
+
 /** @brief Calculates the product of a matrix and its transposition.
 
 The function cv::mulTransposed calculates the product of src and its
@@ -1900,6 +1924,26 @@ stores the indices of sorted elements in the output array. For example:
 */
 CV_EXPORTS_W void sortIdx(InputArray src, OutputArray dst, int flags);
 
+/** @brief Finds the k smallest or the k largest elements of each row or each column of a matrix.
+
+The function cv::topK is a partial cv::sort and cv::sortIdx: only the first k elements of the sorted
+rows (columns) are found, which is much faster than the full sort when k is small. For example, the k
+strongest responses are found as:
+@code
+    Mat responses; // 1 x N, CV_32F
+    Mat best, bestIdx;
+    topK(responses, best, bestIdx, 100, SORT_EVERY_ROW + SORT_DESCENDING);
+@endcode
+The found elements are sorted; the equal elements are ordered by their indices.
+@param src input single-channel array.
+@param dst output array of the same type as src, with k columns (rows if the columns are sorted).
+@param idx output integer array of the same size as dst, the indices of the found elements in src.
+@param k the number of the elements to find, 0 < k <= the row (column) length.
+@param flags operation flags, a combination of #SortFlags
+@sa sort, sortIdx
+*/
+CV_EXPORTS_W void topK(InputArray src, OutputArray dst, OutputArray idx, int k, int flags);
+
 /** @brief Finds the real roots of a cubic equation.
 
 The function solveCubic finds the real roots of a cubic equation:
@@ -2184,6 +2228,37 @@ the convolution sample in dft description.
 */
 CV_EXPORTS_W void idft(InputArray src, OutputArray dst, int flags = 0, int nonzeroRows = 0);
 
+/** @brief Precomputed discrete Fourier transform of the arrays of the fixed size and type.
+
+The plan keeps the factorization of the transform size, the twiddle factors, the permutation
+tables and the scratch buffers, so the repeated transforms (e.g. the spectral filtering of the
+video frames) don't pay the setup cost. The result is the same as of dft() called with the same
+flags. dft() itself caches a few recently used plans per thread.
+
+The plan is not thread-safe: use a separate plan in each thread. The rows (or the columns) of
+large arrays are transformed by several threads inside apply().
+@sa dft, idft
+ */
+class CV_EXPORTS DFTPlan
+{
+public:
+    virtual ~DFTPlan();
+
+    /** @brief Creates the plan.
+    @param size size of the input arrays.
+    @param type type of the input arrays: CV_32FC1, CV_32FC2, CV_64FC1 or CV_64FC2.
+    @param flags transformation flags, see dft and #DftFlags.
+    @param nonzeroRows number of the nonzero input (or output, for the inverse transform) rows, see dft.
+     */
+    static Ptr<DFTPlan> create(Size size, int type, int flags = 0, int nonzeroRows = 0);
+
+    /** @brief Performs the transform.
+    @param src input array of the size and type specified when the plan was created.
+    @param dst output array whose size and type depend on the flags, see dft.
+     */
+    virtual void apply(InputArray src, OutputArray dst) = 0;
+};
+
 /** @brief Performs a forward or inverse discrete Cosine transform of 1D or 2D array.
 
 The function cv::dct performs a forward or inverse discrete Cosine transform (DCT) of a 1D or 2D
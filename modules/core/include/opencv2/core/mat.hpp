@@ -492,6 +492,21 @@ public:
     virtual BufferPoolController* getBufferPoolController(const char* id = NULL) const;
 };
 
+/** @brief Usage counters of the pooling allocator
+
+@sa Mat::getPoolAllocator
+*/
+struct CV_EXPORTS MatPoolAllocatorStatistics
+{
+    uint64 hits;             //!< number of the allocations served by the cached buffers
+    uint64 misses;           //!< number of the allocations of new buffers
+    size_t reservedSize;     //!< size of the cached buffers, in bytes
+    size_t maxReservedSize;  //!< limit of the cached buffers size, in bytes
+};
+
+//! Returns the usage counters of Mat::getPoolAllocator()
+CV_EXPORTS MatPoolAllocatorStatistics getPoolAllocatorStatistics();
+
 
 //////////////////////////////// MatCommaInitializer //////////////////////////////////
 
@@ -2105,6 +2120,18 @@ public:
     static MatAllocator* getDefaultAllocator();
     static void setDefaultAllocator(MatAllocator* allocator);
 
+    /** @brief Returns the allocator which keeps the released buffers for reuse.
+
+    Buffers are rounded up to the size classes and cached in the per-thread free lists, so the
+    pipelines which allocate the same-sized matrices again and again don't go to the system allocator.
+    The allocator is opt-in: assign it to Mat::allocator of the particular matrices, pass it to
+    setDefaultAllocator() or set OPENCV_MAT_POOL_ALLOCATOR=1 environment variable.
+    The size of the cached buffers is limited by OPENCV_MAT_POOL_ALLOCATOR_LIMIT (256Mb by default),
+    use getBufferPoolController() of the allocator to change the limit or to release the cached buffers.
+    @sa getPoolAllocatorStatistics
+    */
+    static MatAllocator* getPoolAllocator();
+
     //! internal use method: updates the continuity flag
     void updateContinuityFlag();
 
@@ -3005,6 +3032,70 @@ public:
 };
 
 
+////////////////////////////// compressed sparse row matrix //////////////////////////////
+
+/** @brief 2D sparse matrix in the compressed sparse row (CSR) format.
+
+Unlike SparseMat, the non-zero elements are stored row by row in the contiguous arrays: the values,
+the column indices of the values (ascending within each row) and the offsets of the rows in them.
+The matrix is not modified element-wise, but it is much faster in the repeated matrix-vector and
+matrix-matrix products, see gemm(const SparseMatCSR&, InputArray, double, InputArray, double, OutputArray, int).
+@code
+    SparseMat_<double> A(2, sizes);
+    ... // fill A
+    SparseMatCSR csr(A);
+    Mat x = ..., y;
+    gemm(csr, x, 1, noArray(), 0, y);  // y = A*x
+@endcode
+ */
+class CV_EXPORTS SparseMatCSR
+{
+public:
+    //! the default constructor
+    SparseMatCSR();
+    /** @brief constructs the matrix from the CSR arrays. The arrays are copied.
+    @param rows the number of rows.
+    @param cols the number of columns.
+    @param rowPtr CV_32S array of rows+1 offsets of the rows in colIdx and values, rowPtr[0] == 0.
+    @param colIdx CV_32S array of the column indices of the elements, ascending within each row.
+    @param values CV_32F or CV_64F array of the element values, the same number as in colIdx.
+    */
+    SparseMatCSR(int rows, int cols, InputArray rowPtr, InputArray colIdx, InputArray values);
+    /** @brief converts 2D single-channel SparseMat.
+    The elements of the integer types are converted to CV_64F. */
+    explicit SparseMatCSR(const SparseMat& m);
+    /** @brief takes the non-zero elements of 2D single-channel dense matrix.
+    The elements of the integer types are converted to CV_64F. */
+    explicit SparseMatCSR(const Mat& m);
+
+    //! converts to the dense matrix
+    void copyTo(OutputArray m) const;
+    //! converts to SparseMat
+    void copyTo(SparseMat& m) const;
+    //! returns the transposed matrix
+    SparseMatCSR t() const;
+
+    //! returns type of the elements, CV_32F or CV_64F
+    int type() const;
+    //! returns true if the matrix has no rows or columns
+    bool empty() const;
+    //! returns the number of the stored elements
+    size_t nonZeros() const;
+    //! returns Size(cols, rows)
+    Size size() const;
+
+    //! the type of the elements, it is kept when there are no stored elements
+    int flags;
+    int rows, cols;
+    //! rows+1 offsets of the rows in colIdx and values
+    std::vector<int> rowPtr;
+    //! column indices of the stored elements
+    std::vector<int> colIdx;
+    //! 1 x nonZeros() row of the element values
+    Mat values;
+};
+
+
 
 ////////////////////////////////// MatConstIterator //////////////////////////////////
 
@@ -316,6 +316,7 @@ public:
         FORMAT_XML  = (1<<3), //!< flag, XML format
         FORMAT_YAML = (2<<3), //!< flag, YAML format
         FORMAT_JSON = (3<<3), //!< flag, JSON format
+        FORMAT_BINARY = (4<<3), //!< flag, binary format. The raw data blocks are memory-mapped on reading
 
         BASE64      = 64,     //!< flag, write rawdata in Base64 by default. (consider using WRITE_BASE64)
         WRITE_BASE64 = BASE64 | WRITE, //!< flag, enable both WRITE and BASE64
@@ -613,7 +614,13 @@ public:
     CV_WRAP double real() const;
     //! Simplified reading API to use with bindings.
     CV_WRAP std::string string() const;
-    //! Simplified reading API to use with bindings.
+    /** @brief Simplified reading API to use with bindings.
+
+    The matrices of FileStorage::FORMAT_BINARY storage are not copied: the returned matrix
+    references the memory-mapped storage content, which is kept while the matrix exists.
+    Modifications of the matrix do not affect the file, but they are visible to the subsequent
+    reads of the same node.
+    */
     CV_WRAP Mat mat() const;
 
     //protected:
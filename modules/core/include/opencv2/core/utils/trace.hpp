@@ -32,6 +32,30 @@ namespace trace {
 //! Macro to trace argument value (expanded version)
 #define CV_TRACE_ARG_VALUE(arg_id, arg_name, value)
 
+/** @brief Enables collection of per call site statistics of parallel_for_() calls
+
+Collected data includes wall time, busy time of each participating thread, number of stripes,
+load imbalance (max / mean busy time of threads) and wake-up latency of worker threads.
+Call sites are identified by the caller's trace region (if tracing is active, see OPENCV_TRACE)
+or by the type of the loop body (by the address of the calling code for lambda bodies).
+
+Collection is enabled at startup if OPENCV_PARALLEL_FOR_STATS environment variable specifies
+a report filename. The report is written into this file at exit.
+*/
+CV_EXPORTS void setParallelForStatisticsEnabled(bool enabled);
+
+CV_EXPORTS bool isParallelForStatisticsEnabled();
+
+/** @brief Writes collected parallel_for_() statistics into the file
+
+CSV format is used for files with ".csv" extension, JSON otherwise.
+@returns false if file can't be written
+*/
+CV_EXPORTS bool dumpParallelForStatistics(const char* filename);
+
+//! Drops collected parallel_for_() statistics
+CV_EXPORTS void resetParallelForStatistics();
+
 //! @cond IGNORED
 #define CV_TRACE_NS cv::utils::trace
 
@@ -45,4 +45,27 @@ PERF_TEST_P(MatDepth_tb, DISABLED_Allocation_Aligned,
     SANITY_CHECK_NOTHING();
 }
 
+
+typedef perf::TestBaseWithParam<tuple<cv::Size, bool> > MatAllocation;
+
+PERF_TEST_P(MatAllocation, create_release,
+    testing::Combine(testing::Values(::perf::szVGA, ::perf::sz1080p, ::perf::sz2160p),
+                     testing::Bool()))
+{
+    const cv::Size sz = get<0>(GetParam());
+    cv::MatAllocator* allocator = get<1>(GetParam()) ? cv::Mat::getPoolAllocator() : cv::Mat::getStdAllocator();
+
+    TEST_CYCLE()
+    {
+        for (int i = 0; i < 100; ++i)
+        {
+            cv::Mat m;
+            m.allocator = allocator;
+            m.create(sz, CV_8UC3);
+            m.row(i % sz.height).setTo(cv::Scalar::all(i));
+        }
+    }
+    SANITY_CHECK_NOTHING();
+}
+
 };
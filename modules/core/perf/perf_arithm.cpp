@@ -400,4 +400,27 @@ INSTANTIATE_TEST_CASE_P(/*nothing*/ , BinaryOpTest,
     )
 );
 
+
+typedef Size_MatType MatExprFusedTest;
+
+PERF_TEST_P_(MatExprFusedTest, mulAddChain)
+{
+    Size sz = get<0>(GetParam());
+    int type = get<1>(GetParam());
+    cv::Mat a(sz, type), b(sz, type), c(sz, type), dst(sz, type);
+
+    declare.in(a, b, c, WARMUP_RNG).out(dst);
+
+    TEST_CYCLE() dst = a.mul(b)*0.5 + b.mul(c) - a;
+
+    SANITY_CHECK_NOTHING();
+}
+
+INSTANTIATE_TEST_CASE_P(/*nothing*/ , MatExprFusedTest,
+    testing::Combine(
+        testing::Values(szVGA, sz1080p),
+        testing::Values(CV_8UC1, CV_16SC1, CV_32FC1, CV_32FC3)
+    )
+);
+
 } // namespace
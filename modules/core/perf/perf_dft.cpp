@@ -36,6 +36,29 @@ PERF_TEST_P(Size_MatType_FlagsType_NzeroRows, dft, TEST_MATS_DFT)
     SANITY_CHECK(dst, 1e-5, ERROR_RELATIVE);
 }
 
+typedef tuple<Size, MatType> Size_MatType_DFTPlan_t;
+typedef perf::TestBaseWithParam<Size_MatType_DFTPlan_t> Size_MatType_DFTPlan;
+
+// many small transforms: the setup cost of dft() is not negligible there
+PERF_TEST_P(Size_MatType_DFTPlan, dft_plan, testing::Combine(
+                testing::Values(cv::Size(32, 32), cv::Size(64, 64), cv::Size(100, 75)),
+                testing::Values(CV_32FC1, CV_32FC2)))
+{
+    Size sz = get<0>(GetParam());
+    int type = get<1>(GetParam());
+
+    Mat src(sz, type);
+    Mat dst(sz, type);
+
+    declare.in(src, WARMUP_RNG).time(60);
+
+    Ptr<DFTPlan> plan = DFTPlan::create(sz, type);
+
+    TEST_CYCLE_N(100) plan->apply(src, dst);
+
+    SANITY_CHECK_NOTHING();
+}
+
 ///////////////////////////////////////////////////////dct//////////////////////////////////////////////////////
 
 CV_ENUM(DCT_FlagsType, 0, DCT_INVERSE , DCT_ROWS, DCT_INVERSE|DCT_ROWS)
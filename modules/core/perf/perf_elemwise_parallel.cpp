@@ -0,0 +1,104 @@
+#include "perf_precomp.hpp"
+
+namespace opencv_test
+{
+using namespace perf;
+
+// Large arrays are processed by several threads, compare the results with threads=1.
+// The minimal size of the parallel processing is controlled by OPENCV_CORE_ELEMWISE_PARALLEL_MIN_BYTES.
+
+typedef tuple<Size, MatType, int> Size_MatType_Threads_t;
+typedef perf::TestBaseWithParam<Size_MatType_Threads_t> ElemwiseParallel;
+
+#define ELEMWISE_PARALLEL_PARAMS testing::Combine( \
+    testing::Values(szVGA, sz1080p, Size(3840, 2160)), \
+    testing::Values(CV_8UC1, CV_8UC3, CV_32FC1), \
+    testing::Values(1, 0))
+
+PERF_TEST_P_(ElemwiseParallel, add)
+{
+    Size sz = get<0>(GetParam());
+    int type = get<1>(GetParam());
+    ThreadsScope threads(get<2>(GetParam()));
+    Mat a(sz, type), b(sz, type), c(sz, type);
+    declare.in(a, b, WARMUP_RNG).out(c);
+
+    TEST_CYCLE() cv::add(a, b, c);
+
+    SANITY_CHECK_NOTHING();
+}
+
+PERF_TEST_P_(ElemwiseParallel, multiply)
+{
+    Size sz = get<0>(GetParam());
+    int type = get<1>(GetParam());
+    ThreadsScope threads(get<2>(GetParam()));
+    Mat a(sz, type), b(sz, type), c(sz, type);
+    declare.in(a, b, WARMUP_RNG).out(c);
+
+    TEST_CYCLE() cv::multiply(a, b, c, 0.5);
+
+    SANITY_CHECK_NOTHING();
+}
+
+PERF_TEST_P_(ElemwiseParallel, compare)
+{
+    Size sz = get<0>(GetParam());
+    int type = get<1>(GetParam());
+    ThreadsScope threads(get<2>(GetParam()));
+    Mat a(sz, type), b(sz, type), c;
+    declare.in(a, b, WARMUP_RNG);
+
+    TEST_CYCLE() cv::compare(a, b, c, CMP_GT);
+
+    SANITY_CHECK_NOTHING();
+}
+
+PERF_TEST_P_(ElemwiseParallel, convertTo)
+{
+    Size sz = get<0>(GetParam());
+    int type = get<1>(GetParam());
+    ThreadsScope threads(get<2>(GetParam()));
+    int dtype = CV_MAT_DEPTH(type) == CV_32F ? CV_8U : CV_32F;
+    Mat a(sz, type), c;
+    declare.in(a, WARMUP_RNG);
+
+    TEST_CYCLE() a.convertTo(c, dtype, 0.5, 1);
+
+    SANITY_CHECK_NOTHING();
+}
+
+PERF_TEST_P_(ElemwiseParallel, split_merge)
+{
+    Size sz = get<0>(GetParam());
+    int type = CV_MAKETYPE(get<1>(GetParam()) & CV_MAT_DEPTH_MASK, 3);
+    ThreadsScope threads(get<2>(GetParam()));
+    Mat a(sz, type), c;
+    std::vector<Mat> planes;
+    declare.in(a, WARMUP_RNG);
+
+    TEST_CYCLE()
+    {
+        cv::split(a, planes);
+        cv::merge(planes, c);
+    }
+
+    SANITY_CHECK_NOTHING();
+}
+
+PERF_TEST_P_(ElemwiseParallel, transpose)
+{
+    Size sz = get<0>(GetParam());
+    int type = get<1>(GetParam());
+    ThreadsScope threads(get<2>(GetParam()));
+    Mat a(sz, type), c;
+    declare.in(a, WARMUP_RNG);
+
+    TEST_CYCLE() cv::transpose(a, c);
+
+    SANITY_CHECK_NOTHING();
+}
+
+INSTANTIATE_TEST_CASE_P(/*nothing*/ , ElemwiseParallel, ELEMWISE_PARALLEL_PARAMS);
+
+} // namespace
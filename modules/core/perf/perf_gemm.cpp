@@ -0,0 +1,110 @@
+#include "perf_precomp.hpp"
+
+namespace opencv_test
+{
+using namespace perf;
+
+// The previous (single-threaded) implementation can be measured with OPENCV_GEMM_PACKED=0 environment variable.
+
+CV_ENUM(GemmFlags, 0, GEMM_1_T, GEMM_2_T)
+
+typedef tuple<int, MatType, GemmFlags> Size_MatType_GemmFlags_t;
+typedef perf::TestBaseWithParam<Size_MatType_GemmFlags_t> Size_MatType_GemmFlags;
+
+PERF_TEST_P(Size_MatType_GemmFlags, gemm,
+            testing::Combine(
+                testing::Values(64, 128, 256, 512, 1024),
+                testing::Values(CV_32FC1, CV_64FC1),
+                GemmFlags::all()))
+{
+    const int sz = get<0>(GetParam());
+    const int type = get<1>(GetParam());
+    const int flags = get<2>(GetParam());
+
+    Mat a(sz, sz, type), b(sz, sz, type), c(sz, sz, type), d(sz, sz, type);
+    declare.in(a, b, c, WARMUP_RNG).out(d);
+
+    TEST_CYCLE() cv::gemm(a, b, 1.0, c, 0.5, d, flags);
+
+    SANITY_CHECK_NOTHING();
+}
+
+typedef tuple<int, int> Size_Threads_t;
+typedef perf::TestBaseWithParam<Size_Threads_t> Size_Threads;
+
+PERF_TEST_P(Size_Threads, gemm_32f_threads,
+            testing::Combine(
+                testing::Values(256, 1024),
+                testing::Values(1, 2, 4, 0)))
+{
+    const int sz = get<0>(GetParam());
+    const int threads = get<1>(GetParam());
+
+    Mat a(sz, sz, CV_32FC1), b(sz, sz, CV_32FC1), d(sz, sz, CV_32FC1);
+    declare.in(a, b, WARMUP_RNG).out(d);
+
+    const int prevThreads = getNumThreads();
+    if (threads > 0)
+        setNumThreads(threads);
+    TEST_CYCLE() cv::gemm(a, b, 1.0, noArray(), 0, d);
+    setNumThreads(prevThreads);
+
+    SANITY_CHECK_NOTHING();
+}
+
+PERF_TEST_P(Size_MatType, mulTransposed,
+            testing::Combine(
+                testing::Values(Size(256, 1024), Size(1024, 256)),
+                testing::Values(CV_32FC1, CV_64FC1)))
+{
+    const Size sz = get<0>(GetParam());
+    const int type = get<1>(GetParam());
+
+    Mat src(sz, type), dst;
+    declare.in(src, WARMUP_RNG);
+
+    TEST_CYCLE() cv::mulTransposed(src, dst, true);
+
+    SANITY_CHECK_NOTHING();
+}
+
+typedef tuple<int, int, MatType> SparseGemm_t;
+typedef perf::TestBaseWithParam<SparseGemm_t> SparseGemm;
+
+// the sparse matrix with ~10 non-zero elements per row times a vector or a narrow matrix
+PERF_TEST_P(SparseGemm, csr,
+            testing::Combine(
+                testing::Values(10000, 100000),
+                testing::Values(1, 8),
+                testing::Values(CV_32FC1, CV_64FC1)))
+{
+    const int n = get<0>(GetParam());
+    const int k = get<1>(GetParam());
+    const int type = get<2>(GetParam());
+    const int nzPerRow = 10;
+
+    RNG& rng = theRNG();
+    std::vector<int> rowPtr(n + 1), colIdx;
+    for (int i = 0; i < n; i++)
+    {
+        std::vector<int> cols;
+        for (int p = 0; p < nzPerRow; p++)
+            cols.push_back(rng.uniform(0, n));
+        std::sort(cols.begin(), cols.end());
+        cols.erase(std::unique(cols.begin(), cols.end()), cols.end());
+        colIdx.insert(colIdx.end(), cols.begin(), cols.end());
+        rowPtr[i + 1] = (int)colIdx.size();
+    }
+    Mat values(1, (int)colIdx.size(), type);
+    rng.fill(values, RNG::UNIFORM, -1, 1);
+    SparseMatCSR A(n, n, rowPtr, colIdx, values);
+
+    Mat x(n, k, type), y(n, k, type);
+    declare.in(x, WARMUP_RNG).out(y);
+
+    TEST_CYCLE() cv::gemm(A, x, 1.0, noArray(), 0, y);
+
+    SANITY_CHECK_NOTHING();
+}
+
+} // namespace
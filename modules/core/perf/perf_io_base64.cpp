@@ -83,4 +83,36 @@ PERF_TEST_P(Size_Mat_StrType, DISABLED_fs_base64,
     SANITY_CHECK_NOTHING();
 }
 
+PERF_TEST_P(Size_Mat_StrType, fs_load,
+            testing::Combine(testing::Values(::perf::sz720p),
+                             testing::Values(MAT_TYPES),
+                             testing::Values(String(".yml"), String(".json"), String(".bin")))
+             )
+{
+    Size   size = get<0>(GetParam());
+    int    type = get<1>(GetParam());
+    String ext  = get<2>(GetParam());
+
+    Mat src(size.height, size.width, type);
+    Mat dst;
+    declare.in(src, WARMUP_RNG);
+
+    cv::String file_name = cv::tempfile(ext.c_str());
+    cv::String key       = "test_mat";
+    {
+        FileStorage fs(file_name, cv::FileStorage::WRITE + (ext == ".bin" ? cv::FileStorage::FORMAT_BINARY : 0));
+        fs << key << src;
+    }
+
+    TEST_CYCLE()
+    {
+        FileStorage fs(file_name, cv::FileStorage::READ);
+        dst = fs[key].mat();
+    }
+
+    ASSERT_EQ(0, cvtest::norm(src, dst, NORM_INF));
+    remove(file_name.c_str());
+    SANITY_CHECK_NOTHING();
+}
+
 } // namespace
@@ -139,6 +139,40 @@ PERF_TEST_P_(KMeans, with_duplicates)
     SANITY_CHECK_NOTHING();
 }
 
+PERF_TEST_P_(KMeans, mini_batch)
+{
+    RNG& rng = theRNG();
+    const int K = testing::get<0>(GetParam());
+    const int dims = testing::get<1>(GetParam());
+    const int N = testing::get<2>(GetParam());
+    const int attempts = 5;
+
+    Mat data(N, dims, CV_32F);
+    rng.fill(data, RNG::UNIFORM, -0.1, 0.1);
+
+    const int N0 = K;
+    Mat data0(N0, dims, CV_32F);
+    rng.fill(data0, RNG::UNIFORM, -1, 1);
+
+    for (int i = 0; i < N; i++)
+    {
+        int base = rng.uniform(0, N0);
+        cv::add(data0.row(base), data.row(i), data.row(i));
+    }
+
+    declare.in(data);
+
+    Mat labels, centers;
+
+    TEST_CYCLE()
+    {
+        kmeans(data, K, labels, TermCriteria(TermCriteria::MAX_ITER+TermCriteria::EPS, 30, 0),
+               attempts, KMEANS_PP_CENTERS | KMEANS_MINI_BATCH, centers);
+    }
+
+    SANITY_CHECK_NOTHING();
+}
+
 INSTANTIATE_TEST_CASE_P(/*nothing*/ , KMeans,
     testing::Values(
         // K clusters, dims, N points
@@ -47,4 +47,45 @@ PERF_TEST_P(sortIdxFixture, sorIdx, TYPICAL_MATS_SORT)
     SANITY_CHECK_NOTHING();
 }
 
+typedef tuple<Size, MatType, int> topKParams;
+typedef TestBaseWithParam<topKParams> topKFixture;
+
+PERF_TEST_P(topKFixture, topK, testing::Combine(testing::Values(Size(1 << 20, 1), Size(10000, 100)),
+                                                 testing::Values(CV_32FC1, CV_64FC1),
+                                                 testing::Values(10, 100)))
+{
+    const topKParams params = GetParam();
+    const Size sz = get<0>(params);
+    const int type = get<1>(params), k = get<2>(params);
+
+    cv::Mat a(sz, type), b, idx;
+
+    declare.in(a, WARMUP_RNG);
+
+    TEST_CYCLE() cv::topK(a, b, idx, k, SORT_EVERY_ROW | SORT_DESCENDING);
+
+    SANITY_CHECK_NOTHING();
+}
+
+PERF_TEST_P(sortFixture, sort_long_rows, testing::Combine(testing::Values(Size(1 << 20, 1), Size(10000, 100)),
+                                                          testing::Values(CV_16SC1, CV_32SC1, CV_32FC1, CV_64FC1),
+                                                          testing::Values(SORT_EVERY_ROW | SORT_ASCENDING)))
+{
+    const sortParams params = GetParam();
+    const Size sz = get<0>(params);
+    const int type = get<1>(params), flags = get<2>(params);
+
+    cv::Mat a(sz, type), b(sz, type), idx;
+
+    declare.in(a, WARMUP_RNG);
+
+    TEST_CYCLE()
+    {
+        cv::sort(a, b, flags);
+        cv::sortIdx(a, idx, flags);
+    }
+
+    SANITY_CHECK_NOTHING();
+}
+
 } // namespace
@@ -101,4 +101,41 @@ PERF_TEST_P(Size_MatType, countNonZero, testing::Combine( testing::Values( TYPIC
     SANITY_CHECK(cnt);
 }
 
+enum { REDUCE_SUM, REDUCE_MEAN_MASK, REDUCE_MEAN_STDDEV, REDUCE_NORM_L2, REDUCE_MIN_MAX_LOC, REDUCE_COUNT_NON_ZERO };
+CV_ENUM(ReductionOp, REDUCE_SUM, REDUCE_MEAN_MASK, REDUCE_MEAN_STDDEV, REDUCE_NORM_L2, REDUCE_MIN_MAX_LOC, REDUCE_COUNT_NON_ZERO)
+
+typedef tuple<Size, MatType, ReductionOp> Size_MatType_ReductionOp_t;
+typedef perf::TestBaseWithParam<Size_MatType_ReductionOp_t> Size_MatType_ReductionOp;
+
+PERF_TEST_P(Size_MatType_ReductionOp, reduction_large,
+            testing::Combine(testing::Values(sz1080p, sz2160p),
+                             testing::Values(CV_8UC1, CV_16SC1, CV_32FC1, CV_64FC1),
+                             ReductionOp::all()))
+{
+    Size sz = get<0>(GetParam());
+    int matType = get<1>(GetParam());
+    int op = get<2>(GetParam());
+
+    Mat src(sz, matType), mask(sz, CV_8U);
+    Scalar s, dev;
+    double minVal = 0, maxVal = 0;
+
+    declare.in(src, mask, WARMUP_RNG);
+
+    TEST_CYCLE()
+    {
+        switch (op)
+        {
+        case REDUCE_SUM: s = sum(src); break;
+        case REDUCE_MEAN_MASK: s = mean(src, mask); break;
+        case REDUCE_MEAN_STDDEV: meanStdDev(src, s, dev); break;
+        case REDUCE_NORM_L2: s[0] = cv::norm(src, NORM_L2); break;
+        case REDUCE_MIN_MAX_LOC: cv::minMaxLoc(src, &minVal, &maxVal); break;
+        case REDUCE_COUNT_NON_ZERO: s[0] = countNonZero(src); break;
+        }
+    }
+
+    SANITY_CHECK_NOTHING();
+}
+
 } // namespace
@@ -209,7 +209,12 @@ static void binary_op( InputArray _src1, InputArray _src2, OutputArray _dst,
         if (len < INT_MAX)  // FIXIT similar code below doesn't have that check
         {
             sz.width = (int)len;
-            func(src1.ptr(), src1.step, src2.ptr(), src2.step, dst.ptr(), dst.step, sz.width, sz.height, 0);
+            size_t esz1 = bitwise ? 1 : src1.elemSize1();
+            parallel_for_elemwise(sz, esz1, [&](int x, int y, Size bsz)
+            {
+                func(src1.ptr() + y*src1.step + x*esz1, src1.step, src2.ptr() + y*src2.step + x*esz1, src2.step,
+                     dst.ptr() + y*dst.step + x*esz1, dst.step, bsz.width, bsz.height, 0);
+            });
             return;
         }
     }
@@ -637,7 +642,13 @@ static void arithm_op(InputArray _src1, InputArray _src2, OutputArray _dst,
 
         Mat src1 = psrc1->getMat(), src2 = psrc2->getMat(), dst = _dst.getMat();
         Size sz = getContinuousSize2D(src1, src2, dst, src1.channels());
-        tab[depth1](src1.ptr(), src1.step, src2.ptr(), src2.step, dst.ptr(), dst.step, sz.width, sz.height, usrdata);
+        BinaryFuncC func = tab[depth1];
+        size_t esz1 = src1.elemSize1();
+        parallel_for_elemwise(sz, esz1, [&](int x, int y, Size bsz)
+        {
+            func(src1.ptr() + y*src1.step + x*esz1, src1.step, src2.ptr() + y*src2.step + x*esz1, src2.step,
+                 dst.ptr() + y*dst.step + x*esz1, dst.step, bsz.width, bsz.height, usrdata);
+        });
         return;
     }
 
@@ -1247,7 +1258,12 @@ void cv::compare(InputArray _src1, InputArray _src2, OutputArray _dst, int op)
         Size sz = getContinuousSize2D(src1, src2, dst, src1.channels());
         BinaryFuncC cmpFn = getCmpFunc(depth1);
         CV_Assert(cmpFn);
-        cmpFn(src1.ptr(), src1.step, src2.ptr(), src2.step, dst.ptr(), dst.step, sz.width, sz.height, &op);
+        size_t esz1 = src1.elemSize1();
+        parallel_for_elemwise(sz, esz1, [&](int x, int y, Size bsz)
+        {
+            cmpFn(src1.ptr() + y*src1.step + x*esz1, src1.step, src2.ptr() + y*src2.step + x*esz1, src2.step,
+                  dst.ptr() + y*dst.step + x, dst.step, bsz.width, bsz.height, &op);
+        });
         return;
     }
 
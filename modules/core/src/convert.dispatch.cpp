@@ -210,7 +210,12 @@ void Mat::convertTo(OutputArray _dst, int _type, double alpha, double beta) cons
     if( dims <= 2 )
     {
         Size sz = getContinuousSize2D(src, dst, cn);
-        func( src.data, src.step, 0, 0, dst.data, dst.step, sz, scale );
+        size_t sesz1 = src.elemSize1(), desz1 = dst.elemSize1();
+        parallel_for_elemwise(sz, std::max(sesz1, desz1), [&](int x, int y, Size bsz)
+        {
+            func( src.data + y*src.step + x*sesz1, src.step, 0, 0,
+                  dst.data + y*dst.step + x*desz1, dst.step, bsz, scale );
+        });
     }
     else
     {
@@ -271,7 +276,12 @@ void convertFp16(InputArray _src, OutputArray _dst)
     if( src.dims <= 2 )
     {
         Size sz = getContinuousSize2D(src, dst, cn);
-        func( src.data, src.step, 0, 0, dst.data, dst.step, sz, 0);
+        size_t sesz1 = src.elemSize1(), desz1 = dst.elemSize1();
+        parallel_for_elemwise(sz, std::max(sesz1, desz1), [&](int x, int y, Size bsz)
+        {
+            func( src.data + y*src.step + x*sesz1, src.step, 0, 0,
+                  dst.data + y*dst.step + x*desz1, dst.step, bsz, 0);
+        });
     }
     else
     {
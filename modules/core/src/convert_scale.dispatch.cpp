@@ -103,7 +103,12 @@ void convertScaleAbs(InputArray _src, OutputArray _dst, double alpha, double bet
     if( src.dims <= 2 )
     {
         Size sz = getContinuousSize2D(src, dst, cn);
-        func( src.ptr(), src.step, 0, 0, dst.ptr(), dst.step, sz, scale );
+        size_t esz1 = src.elemSize1();
+        parallel_for_elemwise(sz, esz1, [&](int x, int y, Size bsz)
+        {
+            func( src.ptr() + y*src.step + x*esz1, src.step, 0, 0,
+                  dst.ptr() + y*dst.step + x, dst.step, bsz, scale );
+        });
     }
     else
     {
@@ -143,6 +143,18 @@ int countNonZero(InputArray _src)
     CountNonZeroFunc func = getCountNonZeroTab(src.depth());
     CV_Assert( func != 0 );
 
+    int nchunks = getReduceChunks(src, Mat());
+    if( nchunks > 0 )
+    {
+        std::vector<int> partial(nchunks, 0);
+        parallel_reduce_chunks(src, Mat(), nchunks, [&](int c, const uchar* ptr, const uchar*, int len, size_t)
+        {
+            partial[c] += func( ptr, len );
+        });
+        reduceChunksTree(nchunks, [&](int i, int j) { partial[i] += partial[j]; });
+        return partial[0];
+    }
+
     const Mat* arrays[] = {&src, 0};
     uchar* ptrs[1] = {};
     NAryMatIterator it(arrays, ptrs);
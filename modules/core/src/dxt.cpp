@@ -43,6 +43,8 @@
 #include "opencv2/core/opencl/runtime/opencl_clamdfft.hpp"
 #include "opencv2/core/opencl/runtime/opencl_core.hpp"
 #include "opencl_kernels_core.hpp"
+#include "opencv2/core/utils/configuration.private.hpp"
+#include "opencv2/core/utils/tls.hpp"
 #include <map>
 
 namespace cv
@@ -2778,6 +2780,11 @@ inline DftDims determineDims(int rows, int cols, bool isRowWise, bool isContinuo
     return InvalidDim;
 }
 
+static bool isReentrantDFT1D(const hal::DFT1D* context);
+
+// the rows (the columns) are processed by several threads if the transform is at least that large
+#define CV_DFT_PARALLEL_MIN_SIZE  (1 << 16)
+
 class OcvDftImpl CV_FINAL : public hal::DFT2D
 {
 protected:
@@ -2785,6 +2792,8 @@ protected:
     Ptr<hal::DFT1D> contextB;
     bool needBufferA;
     bool needBufferB;
+    bool parallelA;
+    bool parallelB;
     bool inv;
     int width;
     int height;
@@ -2811,6 +2820,8 @@ public:
     {
         needBufferA = false;
         needBufferB = false;
+        parallelA = false;
+        parallelB = false;
         inv = false;
         width = 0;
         height = 0;
@@ -2933,6 +2944,7 @@ public:
                 contextA = hal::DFT1D::create(len, count, depth, f, &needBufferA);
                 if (needBufferA)
                     tmp_bufA.allocate(len * complex_elem_size);
+                parallelA = isReentrantDFT1D(contextA.get()) && (int64)len*count >= CV_DFT_PARALLEL_MIN_SIZE;
             }
             else
             {
@@ -2943,6 +2955,7 @@ public:
                 contextB = hal::DFT1D::create(len, count, depth, f, &needBufferB);
                 if (needBufferB)
                     tmp_bufB.allocate(len * complex_elem_size);
+                parallelB = isReentrantDFT1D(contextB.get()) && (int64)len*count >= CV_DFT_PARALLEL_MIN_SIZE;
 
                 buf0.allocate(len * complex_elem_size);
                 buf1.allocate(len * complex_elem_size);
@@ -3058,29 +3071,82 @@ protected:
         if( nz <= 0 || nz > count )
             nz = count;
 
-        int i;
-        for( i = 0; i < nz; i++ )
+        if( parallelA && nz > 1 )
+        {
+            // each 1D transform reads the shared tables only, so the rows are independent
+            parallel_for_(Range(0, nz), [&](const Range& r)
+            {
+                AutoBuffer<uchar> buf;
+                if( needBufferA )
+                    buf.allocate(len * complex_elem_size);
+                rowDftRange(src_data, src_step, dst_data, dst_step, r, buf.data(), dptr_offset, dst_full_len);
+            }, (double)nz*len/CV_DFT_PARALLEL_MIN_SIZE*4);
+        }
+        else
+            rowDftRange(src_data, src_step, dst_data, dst_step, Range(0, nz), tmp_bufA.data(), dptr_offset, dst_full_len);
+
+        for( int i = nz; i < count; i++ )
+        {
+            uchar* dptr0 = dst_data + dst_step * i;
+            memset( dptr0, 0, dst_full_len );
+        }
+        if(isLastStage &&  mode == FwdRealToComplex)
+            complementComplexOutput(depth, dst_data, dst_step, len, nz, 1);
+    }
+
+    void rowDftRange(const uchar* src_data, size_t src_step, uchar* dst_data, size_t dst_step,
+                     const Range& range, uchar* tmp_buf, int dptr_offset, int dst_full_len)
+    {
+        for( int i = range.start; i < range.end; i++ )
         {
             const uchar* sptr = src_data + src_step * i;
             uchar* dptr0 = dst_data + dst_step * i;
             uchar* dptr = dptr0;
 
             if( needBufferA )
-                dptr = tmp_bufA.data();
+                dptr = tmp_buf;
 
             contextA->apply(sptr, dptr);
 
             if( needBufferA )
                 memcpy( dptr0, dptr + dptr_offset, dst_full_len );
         }
+    }
 
-        for( ; i < count; i++ )
+    // transforms the columns [sptr0 + 2*pairs.start, sptr0 + 2*pairs.end) (in complex elements) pairwise
+    void colDftRange(const uchar* sptr0, size_t src_step, uchar* dptr0, size_t dst_step, int ncols,
+                     const Range& pairs, uchar* b0, uchar* b1, uchar* tmp_buf)
+    {
+        int len = height;
+        uchar *dbuf0 = b0, *dbuf1 = b1;
+
+        if( needBufferB )
         {
-            uchar* dptr0 = dst_data + dst_step * i;
-            memset( dptr0, 0, dst_full_len );
+            dbuf1 = tmp_buf;
+            dbuf0 = b1;
+        }
+
+        sptr0 += (size_t)pairs.start*2*complex_elem_size;
+        dptr0 += (size_t)pairs.start*2*complex_elem_size;
+        for( int i = pairs.start*2; i < pairs.end*2 && i < ncols; i += 2 )
+        {
+            if( i+1 < ncols )
+            {
+                CopyFrom2Columns( sptr0, src_step, b0, b1, len, complex_elem_size );
+                contextB->apply(b1, dbuf1);
+            }
+            else
+                CopyColumn( sptr0, src_step, b0, complex_elem_size, len, complex_elem_size );
+
+            contextB->apply(b0, dbuf0);
+
+            if( i+1 < ncols )
+                CopyTo2Columns( dbuf0, dbuf1, dptr0, dst_step, len, complex_elem_size );
+            else
+                CopyColumn( dbuf0, complex_elem_size, dptr0, dst_step, len, complex_elem_size );
+            sptr0 += 2*complex_elem_size;
+            dptr0 += 2*complex_elem_size;
         }
-        if(isLastStage &&  mode == FwdRealToComplex)
-            complementComplexOutput(depth, dst_data, dst_step, len, nz, 1);
     }
 
     void colDft(const uchar* src_data, size_t src_step, uchar* dst_data, size_t dst_step, int stage_src_channels, int stage_dst_channels, bool isLastStage)
@@ -3186,25 +3252,19 @@ protected:
             }
         }
 
-        for(int i = a; i < b; i += 2 )
+        int ncols = b - a, npairs = (ncols + 1)/2;
+        if( parallelB && npairs > 1 )
         {
-            if( i+1 < b )
+            parallel_for_(Range(0, npairs), [&](const Range& r)
             {
-                CopyFrom2Columns( sptr0, src_step, buf0.data(), buf1.data(), len, complex_elem_size );
-                contextB->apply(buf1.data(), dbuf1);
-            }
-            else
-                CopyColumn( sptr0, src_step, buf0.data(), complex_elem_size, len, complex_elem_size );
-
-            contextB->apply(buf0.data(), dbuf0);
-
-            if( i+1 < b )
-                CopyTo2Columns( dbuf0, dbuf1, dptr0, dst_step, len, complex_elem_size );
-            else
-                CopyColumn( dbuf0, complex_elem_size, dptr0, dst_step, len, complex_elem_size );
-            sptr0 += 2*complex_elem_size;
-            dptr0 += 2*complex_elem_size;
+                AutoBuffer<uchar> buf(len * complex_elem_size * (needBufferB ? 3 : 2));
+                uchar* b0 = buf.data();
+                uchar* b1 = b0 + len * complex_elem_size;
+                colDftRange(sptr0, src_step, dptr0, dst_step, ncols, r, b0, b1, b1 + len * complex_elem_size);
+            }, (double)npairs*2*len/CV_DFT_PARALLEL_MIN_SIZE*4);
         }
+        else
+            colDftRange(sptr0, src_step, dptr0, dst_step, ncols, Range(0, npairs), buf0.data(), buf1.data(), tmp_bufB.data());
         if(isLastStage && mode == FwdRealToComplex)
             complementComplexOutput(depth, dst_data, dst_step, count, len, 2);
     }
@@ -3373,6 +3433,13 @@ public:
     void free() {}
 };
 
+static bool isReentrantDFT1D(const hal::DFT1D* context)
+{
+    // IPP keeps the work buffer in the context; the external HAL implementations are unknown
+    const OcvDftBasicImpl* impl = dynamic_cast<const OcvDftBasicImpl*>(context);
+    return impl && !impl->opt.useIpp;
+}
+
 struct ReplacementDFT1D : public hal::DFT1D
 {
     cvhalDFT *context;
@@ -3483,6 +3550,141 @@ Ptr<DFT2D> DFT2D::create(int width, int height, int depth,
 } // cv::
 
 
+namespace cv {
+
+struct DftPlanCacheEntry
+{
+    int width, height, depth, src_channels, dst_channels, flags, nonzero_rows;
+    Ptr<hal::DFT2D> context;
+};
+
+// a few recently used transform contexts of the thread, the most recently used one goes first
+struct DftPlanCache
+{
+    std::vector<DftPlanCacheEntry> entries;
+};
+
+static TLSData<DftPlanCache>& getDftPlanCacheTLS()
+{
+    CV_SINGLETON_LAZY_INIT_REF(TLSData<DftPlanCache>, new TLSData<DftPlanCache>())
+}
+
+static size_t getDftPlanCacheSize()
+{
+    static size_t size = utils::getConfigurationParameterSizeT("OPENCV_DFT_PLAN_CACHE_SIZE", 4);
+    return size;
+}
+
+static Ptr<hal::DFT2D> getCachedDFT2D(int width, int height, int depth,
+                                      int src_channels, int dst_channels,
+                                      int flags, int nonzero_rows)
+{
+    size_t maxSize = getDftPlanCacheSize();
+    if( maxSize == 0 )
+        return hal::DFT2D::create(width, height, depth, src_channels, dst_channels, flags, nonzero_rows);
+
+    std::vector<DftPlanCacheEntry>& entries = getDftPlanCacheTLS().getRef().entries;
+    for( size_t i = 0; i < entries.size(); i++ )
+    {
+        const DftPlanCacheEntry& e = entries[i];
+        if( e.width == width && e.height == height && e.depth == depth &&
+            e.src_channels == src_channels && e.dst_channels == dst_channels &&
+            e.flags == flags && e.nonzero_rows == nonzero_rows )
+        {
+            std::rotate(entries.begin(), entries.begin() + i, entries.begin() + i + 1);
+            return entries[0].context;
+        }
+    }
+
+    DftPlanCacheEntry e = { width, height, depth, src_channels, dst_channels, flags, nonzero_rows,
+        hal::DFT2D::create(width, height, depth, src_channels, dst_channels, flags, nonzero_rows) };
+    if( entries.size() >= maxSize )
+        entries.resize(maxSize - 1);
+    entries.insert(entries.begin(), e);
+    return e.context;
+}
+
+static int dftOutputType(int type, int flags)
+{
+    bool inv = (flags & DFT_INVERSE) != 0;
+    int depth = CV_MAT_DEPTH(type), cn = CV_MAT_CN(type);
+    if( !inv && cn == 1 && (flags & DFT_COMPLEX_OUTPUT) )
+        return CV_MAKETYPE(depth, 2);
+    if( inv && cn == 2 && (flags & DFT_REAL_OUTPUT) )
+        return depth;
+    return type;
+}
+
+static int dftHalFlags(const Mat& src, const Mat& dst, int flags)
+{
+    int f = 0;
+    if (src.isContinuous() && dst.isContinuous())
+        f |= CV_HAL_DFT_IS_CONTINUOUS;
+    if (flags & DFT_INVERSE)
+        f |= CV_HAL_DFT_INVERSE;
+    if (flags & DFT_ROWS)
+        f |= CV_HAL_DFT_ROWS;
+    if (flags & DFT_SCALE)
+        f |= CV_HAL_DFT_SCALE;
+    if (src.data == dst.data)
+        f |= CV_HAL_DFT_IS_INPLACE;
+    return f;
+}
+
+class DFTPlanImpl CV_FINAL : public DFTPlan
+{
+public:
+    DFTPlanImpl(Size size_, int type_, int flags_, int nonzero_rows_) :
+        size(size_), type(type_), flags(flags_), nonzero_rows(nonzero_rows_)
+    {
+        CV_Assert( type == CV_32FC1 || type == CV_32FC2 || type == CV_64FC1 || type == CV_64FC2 );
+        CV_Assert( !((flags & DFT_COMPLEX_INPUT) && CV_MAT_CN(type) != 2) );
+        CV_Assert( size.width > 0 && size.height > 0 );
+        dst_type = dftOutputType(type, flags);
+    }
+
+    void apply(InputArray _src, OutputArray _dst) CV_OVERRIDE
+    {
+        CV_INSTRUMENT_REGION();
+
+        if( _dst.isUMat() )
+        {
+            dft(_src, _dst, flags, nonzero_rows);
+            return;
+        }
+
+        Mat src = _src.getMat();
+        CV_Assert( src.size() == size && src.type() == type );
+        _dst.create( size, dst_type );
+        Mat dst = _dst.getMat();
+
+        int f = dftHalFlags(src, dst, flags);
+        // the layout of the arrays selects one of the contexts: continuous or not, in-place or not
+        int idx = ((f & CV_HAL_DFT_IS_CONTINUOUS) ? 1 : 0) + ((f & CV_HAL_DFT_IS_INPLACE) ? 2 : 0);
+        if( !contexts[idx] )
+            contexts[idx] = hal::DFT2D::create(size.width, size.height, CV_MAT_DEPTH(type),
+                                               CV_MAT_CN(type), CV_MAT_CN(dst_type), f, nonzero_rows);
+        contexts[idx]->apply(src.data, src.step, dst.data, dst.step);
+    }
+
+protected:
+    Size size;
+    int type;
+    int dst_type;
+    int flags;
+    int nonzero_rows;
+    Ptr<hal::DFT2D> contexts[4];
+};
+
+DFTPlan::~DFTPlan() {}
+
+Ptr<DFTPlan> DFTPlan::create(Size size, int type, int flags, int nonzero_rows)
+{
+    return makePtr<DFTPlanImpl>(size, type, flags, nonzero_rows);
+}
+
+} // cv::
+
 void cv::dft( InputArray _src0, OutputArray _dst, int flags, int nonzero_rows )
 {
     CV_INSTRUMENT_REGION();
@@ -3499,7 +3701,6 @@ void cv::dft( InputArray _src0, OutputArray _dst, int flags, int nonzero_rows )
 #endif
 
     Mat src0 = _src0.getMat(), src = src0;
-    bool inv = (flags & DFT_INVERSE) != 0;
     int type = src.type();
     int depth = src.depth();
 
@@ -3508,27 +3709,12 @@ void cv::dft( InputArray _src0, OutputArray _dst, int flags, int nonzero_rows )
     // Fail if DFT_COMPLEX_INPUT is specified, but src is not 2 channels.
     CV_Assert( !((flags & DFT_COMPLEX_INPUT) && src.channels() != 2) );
 
-    if( !inv && src.channels() == 1 && (flags & DFT_COMPLEX_OUTPUT) )
-        _dst.create( src.size(), CV_MAKETYPE(depth, 2) );
-    else if( inv && src.channels() == 2 && (flags & DFT_REAL_OUTPUT) )
-        _dst.create( src.size(), depth );
-    else
-        _dst.create( src.size(), type );
+    _dst.create( src.size(), dftOutputType(type, flags) );
 
     Mat dst = _dst.getMat();
 
-    int f = 0;
-    if (src.isContinuous() && dst.isContinuous())
-        f |= CV_HAL_DFT_IS_CONTINUOUS;
-    if (inv)
-        f |= CV_HAL_DFT_INVERSE;
-    if (flags & DFT_ROWS)
-        f |= CV_HAL_DFT_ROWS;
-    if (flags & DFT_SCALE)
-        f |= CV_HAL_DFT_SCALE;
-    if (src.data == dst.data)
-        f |= CV_HAL_DFT_IS_INPLACE;
-    Ptr<hal::DFT2D> c = hal::DFT2D::create(src.cols, src.rows, depth, src.channels(), dst.channels(), f, nonzero_rows);
+    int f = dftHalFlags(src, dst, flags);
+    Ptr<hal::DFT2D> c = getCachedDFT2D(src.cols, src.rows, depth, src.channels(), dst.channels(), f, nonzero_rows);
     c->apply(src.data, src.step, dst.data, dst.step);
 }
 
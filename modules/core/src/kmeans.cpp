@@ -51,6 +51,7 @@ namespace cv
 {
 
 static int CV_KMEANS_PARALLEL_GRANULARITY = (int)utils::getConfigurationParameterSizeT("OPENCV_KMEANS_PARALLEL_GRANULARITY", 1000);
+static int CV_KMEANS_MINI_BATCH_SIZE = (int)utils::getConfigurationParameterSizeT("OPENCV_KMEANS_MINI_BATCH_SIZE", 1024);
 
 static void generateRandomCenter(int dims, const Vec2f* box, float* center, RNG& rng)
 {
@@ -91,9 +92,11 @@ private:
 /*
 k-means center initialization using the following algorithm:
 Arthur & Vassilvitskii (2007) k-means++: The Advantages of Careful Seeding
+
+If the weights are specified, the probability to choose a sample is proportional to its weight.
 */
 static void generateCentersPP(const Mat& data, Mat& _out_centers,
-                              int K, RNG& rng, int trials)
+                              int K, RNG& rng, int trials, const float* weights = 0)
 {
     CV_TRACE_FUNCTION();
     const int dims = data.cols, N = data.rows;
@@ -108,7 +111,7 @@ static void generateCentersPP(const Mat& data, Mat& _out_centers,
     for (int i = 0; i < N; i++)
     {
         dist[i] = hal::normL2Sqr_(data.ptr<float>(i), data.ptr<float>(centers[0]), dims);
-        sum0 += dist[i];
+        sum0 += weights ? weights[i]*dist[i] : dist[i];
     }
 
     for (int k = 1; k < K; k++)
@@ -122,7 +125,7 @@ static void generateCentersPP(const Mat& data, Mat& _out_centers,
             int ci = 0;
             for (; ci < N - 1; ci++)
             {
-                p -= dist[ci];
+                p -= weights ? weights[ci]*dist[ci] : dist[ci];
                 if (p <= 0)
                     break;
             }
@@ -133,7 +136,7 @@ static void generateCentersPP(const Mat& data, Mat& _out_centers,
             double s = 0;
             for (int i = 0; i < N; i++)
             {
-                s += tdist2[i];
+                s += weights ? weights[i]*tdist2[i] : tdist2[i];
             }
 
             if (s < bestSum)
@@ -159,6 +162,124 @@ static void generateCentersPP(const Mat& data, Mat& _out_centers,
     }
 }
 
+class KMeansMinDistanceComputer : public ParallelLoopBody
+{
+public:
+    KMeansMinDistanceComputer(float *dist_, int *nearest_, const Mat& data_, const int *candidates_, int first_, int count_) :
+        dist(dist_), nearest(nearest_), data(data_), candidates(candidates_), first(first_), count(count_)
+    { }
+
+    void operator()( const cv::Range& range ) const CV_OVERRIDE
+    {
+        CV_TRACE_FUNCTION();
+        const int dims = data.cols;
+
+        for (int i = range.start; i < range.end; i++)
+        {
+            const float* sample = data.ptr<float>(i);
+            for (int c = first; c < first + count; c++)
+            {
+                float d = hal::normL2Sqr_(sample, data.ptr<float>(candidates[c]), dims);
+                if (d < dist[i])
+                {
+                    dist[i] = d;
+                    nearest[i] = c;
+                }
+            }
+        }
+    }
+
+private:
+    KMeansMinDistanceComputer& operator=(const KMeansMinDistanceComputer&); // = delete
+
+    float *dist;
+    int *nearest;
+    const Mat& data;
+    const int *candidates;
+    const int first;
+    const int count;
+};
+
+/*
+k-means|| center initialization using the following algorithm:
+Bahmani et al. (2012) Scalable K-Means++
+
+A few rounds oversample the candidates with the probability proportional to the distance to the
+already chosen ones. Each round is a single parallel pass over the data instead of K sequential passes
+of k-means++. The final centers are chosen among the candidates by the weighted k-means++.
+*/
+static void generateCentersParallel(const Mat& data, Mat& _out_centers,
+                                    int K, RNG& rng, int trials)
+{
+    CV_TRACE_FUNCTION();
+    const int dims = data.cols, N = data.rows;
+    const int rounds = 5;
+    const double oversampling = 2.0*K;
+    cv::AutoBuffer<float, 0> _dist(N);
+    cv::AutoBuffer<int, 0> _nearest(N);
+    float* dist = _dist.data();
+    int* nearest = _nearest.data();
+    std::vector<int> candidates;
+
+    for (int i = 0; i < N; i++)
+    {
+        dist[i] = FLT_MAX;
+        nearest[i] = 0;
+    }
+    candidates.push_back((unsigned)rng % N);
+
+    for (int round = 0, first = 0; ; round++)
+    {
+        int count = (int)candidates.size() - first;
+        parallel_for_(Range(0, N),
+                      KMeansMinDistanceComputer(dist, nearest, data, candidates.data(), first, count),
+                      (double)divUp((size_t)dims * N * count, CV_KMEANS_PARALLEL_GRANULARITY));
+        if (round == rounds)
+            break;
+
+        double sum = 0;
+        for (int i = 0; i < N; i++)
+            sum += dist[i];
+        if (!(sum > 0))
+        {
+            if (sum == 0)
+                break;  // all the samples are the candidates already
+            CV_Error(Error::StsNoConv, "kmeans: can't update cluster center (check input for huge or NaN values)");
+        }
+
+        first = (int)candidates.size();
+        for (int i = 0; i < N; i++)
+        {
+            if ((double)rng*sum < oversampling*dist[i])
+                candidates.push_back(i);
+        }
+    }
+
+    const int ncandidates = (int)candidates.size();
+    if (ncandidates <= K)
+    {
+        for (int k = 0; k < K; k++)
+        {
+            int i = k < ncandidates ? candidates[k] : (int)((unsigned)rng % N);
+            data.row(i).copyTo(_out_centers.row(k));
+        }
+        return;
+    }
+
+    // weight of a candidate is the number of the samples that are closest to it
+    Mat cdata(ncandidates, dims, CV_32F);
+    cv::AutoBuffer<float, 0> weights(ncandidates);
+    for (int c = 0; c < ncandidates; c++)
+    {
+        data.row(candidates[c]).copyTo(cdata.row(c));
+        weights[c] = 0.f;
+    }
+    for (int i = 0; i < N; i++)
+        weights[nearest[i]] += 1.f;
+
+    generateCentersPP(cdata, _out_centers, K, rng, trials, weights.data());
+}
+
 template<bool onlyDistance>
 class KMeansDistanceComputer : public ParallelLoopBody
 {
@@ -223,6 +344,177 @@ private:
     const Mat& centers;
 };
 
+/*
+The assignment step with the distance bounds:
+Hamerly (2010) Making k-means even faster
+
+upper[i] is the upper bound of the distance from the sample to its center, lower[i] is the lower
+bound of the distance to the second closest center. The sample keeps its label without computing
+the distances to all the centers if the upper bound is below the lower one or the half of the
+distance from its center to the closest other center. The full search compares the distances
+computed in float, so the bound has to be below by more than their rounding error: otherwise
+another center may be as close as the current one, and the full search picks the first of them.
+Without the center shifts all the distances are computed and the bounds are initialized.
+*/
+class KMeansHamerlyComputer : public ParallelLoopBody
+{
+public:
+    KMeansHamerlyComputer( double *upper_,
+                           double *lower_,
+                           int *labels_,
+                           const Mat& data_,
+                           const Mat& centers_,
+                           const double *shift_ = 0,
+                           const double *lowerShift_ = 0,
+                           const double *halfCenterDist_ = 0)
+        : upper(upper_),
+          lower(lower_),
+          labels(labels_),
+          data(data_),
+          centers(centers_),
+          shift(shift_),
+          lowerShift(lowerShift_),
+          halfCenterDist(halfCenterDist_)
+    {
+    }
+
+    void operator()(const Range& range) const CV_OVERRIDE
+    {
+        CV_TRACE_FUNCTION();
+        const int K = centers.rows;
+        const int dims = centers.cols;
+        // the relative error of the distances, which are the square roots of the float sums of dims squares
+        const double tol = 1 - (dims + 2)*FLT_EPSILON;
+
+        for (int i = range.start; i < range.end; ++i)
+        {
+            const float *sample = data.ptr<float>(i);
+            if (shift)
+            {
+                int k = labels[i];
+                upper[i] += shift[k];
+                lower[i] -= lowerShift[k];
+                double bound = std::max(halfCenterDist[k], lower[i])*tol;
+                if (upper[i] < bound)
+                    continue;
+                upper[i] = std::sqrt((double)hal::normL2Sqr_(sample, centers.ptr<float>(k), dims));
+                if (upper[i] < bound)
+                    continue;
+            }
+
+            int k_best = 0;
+            double min_dist = DBL_MAX, min_dist2 = DBL_MAX;
+
+            for (int k = 0; k < K; k++)
+            {
+                const float* center = centers.ptr<float>(k);
+                const double dist = hal::normL2Sqr_(sample, center, dims);
+
+                if (min_dist > dist)
+                {
+                    min_dist2 = min_dist;
+                    min_dist = dist;
+                    k_best = k;
+                }
+                else if (min_dist2 > dist)
+                    min_dist2 = dist;
+            }
+
+            labels[i] = k_best;
+            upper[i] = std::sqrt(min_dist);
+            lower[i] = std::sqrt(min_dist2);
+        }
+    }
+
+private:
+    KMeansHamerlyComputer& operator=(const KMeansHamerlyComputer&); // = delete
+
+    double *upper;
+    double *lower;
+    int *labels;
+    const Mat& data;
+    const Mat& centers;
+    const double *shift;
+    const double *lowerShift;
+    const double *halfCenterDist;
+};
+
+class KMeansCenterDistanceComputer : public ParallelLoopBody
+{
+public:
+    KMeansCenterDistanceComputer(double *halfCenterDist_, const Mat& centers_) :
+        halfCenterDist(halfCenterDist_), centers(centers_)
+    { }
+
+    void operator()(const Range& range) const CV_OVERRIDE
+    {
+        CV_TRACE_FUNCTION();
+        const int K = centers.rows;
+        const int dims = centers.cols;
+
+        for (int k = range.start; k < range.end; k++)
+        {
+            double min_dist = DBL_MAX;
+            for (int j = 0; j < K; j++)
+            {
+                if (j != k)
+                    min_dist = std::min(min_dist, (double)hal::normL2Sqr_(centers.ptr<float>(k), centers.ptr<float>(j), dims));
+            }
+            halfCenterDist[k] = 0.5*std::sqrt(min_dist);
+        }
+    }
+
+private:
+    KMeansCenterDistanceComputer& operator=(const KMeansCenterDistanceComputer&); // = delete
+
+    double *halfCenterDist;
+    const Mat& centers;
+};
+
+/*
+Mini-batch k-means:
+Sculley (2010) Web-scale k-means clustering
+
+Each iteration assigns a random batch of the samples to the nearest centers and moves the centers
+towards the samples with the per-center learning rate 1/(number of the samples assigned so far).
+*/
+static void kmeansMiniBatch(const Mat& data, Mat& centers, TermCriteria criteria, int batchSize, RNG& rng)
+{
+    CV_TRACE_FUNCTION();
+    const int dims = data.cols, N = data.rows, K = centers.rows;
+    Mat batch(batchSize, dims, CV_32F), old_centers;
+    cv::AutoBuffer<int, 64> batchLabels(batchSize);
+    cv::AutoBuffer<double, 64> batchDists(batchSize);
+    std::vector<int64> counters(K, 0);
+
+    for (int iter = 0; iter < criteria.maxCount; iter++)
+    {
+        for (int b = 0; b < batchSize; b++)
+            data.row(rng.uniform(0, N)).copyTo(batch.row(b));
+
+        parallel_for_(Range(0, batchSize), KMeansDistanceComputer<false>(batchDists.data(), batchLabels.data(), batch, centers),
+                      (double)divUp((size_t)(dims * batchSize * K), CV_KMEANS_PARALLEL_GRANULARITY));
+
+        centers.copyTo(old_centers);
+        for (int b = 0; b < batchSize; b++)
+        {
+            int k = batchLabels[b];
+            float* center = centers.ptr<float>(k);
+            const float* sample = batch.ptr<float>(b);
+            float eta = 1.f/(float)(++counters[k]);
+            for (int j = 0; j < dims; j++)
+                center[j] += (sample[j] - center[j])*eta;
+        }
+
+        double max_center_shift = 0;
+        for (int k = 0; k < K; k++)
+            max_center_shift = std::max(max_center_shift,
+                    (double)hal::normL2Sqr_(centers.ptr<float>(k), old_centers.ptr<float>(k), dims));
+        if (iter > 0 && max_center_shift <= criteria.epsilon)
+            break;
+    }
+}
+
 }
 
 double cv::kmeans( InputArray _data, int K,
@@ -277,6 +569,9 @@ double cv::kmeans( InputArray _data, int K,
     cv::AutoBuffer<int, 64> counters(K);
     cv::AutoBuffer<double, 64> dists(N);
     RNG& rng = theRNG();
+    const bool miniBatch = (flags & KMEANS_MINI_BATCH) != 0;
+    const int miniBatchIters = (criteria.type & TermCriteria::COUNT) ? std::max(criteria.maxCount, 1) : 100;
+    const int miniBatchSize = std::min(std::max(CV_KMEANS_MINI_BATCH_SIZE, 1), N);
 
     if (criteria.type & TermCriteria::EPS)
         criteria.epsilon = std::max(criteria.epsilon, 0.);
@@ -295,6 +590,11 @@ double cv::kmeans( InputArray _data, int K,
         criteria.maxCount = 2;
     }
 
+    // distance bounds of the samples, see KMeansHamerlyComputer
+    cv::AutoBuffer<double, 64> upper(miniBatch ? 1 : N), lower(miniBatch ? 1 : N);
+    cv::AutoBuffer<double, 64> centerShift(K), lowerShift(K), halfCenterDist(K);
+    bool boundsValid = false;
+
     cv::AutoBuffer<Vec2f, 64> box(dims);
     if (!(flags & KMEANS_PP_CENTERS))
     {
@@ -320,16 +620,23 @@ double cv::kmeans( InputArray _data, int K,
     {
         double compactness = 0;
 
-        for (int iter = 0; ;)
+        if (miniBatch)
         {
-            double max_center_shift = iter == 0 ? DBL_MAX : 0.0;
-
-            swap(centers, old_centers);
-
-            if (iter == 0 && (a > 0 || !(flags & KMEANS_USE_INITIAL_LABELS)))
+            if (a > 0 || !(flags & KMEANS_USE_INITIAL_LABELS))
             {
                 if (flags & KMEANS_PP_CENTERS)
-                    generateCentersPP(data, centers, K, rng, SPP_TRIALS);
+                {
+                    // like the iterations, the initialization uses a random subset of the samples
+                    int initSize = std::min(N, std::max(3*miniBatchSize, 3*K));
+                    Mat initData = data;
+                    if (initSize < N)
+                    {
+                        initData.create(initSize, dims, CV_32F);
+                        for (int i = 0; i < initSize; i++)
+                            data.row(rng.uniform(0, N)).copyTo(initData.row(i));
+                    }
+                    generateCentersParallel(initData, centers, K, rng, SPP_TRIALS);
+                }
                 else
                 {
                     for (int k = 0; k < K; k++)
@@ -338,108 +645,187 @@ double cv::kmeans( InputArray _data, int K,
             }
             else
             {
-                // compute centers
+                // the centers of the user-supplied clusters, random samples for the empty ones
                 centers = Scalar(0);
                 for (int k = 0; k < K; k++)
                     counters[k] = 0;
-
                 for (int i = 0; i < N; i++)
                 {
-                    const float* sample = data.ptr<float>(i);
-                    int k = labels[i];
-                    float* center = centers.ptr<float>(k);
-                    for (int j = 0; j < dims; j++)
-                        center[j] += sample[j];
-                    counters[k]++;
+                    centers.row(labels[i]) += data.row(i);
+                    counters[labels[i]]++;
                 }
-
                 for (int k = 0; k < K; k++)
                 {
-                    if (counters[k] != 0)
-                        continue;
-
-                    // if some cluster appeared to be empty then:
-                    //   1. find the biggest cluster
-                    //   2. find the farthest from the center point in the biggest cluster
-                    //   3. exclude the farthest point from the biggest cluster and form a new 1-point cluster.
-                    int max_k = 0;
-                    for (int k1 = 1; k1 < K; k1++)
+                    if (counters[k] > 0)
+                        centers.row(k) *= 1./counters[k];
+                    else
+                        data.row(rng.uniform(0, N)).copyTo(centers.row(k));
+                }
+            }
+
+            kmeansMiniBatch(data, centers, TermCriteria(TermCriteria::COUNT, miniBatchIters, criteria.epsilon),
+                            miniBatchSize, rng);
+
+            parallel_for_(Range(0, N), KMeansDistanceComputer<false>(dists.data(), labels, data, centers), (double)divUp((size_t)(dims * N * K), CV_KMEANS_PARALLEL_GRANULARITY));
+            compactness = sum(Mat(Size(N, 1), CV_64F, &dists[0]))[0];
+        }
+        else
+        {
+            for (int iter = 0; ;)
+            {
+                double max_center_shift = iter == 0 ? DBL_MAX : 0.0;
+
+                swap(centers, old_centers);
+
+                if (iter == 0)
+                    boundsValid = false;
+
+                if (iter == 0 && (a > 0 || !(flags & KMEANS_USE_INITIAL_LABELS)))
+                {
+                    if (flags & KMEANS_PP_CENTERS)
+                        generateCentersPP(data, centers, K, rng, SPP_TRIALS);
+                    else
                     {
-                        if (counters[max_k] < counters[k1])
-                            max_k = k1;
+                        for (int k = 0; k < K; k++)
+                            generateRandomCenter(dims, box.data(), centers.ptr<float>(k), rng);
                     }
-
-                    double max_dist = 0;
-                    int farthest_i = -1;
-                    float* base_center = centers.ptr<float>(max_k);
-                    float* _base_center = temp.ptr<float>(); // normalized
-                    float scale = 1.f/counters[max_k];
-                    for (int j = 0; j < dims; j++)
-                        _base_center[j] = base_center[j]*scale;
+                }
+                else
+                {
+                    // compute centers
+                    centers = Scalar(0);
+                    for (int k = 0; k < K; k++)
+                        counters[k] = 0;
 
                     for (int i = 0; i < N; i++)
                     {
-                        if (labels[i] != max_k)
-                            continue;
                         const float* sample = data.ptr<float>(i);
-                        double dist = hal::normL2Sqr_(sample, _base_center, dims);
+                        int k = labels[i];
+                        float* center = centers.ptr<float>(k);
+                        for (int j = 0; j < dims; j++)
+                            center[j] += sample[j];
+                        counters[k]++;
+                    }
+
+                    for (int k = 0; k < K; k++)
+                    {
+                        if (counters[k] != 0)
+                            continue;
 
-                        if (max_dist <= dist)
+                        // if some cluster appeared to be empty then:
+                        //   1. find the biggest cluster
+                        //   2. find the farthest from the center point in the biggest cluster
+                        //   3. exclude the farthest point from the biggest cluster and form a new 1-point cluster.
+                        int max_k = 0;
+                        for (int k1 = 1; k1 < K; k1++)
                         {
-                            max_dist = dist;
-                            farthest_i = i;
+                            if (counters[max_k] < counters[k1])
+                                max_k = k1;
                         }
-                    }
 
-                    counters[max_k]--;
-                    counters[k]++;
-                    labels[farthest_i] = k;
+                        double max_dist = 0;
+                        int farthest_i = -1;
+                        float* base_center = centers.ptr<float>(max_k);
+                        float* _base_center = temp.ptr<float>(); // normalized
+                        float scale = 1.f/counters[max_k];
+                        for (int j = 0; j < dims; j++)
+                            _base_center[j] = base_center[j]*scale;
 
-                    const float* sample = data.ptr<float>(farthest_i);
-                    float* cur_center = centers.ptr<float>(k);
-                    for (int j = 0; j < dims; j++)
-                    {
-                        base_center[j] -= sample[j];
-                        cur_center[j] += sample[j];
-                    }
-                }
+                        for (int i = 0; i < N; i++)
+                        {
+                            if (labels[i] != max_k)
+                                continue;
+                            const float* sample = data.ptr<float>(i);
+                            double dist = hal::normL2Sqr_(sample, _base_center, dims);
+
+                            if (max_dist <= dist)
+                            {
+                                max_dist = dist;
+                                farthest_i = i;
+                            }
+                        }
 
-                for (int k = 0; k < K; k++)
-                {
-                    float* center = centers.ptr<float>(k);
-                    CV_Assert( counters[k] != 0 );
+                        counters[max_k]--;
+                        counters[k]++;
+                        labels[farthest_i] = k;
+                        // the bounds of the moved sample are not valid anymore
+                        upper[farthest_i] = DBL_MAX;
+                        lower[farthest_i] = 0;
 
-                    float scale = 1.f/counters[k];
-                    for (int j = 0; j < dims; j++)
-                        center[j] *= scale;
+                        const float* sample = data.ptr<float>(farthest_i);
+                        float* cur_center = centers.ptr<float>(k);
+                        for (int j = 0; j < dims; j++)
+                        {
+                            base_center[j] -= sample[j];
+                            cur_center[j] += sample[j];
+                        }
+                    }
 
-                    if (iter > 0)
+                    for (int k = 0; k < K; k++)
                     {
-                        double dist = 0;
-                        const float* old_center = old_centers.ptr<float>(k);
+                        float* center = centers.ptr<float>(k);
+                        CV_Assert( counters[k] != 0 );
+
+                        float scale = 1.f/counters[k];
                         for (int j = 0; j < dims; j++)
+                            center[j] *= scale;
+
+                        if (iter > 0)
                         {
-                            double t = center[j] - old_center[j];
-                            dist += t*t;
+                            double dist = 0;
+                            const float* old_center = old_centers.ptr<float>(k);
+                            for (int j = 0; j < dims; j++)
+                            {
+                                double t = center[j] - old_center[j];
+                                dist += t*t;
+                            }
+                            max_center_shift = std::max(max_center_shift, dist);
+                            centerShift[k] = std::sqrt(dist);
                         }
-                        max_center_shift = std::max(max_center_shift, dist);
                     }
                 }
-            }
 
-            bool isLastIter = (++iter == MAX(criteria.maxCount, 2) || max_center_shift <= criteria.epsilon);
+                bool isLastIter = (++iter == MAX(criteria.maxCount, 2) || max_center_shift <= criteria.epsilon);
 
-            if (isLastIter)
-            {
-                // don't re-assign labels to avoid creation of empty clusters
-                parallel_for_(Range(0, N), KMeansDistanceComputer<true>(dists.data(), labels, data, centers), (double)divUp((size_t)(dims * N), CV_KMEANS_PARALLEL_GRANULARITY));
-                compactness = sum(Mat(Size(N, 1), CV_64F, &dists[0]))[0];
-                break;
-            }
-            else
-            {
-                // assign labels
-                parallel_for_(Range(0, N), KMeansDistanceComputer<false>(dists.data(), labels, data, centers), (double)divUp((size_t)(dims * N * K), CV_KMEANS_PARALLEL_GRANULARITY));
+                if (isLastIter)
+                {
+                    // don't re-assign labels to avoid creation of empty clusters
+                    parallel_for_(Range(0, N), KMeansDistanceComputer<true>(dists.data(), labels, data, centers), (double)divUp((size_t)(dims * N), CV_KMEANS_PARALLEL_GRANULARITY));
+                    compactness = sum(Mat(Size(N, 1), CV_64F, &dists[0]))[0];
+                    break;
+                }
+                else
+                {
+                    // assign labels
+                    if (boundsValid)
+                    {
+                        parallel_for_(Range(0, K), KMeansCenterDistanceComputer(halfCenterDist.data(), centers), (double)divUp((size_t)(dims * K * K), CV_KMEANS_PARALLEL_GRANULARITY));
+                        // the lower bound decreases by the largest shift of the other centers
+                        int max_k = 0;
+                        for (int k = 1; k < K; k++)
+                        {
+                            if (centerShift[max_k] < centerShift[k])
+                                max_k = k;
+                        }
+                        double max_shift2 = 0;
+                        for (int k = 0; k < K; k++)
+                        {
+                            if (k != max_k)
+                                max_shift2 = std::max(max_shift2, centerShift[k]);
+                        }
+                        for (int k = 0; k < K; k++)
+                            lowerShift[k] = k == max_k ? max_shift2 : centerShift[max_k];
+
+                        parallel_for_(Range(0, N), KMeansHamerlyComputer(upper.data(), lower.data(), labels, data, centers,
+                                                                         centerShift.data(), lowerShift.data(), halfCenterDist.data()),
+                                      (double)divUp((size_t)(dims * N * K), CV_KMEANS_PARALLEL_GRANULARITY));
+                    }
+                    else
+                    {
+                        parallel_for_(Range(0, N), KMeansHamerlyComputer(upper.data(), lower.data(), labels, data, centers), (double)divUp((size_t)(dims * N * K), CV_KMEANS_PARALLEL_GRANULARITY));
+                        boundsValid = true;
+                    }
+                }
             }
         }
 
@@ -42,6 +42,7 @@
 //M*/
 
 #include "precomp.hpp"
+#include "opencv2/core/utils/configuration.private.hpp"
 
 #ifdef HAVE_LAPACK
 #define CV_GEMM_BASELINE_ONLY
@@ -741,6 +742,305 @@ static void GEMMStore_64fc( const Complexd* c_data, size_t c_step,
     GEMMStore(c_data, c_step, d_buf, d_buf_step, d_data, d_step, d_size, alpha, beta, flags);
 }
 
+/****************************************************************************************\
+*                    Packed multi-threaded GEMM for large real matrices                  *
+\****************************************************************************************/
+
+// Goto-style GEMM: op(B) is packed once into panels of GEMM_PACKED_NR columns,
+// the output is split into MC x NC tiles processed in parallel,
+// each tile packs its rows of op(A) into panels of GEMM_PACKED_MR rows
+// and computes MR x NR blocks of the result in registers.
+
+template<typename T> struct GEMMPackedVec {};
+
+#if CV_SIMD
+template<> struct GEMMPackedVec<float>
+{
+    typedef v_float32 vtype;
+    enum { nlanes = v_float32::nlanes };
+    static inline vtype setall(float v) { return vx_setall_f32(v); }
+    static inline vtype zero() { return vx_setzero_f32(); }
+};
+#endif
+
+#if CV_SIMD_64F
+template<> struct GEMMPackedVec<double>
+{
+    typedef v_float64 vtype;
+    enum { nlanes = v_float64::nlanes };
+    static inline vtype setall(double v) { return vx_setall_f64(v); }
+    static inline vtype zero() { return vx_setzero_f64(); }
+};
+#endif
+
+enum
+{
+    GEMM_PACKED_MR = 4,
+    GEMM_PACKED_MC = 64,
+    GEMM_PACKED_NC = 256,
+    GEMM_PACKED_KC = 256
+};
+
+#if CV_SIMD
+
+static bool useGEMMPacked( int type, Size d_size, int len )
+{
+    static const bool enabled = utils::getConfigurationParameterBool("OPENCV_GEMM_PACKED", true);
+    if( !enabled || std::min(d_size.width, d_size.height) < 16 || len < 16 ||
+        (double)d_size.width*d_size.height*len < 64.*64*64 )
+        return false;
+#if CV_SIMD_64F
+    return type == CV_32FC1 || type == CV_64FC1;
+#else
+    return type == CV_32FC1;
+#endif
+}
+
+// packs op(A)[i0:i0+mc, k0:k0+kc] into the panels of MR rows, each panel is stored column by column
+template<typename T> static void
+GEMMPackA( const T* a, size_t a_step, bool is_a_t, int i0, int mc, int k0, int kc, T* dst )
+{
+    const int MR = GEMM_PACKED_MR;
+    for( int i = 0; i < mc; i += MR, dst += kc*MR )
+    {
+        int r, k, mr = std::min(MR, mc - i);
+        if( !is_a_t )
+        {
+            for( r = 0; r < mr; r++ )
+            {
+                const T* src = a + (i0 + i + r)*a_step + k0;
+                for( k = 0; k < kc; k++ )
+                    dst[k*MR + r] = src[k];
+            }
+        }
+        else
+        {
+            for( k = 0; k < kc; k++ )
+            {
+                const T* src = a + (k0 + k)*a_step + i0 + i;
+                for( r = 0; r < mr; r++ )
+                    dst[k*MR + r] = src[r];
+            }
+        }
+        for( ; r < MR; r++ )
+            for( k = 0; k < kc; k++ )
+                dst[k*MR + r] = 0;
+    }
+}
+
+// packs op(B)[k0:k0+kc, j0:j0+nr] into the panel of NR columns, stored row by row
+template<typename T, int NR> static void
+GEMMPackB( const T* b, size_t b_step, bool is_b_t, int k0, int kc, int j0, int nr, T* dst )
+{
+    if( !is_b_t )
+    {
+        for( int k = 0; k < kc; k++, dst += NR )
+        {
+            const T* src = b + (k0 + k)*b_step + j0;
+            int j = 0;
+            for( ; j < nr; j++ )
+                dst[j] = src[j];
+            for( ; j < NR; j++ )
+                dst[j] = 0;
+        }
+    }
+    else
+    {
+        for( int j = 0; j < NR; j++ )
+        {
+            if( j < nr )
+            {
+                const T* src = b + (j0 + j)*b_step + k0;
+                for( int k = 0; k < kc; k++ )
+                    dst[k*NR + j] = src[k];
+            }
+            else
+            {
+                for( int k = 0; k < kc; k++ )
+                    dst[k*NR + j] = 0;
+            }
+        }
+    }
+}
+
+// computes MR x NR block of the product of the packed panels
+template<typename T> static inline void
+GEMMPackedKernel( const T* a, const T* b, int kc, T* out )
+{
+    typedef GEMMPackedVec<T> V;
+    typedef typename V::vtype vtype;
+    const int nlanes = V::nlanes, NR = nlanes*2;
+
+    vtype s00 = V::zero(), s01 = V::zero(), s10 = V::zero(), s11 = V::zero();
+    vtype s20 = V::zero(), s21 = V::zero(), s30 = V::zero(), s31 = V::zero();
+    for( int k = 0; k < kc; k++, a += GEMM_PACKED_MR, b += NR )
+    {
+        vtype b0 = vx_load(b), b1 = vx_load(b + nlanes);
+        vtype a0 = V::setall(a[0]);
+        s00 = v_fma(a0, b0, s00);
+        s01 = v_fma(a0, b1, s01);
+        a0 = V::setall(a[1]);
+        s10 = v_fma(a0, b0, s10);
+        s11 = v_fma(a0, b1, s11);
+        a0 = V::setall(a[2]);
+        s20 = v_fma(a0, b0, s20);
+        s21 = v_fma(a0, b1, s21);
+        a0 = V::setall(a[3]);
+        s30 = v_fma(a0, b0, s30);
+        s31 = v_fma(a0, b1, s31);
+    }
+    v_store(out, s00); v_store(out + nlanes, s01);
+    v_store(out + NR, s10); v_store(out + NR + nlanes, s11);
+    v_store(out + NR*2, s20); v_store(out + NR*2 + nlanes, s21);
+    v_store(out + NR*3, s30); v_store(out + NR*3 + nlanes, s31);
+}
+
+template<typename T> class GEMMPackBInvoker : public ParallelLoopBody
+{
+public:
+    enum { NR = GEMMPackedVec<T>::nlanes*2 };
+
+    GEMMPackBInvoker( const T* _b, size_t _b_step, bool _is_b_t, int _K, int _N, int _Npad, T* _bpack ) :
+        b(_b), b_step(_b_step), is_b_t(_is_b_t), K(_K), N(_N), Npad(_Npad), bpack(_bpack) {}
+
+    void operator()( const Range& range ) const CV_OVERRIDE
+    {
+        for( int p = range.start; p < range.end; p++ )
+        {
+            int j0 = p*NR, nr = std::min((int)NR, N - j0);
+            for( int k0 = 0; k0 < K; k0 += GEMM_PACKED_KC )
+            {
+                int kc = std::min((int)GEMM_PACKED_KC, K - k0);
+                GEMMPackB<T, NR>(b, b_step, is_b_t, k0, kc, j0, nr, bpack + (size_t)k0*Npad + (size_t)j0*kc);
+            }
+        }
+    }
+
+protected:
+    const T* b;
+    size_t b_step;
+    bool is_b_t;
+    int K, N, Npad;
+    T* bpack;
+};
+
+template<typename T> class GEMMPackedInvoker : public ParallelLoopBody
+{
+public:
+    enum { MR = GEMM_PACKED_MR, NR = GEMMPackedVec<T>::nlanes*2 };
+
+    GEMMPackedInvoker( const T* _a, size_t _a_step, bool _is_a_t, const T* _bpack, int _Npad,
+                       const T* _c, size_t _c_step, bool _is_c_t, T* _d, size_t _d_step,
+                       int _M, int _N, int _K, T _alpha, T _beta ) :
+        a(_a), a_step(_a_step), is_a_t(_is_a_t), bpack(_bpack), Npad(_Npad),
+        c(_c), c_step(_c_step), is_c_t(_is_c_t), d(_d), d_step(_d_step),
+        M(_M), N(_N), K(_K), alpha(_alpha), beta(_beta)
+    {
+        ntiles_n = (N + GEMM_PACKED_NC - 1)/GEMM_PACKED_NC;
+    }
+
+    int getTilesCount() const
+    {
+        return ((M + GEMM_PACKED_MC - 1)/GEMM_PACKED_MC)*ntiles_n;
+    }
+
+    void operator()( const Range& range ) const CV_OVERRIDE
+    {
+        AutoBuffer<T> abuf((size_t)GEMM_PACKED_MC*GEMM_PACKED_KC);
+        T* apack = abuf.data();
+        T CV_DECL_ALIGNED(CV_SIMD_WIDTH) out[MR*NR];
+
+        for( int t = range.start; t < range.end; t++ )
+        {
+            int i0 = (t / ntiles_n)*GEMM_PACKED_MC, j0 = (t % ntiles_n)*GEMM_PACKED_NC;
+            int mc = std::min((int)GEMM_PACKED_MC, M - i0), nc = std::min((int)GEMM_PACKED_NC, N - j0);
+
+            for( int k0 = 0; k0 < K; k0 += GEMM_PACKED_KC )
+            {
+                int kc = std::min((int)GEMM_PACKED_KC, K - k0);
+                GEMMPackA(a, a_step, is_a_t, i0, mc, k0, kc, apack);
+
+                for( int j = 0; j < nc; j += NR )
+                {
+                    const T* bp = bpack + (size_t)k0*Npad + (size_t)(j0 + j)*kc;
+                    int nr = std::min((int)NR, nc - j);
+                    for( int i = 0; i < mc; i += MR )
+                    {
+                        int mr = std::min((int)MR, mc - i);
+                        GEMMPackedKernel(apack + i*kc, bp, kc, out);
+                        storeBlock(out, i0 + i, j0 + j, mr, nr, k0 == 0);
+                    }
+                }
+            }
+        }
+    }
+
+protected:
+    void storeBlock( const T* out, int i, int j, int mr, int nr, bool first ) const
+    {
+        for( int r = 0; r < mr; r++, out += NR )
+        {
+            T* drow = d + (i + r)*d_step + j;
+            if( !first )
+            {
+                for( int k = 0; k < nr; k++ )
+                    drow[k] += alpha*out[k];
+            }
+            else if( !c )
+            {
+                for( int k = 0; k < nr; k++ )
+                    drow[k] = alpha*out[k];
+            }
+            else if( !is_c_t )
+            {
+                const T* crow = c + (i + r)*c_step + j;
+                for( int k = 0; k < nr; k++ )
+                    drow[k] = alpha*out[k] + beta*crow[k];
+            }
+            else
+            {
+                const T* ccol = c + j*c_step + i + r;
+                for( int k = 0; k < nr; k++ )
+                    drow[k] = alpha*out[k] + beta*ccol[k*c_step];
+            }
+        }
+    }
+
+    const T* a;
+    size_t a_step;
+    bool is_a_t;
+    const T* bpack;
+    int Npad;
+    const T* c;
+    size_t c_step;
+    bool is_c_t;
+    T* d;
+    size_t d_step;
+    int M, N, K, ntiles_n;
+    T alpha, beta;
+};
+
+template<typename T> static void
+gemmPacked( const Mat& A, const Mat& B, double alpha, const Mat& C, double beta, Mat& D, int len, int flags )
+{
+    CV_INSTRUMENT_REGION();
+
+    const int NR = GEMMPackedVec<T>::nlanes*2;
+    int M = D.rows, N = D.cols, K = len;
+    int npanels = (N + NR - 1)/NR, Npad = npanels*NR;
+
+    AutoBuffer<T> bbuf((size_t)K*Npad);
+    GEMMPackBInvoker<T> packB(B.ptr<T>(), B.step/sizeof(T), (flags & GEMM_2_T) != 0, K, N, Npad, bbuf.data());
+    parallel_for_(Range(0, npanels), packB, (double)K*Npad/(1 << 16));
+
+    GEMMPackedInvoker<T> invoker(A.ptr<T>(), A.step/sizeof(T), (flags & GEMM_1_T) != 0, bbuf.data(), Npad,
+                                 C.empty() ? 0 : C.ptr<T>(), C.empty() ? 0 : C.step/sizeof(T), (flags & GEMM_3_T) != 0,
+                                 D.ptr<T>(), D.step/sizeof(T), M, N, K, (T)alpha, (T)beta);
+    parallel_for_(Range(0, invoker.getTilesCount()), invoker);
+}
+
+#endif // CV_SIMD
+
 static void gemmImpl( Mat A, Mat B, double alpha,
            Mat C, double beta, Mat D, int flags )
 {
@@ -1033,6 +1333,19 @@ static void gemmImpl( Mat A, Mat B, double alpha,
         }
     }
 
+#if CV_SIMD
+    if( useGEMMPacked(type, d_size, len) )
+    {
+        if( type == CV_32FC1 )
+            gemmPacked<float>(A, B, alpha, C, beta, D, len, flags);
+#if CV_SIMD_64F
+        else
+            gemmPacked<double>(A, B, alpha, C, beta, D, len, flags);
+#endif
+        return;
+    }
+#endif
+
     {
     size_t b_step = B.step;
     GEMMSingleMulFunc singleMulFunc;
@@ -4,6 +4,7 @@
 
 #include "precomp.hpp"
 #include "bufferpool.impl.hpp"
+#include "opencv2/core/utils/configuration.private.hpp"
 
 namespace cv {
 
@@ -188,7 +189,8 @@ MatAllocator* Mat::getDefaultAllocator()
         cv::AutoLock lock(cv::getInitializationMutex());
         if (g_matAllocator == NULL)
         {
-            g_matAllocator = getStdAllocator();
+            static bool usePool = utils::getConfigurationParameterBool("OPENCV_MAT_POOL_ALLOCATOR", false);
+            g_matAllocator = usePool ? getPoolAllocator() : getStdAllocator();
         }
     }
     return g_matAllocator;
@@ -1361,4 +1363,34 @@ Size getContinuousSize2D(Mat& m1, Mat& m2, Mat& m3, int widthScale)
                               m1.cols, m1.rows, widthScale);
 }
 
+void parallel_for_elemwise(Size sz, size_t unitSize, const std::function<void(int, int, Size)>& body)
+{
+    // waking up the worker threads costs more than processing of the small arrays
+    static const size_t minParallelSize = utils::getConfigurationParameterSizeT("OPENCV_CORE_ELEMWISE_PARALLEL_MIN_BYTES", 1 << 20);
+    const size_t stripeSize = 1 << 18;
+
+    size_t total = (size_t)sz.width*sz.height*unitSize;
+    if( total < minParallelSize || sz.width <= 0 || sz.height <= 0 || getNumThreads() <= 1 )
+    {
+        body(0, 0, sz);
+        return;
+    }
+
+    double nstripes = (double)(total / stripeSize);
+    if( sz.height > 1 )
+    {
+        parallel_for_(Range(0, sz.height), [&](const Range& r)
+        {
+            body(0, r.start, Size(sz.width, r.end - r.start));
+        }, nstripes);
+    }
+    else
+    {
+        parallel_for_(Range(0, sz.width), [&](const Range& r)
+        {
+            body(r.start, 0, Size(r.end - r.start, 1));
+        }, nstripes);
+    }
+}
+
 } // cv::
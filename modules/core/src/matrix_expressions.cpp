@@ -11,6 +11,8 @@
 
 #include "precomp.hpp"
 #include <opencv2/core/utils/logger.hpp>
+#include "opencv2/core/utils/configuration.private.hpp"
+#include <map>
 
 namespace cv
 {
@@ -200,6 +202,40 @@ static MatOp_Initializer* getGlobalMatOpInitializer()
     CV_SINGLETON_LAZY_INIT(MatOp_Initializer, new MatOp_Initializer())
 }
 
+class MatExprFusedTree;
+
+class MatOp_Fused CV_FINAL : public MatOp
+{
+public:
+    MatOp_Fused() : lastKey(0) {}
+    virtual ~MatOp_Fused() {}
+
+    bool elementWise(const MatExpr& /*expr*/) const CV_OVERRIDE { return false; }
+    void assign(const MatExpr& expr, Mat& m, int type=-1) const CV_OVERRIDE;
+
+    void add(const MatExpr& e1, const Scalar& s, MatExpr& res) const CV_OVERRIDE;
+    void subtract(const Scalar& s, const MatExpr& expr, MatExpr& res) const CV_OVERRIDE;
+    void multiply(const MatExpr& e1, double s, MatExpr& res) const CV_OVERRIDE;
+    void divide(double s, const MatExpr& e, MatExpr& res) const CV_OVERRIDE;
+    void abs(const MatExpr& expr, MatExpr& res) const CV_OVERRIDE;
+
+    Size size(const MatExpr& expr) const CV_OVERRIDE;
+    int type(const MatExpr& expr) const CV_OVERRIDE;
+
+    // MatExpr has no room for the fused tree, so the trees are kept here. The operand c of the expression
+    // is 1x1 CV_32S matrix with the key of the tree, see makeFused()
+    int addTree(const Ptr<MatExprFusedTree>& tree) const;
+    void removeTree(int key) const;
+    const MatExprFusedTree& tree(const MatExpr& expr) const;
+
+protected:
+    mutable Mutex mutex;
+    mutable std::map<int, Ptr<MatExprFusedTree> > trees;
+    mutable int lastKey;
+};
+
+static MatOp_Fused g_MatOp_Fused;
+
 static inline bool isIdentity(const MatExpr& e) { return e.op == &g_MatOp_Identity; }
 static inline bool isAddEx(const MatExpr& e) { return e.op == &g_MatOp_AddEx; }
 static inline bool isScaled(const MatExpr& e) { return isAddEx(e) && (!e.b.data || e.beta == 0) && e.s == Scalar(); }
@@ -212,6 +248,109 @@ static inline bool isSolve(const MatExpr& e) { return e.op == &g_MatOp_Solve; }
 //static inline bool isGEMM(const MatExpr& e) { return e.op == &g_MatOp_GEMM; }
 static inline bool isMatProd(const MatExpr& e) { return e.op == &g_MatOp_GEMM && (!e.c.data || e.beta == 0); }
 static inline bool isInitializer(const MatExpr& e) { return e.op == getGlobalMatOpInitializer(); }
+static inline bool isFused(const MatExpr& e) { return e.op == &g_MatOp_Fused; }
+
+class MatExprFusedTree
+{
+public:
+    enum { OP_ARG = 0, OP_ADD, OP_MUL, OP_DIV, OP_RECIP, OP_ABSDIFF, OP_MIN, OP_MAX, OP_CMP };
+    enum { MAX_NODES = 64 };
+
+    struct Node
+    {
+        Node(int _op, int _depth, int _arg0, int _arg1 = -1, double _alpha = 1, double _beta = 0,
+             const Scalar& _s = Scalar(), int _cmpop = 0)
+            : op(_op), depth(_depth), arg0(_arg0), arg1(_arg1), alpha(_alpha), beta(_beta), s(_s), cmpop(_cmpop) {}
+
+        int op;
+        int depth;       // the result is saturated to this depth like the temporary matrix of the non-fused evaluation
+        int arg0, arg1;  // operand nodes; arg1 < 0 means the scalar operand s; for OP_ARG arg0 is the index in args
+        double alpha, beta;
+        Scalar s;        // per-channel values; the real scalar of OP_ADD is added to all the channels
+        int cmpop;
+    };
+
+    MatExprFusedTree() : sz(-1, -1), cn(0) {}
+
+    int addArg(const Mat& m);
+    int addExpr(const MatExpr& e);
+    int addNode(int op, int arg0, int arg1, double alpha = 1, double beta = 0, const Scalar& s = Scalar(), int cmpop = 0);
+
+    // the operands precede the nodes using them, the last node is the result
+    std::vector<Node> nodes;
+    std::vector<Mat> args;
+    Size sz;
+    int cn;
+};
+
+int MatOp_Fused::addTree(const Ptr<MatExprFusedTree>& t) const
+{
+    AutoLock lock(mutex);
+    int key = ++lastKey;
+    trees[key] = t;
+    return key;
+}
+
+void MatOp_Fused::removeTree(int key) const
+{
+    AutoLock lock(mutex);
+    trees.erase(key);
+}
+
+const MatExprFusedTree& MatOp_Fused::tree(const MatExpr& e) const
+{
+    CV_DbgAssert( isFused(e) );
+    AutoLock lock(mutex);
+    std::map<int, Ptr<MatExprFusedTree> >::const_iterator it = trees.find(e.c.at<int>(0));
+    CV_Assert( it != trees.end() );
+    return *it->second;  // the tree is not removed while the expression exists
+}
+
+// allocates the key of the fused tree, the tree is removed together with the last copy of the expression.
+// The copies of the key made by clone() or copyTo() do not own the tree.
+class MatExprFusedKeyAllocator CV_FINAL : public MatAllocator
+{
+public:
+    UMatData* allocate(int dims, const int* sizes, int type,
+                       void* data0, size_t* step, AccessFlag /*flags*/, UMatUsageFlags /*usageFlags*/) const CV_OVERRIDE
+    {
+        CV_Assert( !data0 && dims == 2 && sizes[0] == 1 && sizes[1] == 1 && type == CV_32S );
+        step[0] = step[1] = sizeof(int);
+        UMatData* u = new UMatData(this);
+        u->data = u->origdata = (uchar*)fastMalloc(sizeof(int));
+        u->size = sizeof(int);
+        *(int*)u->data = 0;
+        return u;
+    }
+
+    bool allocate(UMatData* u, AccessFlag /*accessFlags*/, UMatUsageFlags /*usageFlags*/) const CV_OVERRIDE
+    {
+        return u != NULL;
+    }
+
+    void deallocate(UMatData* u) const CV_OVERRIDE
+    {
+        if( !u )
+            return;
+        CV_Assert( u->urefcount == 0 && u->refcount == 0 );
+        g_MatOp_Fused.removeTree(*(const int*)u->origdata);
+        fastFree(u->origdata);
+        delete u;
+    }
+};
+
+static MatExprFusedKeyAllocator g_MatExprFusedKeyAllocator;
+
+static inline const MatExprFusedTree& fusedTree(const MatExpr& e)
+{
+    return g_MatOp_Fused.tree(e);
+}
+
+// The element-wise operations on the element-wise sub-expressions are combined into MatOp_Fused
+// expressions instead of evaluating the sub-expressions into the temporary matrices.
+static bool fuseAddSub(const MatExpr& e1, const MatExpr& e2, double sign, MatExpr& res);
+static bool fuseMulDiv(const MatExpr& e1, const MatExpr& e2, double scale, bool div, MatExpr& res);
+static bool fuseUnary(const MatExpr& e, int op, double alpha, const Scalar& s, MatExpr& res);
 
 /////////////////////////////////////////////////////////////////////////////////////////////////////
 
@@ -329,6 +468,9 @@ void MatOp::add(const MatExpr& e1, const MatExpr& e2, MatExpr& res) const
 
     if( this == e2.op )
     {
+        if( fuseAddSub(e1, e2, 1, res) )
+            return;
+
         double alpha = 1, beta = 1;
         Scalar s;
         Mat m1, m2;
@@ -360,6 +502,9 @@ void MatOp::add(const MatExpr& expr1, const Scalar& s, MatExpr& res) const
 {
     CV_INSTRUMENT_REGION();
 
+    if( fuseUnary(expr1, MatExprFusedTree::OP_ADD, 1, s, res) )
+        return;
+
     Mat m1;
     expr1.op->assign(expr1, m1);
     MatOp_AddEx::makeExpr(res, m1, Mat(), 1, 0, s);
@@ -372,6 +517,9 @@ void MatOp::subtract(const MatExpr& e1, const MatExpr& e2, MatExpr& res) const
 
     if( this == e2.op )
     {
+        if( fuseAddSub(e1, e2, -1, res) )
+            return;
+
         double alpha = 1, beta = -1;
         Scalar s;
         Mat m1, m2;
@@ -403,6 +551,9 @@ void MatOp::subtract(const Scalar& s, const MatExpr& expr, MatExpr& res) const
 {
     CV_INSTRUMENT_REGION();
 
+    if( fuseUnary(expr, MatExprFusedTree::OP_ADD, -1, s, res) )
+        return;
+
     Mat m;
     expr.op->assign(expr, m);
     MatOp_AddEx::makeExpr(res, m, Mat(), -1, 0, s);
@@ -415,6 +566,9 @@ void MatOp::multiply(const MatExpr& e1, const MatExpr& e2, MatExpr& res, double
 
     if( this == e2.op )
     {
+        if( fuseMulDiv(e1, e2, scale, false, res) )
+            return;
+
         Mat m1, m2;
 
         if( isReciprocal(e1) )
@@ -466,6 +620,9 @@ void MatOp::multiply(const MatExpr& expr, double s, MatExpr& res) const
 {
     CV_INSTRUMENT_REGION();
 
+    if( fuseUnary(expr, MatExprFusedTree::OP_ADD, s, Scalar(), res) )
+        return;
+
     Mat m;
     expr.op->assign(expr, m);
     MatOp_AddEx::makeExpr(res, m, Mat(), s, 0);
@@ -480,7 +637,7 @@ void MatOp::divide(const MatExpr& e1, const MatExpr& e2, MatExpr& res, double sc
     {
         if( isReciprocal(e1) && isReciprocal(e2) )
             MatOp_Bin::makeExpr(res, '/', e2.a, e1.a, e1.alpha/e2.alpha);
-        else
+        else if( !fuseMulDiv(e1, e2, scale, true, res) )
         {
             Mat m1, m2;
             char op = '/';
@@ -518,6 +675,9 @@ void MatOp::divide(double s, const MatExpr& expr, MatExpr& res) const
 {
     CV_INSTRUMENT_REGION();
 
+    if( fuseUnary(expr, MatExprFusedTree::OP_RECIP, s, Scalar(), res) )
+        return;
+
     Mat m;
     expr.op->assign(expr, m);
     MatOp_Bin::makeExpr(res, '/', m, Mat(), s);
@@ -528,6 +688,9 @@ void MatOp::abs(const MatExpr& expr, MatExpr& res) const
 {
     CV_INSTRUMENT_REGION();
 
+    if( fuseUnary(expr, MatExprFusedTree::OP_ABSDIFF, 1, Scalar(), res) )
+        return;
+
     Mat m;
     expr.op->assign(expr, m);
     MatOp_Bin::makeExpr(res, 'a', m, Mat());
@@ -1520,6 +1683,795 @@ inline void MatOp_Cmp::makeExpr(MatExpr& res, int cmpop, const Mat& a, double al
     res = MatExpr(&g_MatOp_Cmp, cmpop, a, Mat(), Mat(), alpha, 1);
 }
 
+/////////////////////////////////////////////////////////////////////////////////////////////////////
+
+static bool useFusedMatExpr()
+{
+    static bool param_fusion = utils::getConfigurationParameterBool("OPENCV_MATEXPR_FUSION", true);
+    return param_fusion;
+}
+
+static bool isFusable(const MatExpr& e)
+{
+    if( isFused(e) || isIdentity(e) || isAddEx(e) || isCmp(e) )
+        return true;
+    if( e.op != &g_MatOp_Bin )
+        return false;
+    switch( e.flags )
+    {
+    case '*': case '/': case 'm': case 'n': case 'M': case 'N': case 'a':
+        return true;
+    default:  // bitwise operations
+        return false;
+    }
+}
+
+int MatExprFusedTree::addArg(const Mat& m)
+{
+    if( m.empty() || m.dims > 2 || m.channels() > 4 || m.depth() == CV_16F )
+        return -1;
+    if( sz.width < 0 )
+    {
+        sz = m.size();
+        cn = m.channels();
+    }
+    else if( m.size() != sz || m.channels() != cn )
+        return -1;
+
+    for( size_t i = 0; i < nodes.size(); i++ )
+    {
+        const Node& n = nodes[i];
+        if( n.op == OP_ARG && args[n.arg0].data == m.data &&
+            args[n.arg0].step[0] == m.step[0] && args[n.arg0].type() == m.type() )
+            return (int)i;
+    }
+    args.push_back(m);
+    nodes.push_back(Node(OP_ARG, m.depth(), (int)args.size() - 1));
+    return (int)nodes.size() - 1;
+}
+
+int MatExprFusedTree::addNode(int op, int arg0, int arg1, double alpha, double beta, const Scalar& s, int cmpop)
+{
+    if( arg0 < 0 || nodes.size() >= (size_t)MAX_NODES )
+        return -1;
+    int depth = nodes[arg0].depth;
+    if( arg1 >= 0 && nodes[arg1].depth != depth )
+        return -1;  // mixed types are handled (and reported) by the regular operations
+    nodes.push_back(Node(op, op == OP_CMP ? CV_8U : depth, arg0, arg1, alpha, beta, s, cmpop));
+    return (int)nodes.size() - 1;
+}
+
+int MatExprFusedTree::addExpr(const MatExpr& e)
+{
+    if( isFused(e) )
+    {
+        const MatExprFusedTree& t = fusedTree(e);
+        std::vector<int> idx(t.nodes.size(), -1);
+        for( size_t i = 0; i < t.nodes.size(); i++ )
+        {
+            const Node& n = t.nodes[i];
+            idx[i] = n.op == OP_ARG ? addArg(t.args[n.arg0]) :
+                addNode(n.op, idx[n.arg0], n.arg1 >= 0 ? idx[n.arg1] : -1, n.alpha, n.beta, n.s, n.cmpop);
+            if( idx[i] < 0 )
+                return -1;
+        }
+        return idx.back();
+    }
+
+    int i0 = addArg(e.a), i1 = -1;
+    if( i0 < 0 || (e.b.data && (i1 = addArg(e.b)) < 0) )
+        return -1;
+    if( isIdentity(e) )
+        return i0;
+    if( isAddEx(e) )
+        return addNode(OP_ADD, i0, i1, e.alpha, e.beta, e.s);
+    if( isCmp(e) )
+        return addNode(OP_CMP, i0, i1, 1, 0, Scalar::all(e.alpha), e.flags);
+
+    switch( e.flags )
+    {
+    case '*': return addNode(OP_MUL, i0, i1, e.alpha);
+    case '/': return addNode(i1 >= 0 ? OP_DIV : OP_RECIP, i0, i1, e.alpha);
+    case 'm': case 'n': return addNode(OP_MIN, i0, i1, 1, 0, Scalar::all(e.s[0]));
+    case 'M': case 'N': return addNode(OP_MAX, i0, i1, 1, 0, Scalar::all(e.s[0]));
+    case 'a': return addNode(OP_ABSDIFF, i0, i1, 1, 0, e.s);
+    default: return -1;
+    }
+}
+
+// moves the tree into the new MatOp_Fused expression
+static bool makeFused(MatExprFusedTree& t, int root, MatExpr& res)
+{
+    if( root < 0 )
+        return false;
+    CV_DbgAssert( root == (int)t.nodes.size() - 1 );
+    Ptr<MatExprFusedTree> dst = makePtr<MatExprFusedTree>();
+    dst->nodes.swap(t.nodes);
+    dst->args.swap(t.args);
+    dst->sz = t.sz;
+    dst->cn = t.cn;
+    Mat key;
+    key.allocator = &g_MatExprFusedKeyAllocator;
+    key.create(1, 1, CV_32S);
+    key.at<int>(0) = g_MatOp_Fused.addTree(dst);
+    res = MatExpr(&g_MatOp_Fused, 0, Mat(), Mat(), key, 1, 0);
+    return true;
+}
+
+static bool fuseAddSub(const MatExpr& e1, const MatExpr& e2, double sign, MatExpr& res)
+{
+    bool scaled1 = isAddEx(e1) && (!e1.b.data || e1.beta == 0);
+    bool scaled2 = isAddEx(e2) && (!e2.b.data || e2.beta == 0);
+    // MatOp_AddEx handles these ones without the temporary matrices
+    if( ((isIdentity(e1) || scaled1) && (isIdentity(e2) || scaled2)) ||
+        !isFusable(e1) || !isFusable(e2) || !useFusedMatExpr() )
+        return false;
+
+    MatExprFusedTree t;
+    double alpha = 1, beta = sign;
+    Scalar s;
+    int i1 = scaled1 ? t.addArg(e1.a) : t.addExpr(e1);
+    if( scaled1 )
+    {
+        alpha = e1.alpha;
+        s = e1.s;
+    }
+    int i2 = i1 < 0 ? -1 : scaled2 ? t.addArg(e2.a) : t.addExpr(e2);
+    if( scaled2 )
+    {
+        beta = sign*e2.alpha;
+        s += e2.s*sign;
+    }
+    return i2 >= 0 && makeFused(t, t.addNode(MatExprFusedTree::OP_ADD, i1, i2, alpha, beta, s), res);
+}
+
+static bool fuseMulDiv(const MatExpr& e1, const MatExpr& e2, double scale, bool div, MatExpr& res)
+{
+    // MatOp_Bin handles these ones without the temporary matrices
+    if( ((isIdentity(e1) || isScaled(e1) || isReciprocal(e1)) && (isIdentity(e2) || isScaled(e2) || isReciprocal(e2))) ||
+        !isFusable(e1) || !isFusable(e2) || !useFusedMatExpr() )
+        return false;
+
+    const MatExpr *pe1 = &e1, *pe2 = &e2;
+    if( !div && isReciprocal(e1) )
+        std::swap(pe1, pe2);  // (alpha/a)*e2 is evaluated as alpha*e2/a
+
+    MatExprFusedTree t;
+    int op = div ? MatExprFusedTree::OP_DIV : MatExprFusedTree::OP_MUL;
+    int i1 = -1, i2 = -1;
+    if( isScaled(*pe1) )
+    {
+        i1 = t.addArg(pe1->a);
+        scale *= pe1->alpha;
+    }
+    else
+        i1 = t.addExpr(*pe1);
+
+    if( i1 < 0 )
+        return false;
+    if( isScaled(*pe2) || isReciprocal(*pe2) )
+    {
+        i2 = t.addArg(pe2->a);
+        scale = div ? scale/pe2->alpha : scale*pe2->alpha;
+        if( isReciprocal(*pe2) )
+            op = div ? MatExprFusedTree::OP_MUL : MatExprFusedTree::OP_DIV;
+    }
+    else
+        i2 = t.addExpr(*pe2);
+    return i2 >= 0 && makeFused(t, t.addNode(op, i1, i2, scale), res);
+}
+
+static bool fuseUnary(const MatExpr& e, int op, double alpha, const Scalar& s, MatExpr& res)
+{
+    if( isIdentity(e) || !isFusable(e) || !useFusedMatExpr() )
+        return false;
+
+    MatExprFusedTree t;
+    int i = t.addExpr(e);
+    return i >= 0 && makeFused(t, t.addNode(op, i, -1, alpha, 0, s), res);
+}
+
+#if CV_SIMD
+// universal intrinsics on the intermediate results, the WT-specific helpers are overloaded for float and double
+
+static inline v_float32 vx_setall_fused(float v) { return vx_setall_f32(v); }
+static inline v_float32 v_round_fused(const v_float32& v) { return v_cvt_f32(v_round(v)); }
+static inline v_int32 vx_load_round_fused(const float* p) { return v_round(vx_load(p)); }
+static inline void v_store_fused(float* p, const v_int32& v) { v_store(p, v_cvt_f32(v)); }
+#if CV_SIMD_64F
+static inline v_float64 vx_setall_fused(double v) { return vx_setall_f64(v); }
+static inline v_float64 v_round_fused(const v_float64& v) { return v_cvt_f64(v_round(v)); }
+static inline v_int32 vx_load_round_fused(const double* p) { return v_round(vx_load(p), vx_load(p + v_float64::nlanes)); }
+static inline void v_store_fused(double* p, const v_int32& v)
+{
+    v_store(p, v_cvt_f64(v));
+    v_store(p + v_float64::nlanes, v_cvt_f64_high(v));
+}
+#endif
+
+static inline v_int32 vx_load_s32_fused(const uchar* p) { return v_reinterpret_as_s32(vx_load_expand_q(p)); }
+static inline v_int32 vx_load_s32_fused(const schar* p) { return vx_load_expand_q(p); }
+static inline v_int32 vx_load_s32_fused(const ushort* p) { return v_reinterpret_as_s32(vx_load_expand(p)); }
+static inline v_int32 vx_load_s32_fused(const short* p) { return vx_load_expand(p); }
+static inline v_int32 vx_load_s32_fused(const int* p) { return vx_load(p); }
+
+template<typename T, typename WT> static int loadFusedSIMD_(const uchar* src, WT* dst, int n)
+{
+    const T* s = (const T*)src;
+    int i = 0;
+    for( ; i <= n - v_int32::nlanes; i += v_int32::nlanes )
+        v_store_fused(dst + i, vx_load_s32_fused(s + i));
+    return i;
+}
+
+template<typename WT> static int loadFusedSIMD_(const uchar* src, int depth, WT* dst, int n)
+{
+    switch( depth )
+    {
+    case CV_8U: return loadFusedSIMD_<uchar>(src, dst, n);
+    case CV_8S: return loadFusedSIMD_<schar>(src, dst, n);
+    case CV_16U: return loadFusedSIMD_<ushort>(src, dst, n);
+    case CV_16S: return loadFusedSIMD_<short>(src, dst, n);
+    case CV_32S: return loadFusedSIMD_<int>(src, dst, n);
+    default: return 0;
+    }
+}
+
+template<typename WT> static int storeFusedSIMD_(const WT* src, uchar* dst, int depth, int n)
+{
+    const int VECSZ = v_int32::nlanes;
+    int i = 0;
+    switch( depth )
+    {
+    case CV_8U:
+        for( ; i <= n - VECSZ*4; i += VECSZ*4 )
+            v_store(dst + i, v_pack_u(v_pack(vx_load_round_fused(src + i), vx_load_round_fused(src + i + VECSZ)),
+                                      v_pack(vx_load_round_fused(src + i + VECSZ*2), vx_load_round_fused(src + i + VECSZ*3))));
+        break;
+    case CV_8S:
+        for( ; i <= n - VECSZ*4; i += VECSZ*4 )
+            v_store((schar*)dst + i, v_pack(v_pack(vx_load_round_fused(src + i), vx_load_round_fused(src + i + VECSZ)),
+                                            v_pack(vx_load_round_fused(src + i + VECSZ*2), vx_load_round_fused(src + i + VECSZ*3))));
+        break;
+    case CV_16U:
+        for( ; i <= n - VECSZ*2; i += VECSZ*2 )
+            v_store((ushort*)dst + i, v_pack_u(vx_load_round_fused(src + i), vx_load_round_fused(src + i + VECSZ)));
+        break;
+    case CV_16S:
+        for( ; i <= n - VECSZ*2; i += VECSZ*2 )
+            v_store((short*)dst + i, v_pack(vx_load_round_fused(src + i), vx_load_round_fused(src + i + VECSZ)));
+        break;
+    case CV_32S:
+        for( ; i <= n - VECSZ; i += VECSZ )
+            v_store((int*)dst + i, vx_load_round_fused(src + i));
+        break;
+    default:
+        break;
+    }
+    return i;
+}
+
+template<typename WT> static int saturateFusedSIMD_(WT* buf, int n, WT lo, WT hi)
+{
+    typedef decltype(vx_load(buf)) VT;
+    VT v_lo = vx_setall_fused(lo), v_hi = vx_setall_fused(hi);
+    int i = 0;
+    for( ; i <= n - VT::nlanes; i += VT::nlanes )
+        v_store(buf + i, v_round_fused(v_min(v_max(vx_load(buf + i), v_lo), v_hi)));
+    return i;
+}
+
+// the same order of the operations as in the scalar code of evaluateFused()
+template<typename WT> static int evaluateFusedNodeSIMD_(const MatExprFusedTree::Node& nd,
+                                                        const WT* a, const WT* b, const WT* s, WT* r, int n)
+{
+    typedef decltype(vx_load(a)) VT;
+    const int VECSZ = VT::nlanes;
+    VT v_alpha = vx_setall_fused((WT)nd.alpha), v_beta = vx_setall_fused((WT)nd.beta);
+    VT v_zero = vx_setall_fused((WT)0), v_255 = vx_setall_fused((WT)255);
+    bool isInt = nd.depth < CV_32F;
+    int k = 0;
+    switch( nd.op )
+    {
+    case MatExprFusedTree::OP_ADD:
+        if( nd.arg1 >= 0 )
+            for( ; k <= n - VECSZ; k += VECSZ )
+                v_store(r + k, vx_load(a + k)*v_alpha + vx_load(b + k)*v_beta + vx_load(s + k));
+        else
+            for( ; k <= n - VECSZ; k += VECSZ )
+                v_store(r + k, vx_load(a + k)*v_alpha + vx_load(s + k));
+        break;
+    case MatExprFusedTree::OP_MUL:
+        for( ; k <= n - VECSZ; k += VECSZ )
+            v_store(r + k, vx_load(a + k)*vx_load(b + k)*v_alpha);
+        break;
+    case MatExprFusedTree::OP_DIV:
+        for( ; k <= n - VECSZ; k += VECSZ )
+        {
+            VT vb = vx_load(b + k), v = vx_load(a + k)*v_alpha/vb;
+            v_store(r + k, isInt ? v_select(vb == v_zero, v_zero, v) : v);
+        }
+        break;
+    case MatExprFusedTree::OP_RECIP:
+        for( ; k <= n - VECSZ; k += VECSZ )
+        {
+            VT va = vx_load(a + k), v = v_alpha/va;
+            v_store(r + k, isInt ? v_select(va == v_zero, v_zero, v) : v);
+        }
+        break;
+    case MatExprFusedTree::OP_ABSDIFF:
+        for( ; k <= n - VECSZ; k += VECSZ )
+            v_store(r + k, v_abs(vx_load(a + k) - vx_load(b + k)));
+        break;
+    case MatExprFusedTree::OP_MIN:
+        for( ; k <= n - VECSZ; k += VECSZ )
+            v_store(r + k, v_min(vx_load(a + k), vx_load(b + k)));
+        break;
+    case MatExprFusedTree::OP_MAX:
+        for( ; k <= n - VECSZ; k += VECSZ )
+            v_store(r + k, v_max(vx_load(a + k), vx_load(b + k)));
+        break;
+    case MatExprFusedTree::OP_CMP:
+        for( ; k <= n - VECSZ; k += VECSZ )
+        {
+            VT va = vx_load(a + k), vb = vx_load(b + k);
+            VT f = nd.cmpop == CMP_EQ ? va == vb : nd.cmpop == CMP_NE ? va != vb :
+                   nd.cmpop == CMP_LT ? va < vb : nd.cmpop == CMP_LE ? va <= vb :
+                   nd.cmpop == CMP_GT ? va > vb : va >= vb;
+            v_store(r + k, v_select(f, v_255, v_zero));
+        }
+        break;
+    default:
+        break;
+    }
+    return k;
+}
+#endif
+
+// the vectorized parts return the number of the processed elements, the rest is done by the scalar code
+
+static inline int loadFusedSIMD(const uchar* src, int depth, float* dst, int n)
+{
+#if CV_SIMD
+    return loadFusedSIMD_(src, depth, dst, n);
+#else
+    CV_UNUSED(src); CV_UNUSED(depth); CV_UNUSED(dst); CV_UNUSED(n);
+    return 0;
+#endif
+}
+
+static inline int loadFusedSIMD(const uchar* src, int depth, double* dst, int n)
+{
+#if CV_SIMD_64F
+    if( depth == CV_32F )
+    {
+        const float* s = (const float*)src;
+        int i = 0;
+        for( ; i <= n - v_float32::nlanes; i += v_float32::nlanes )
+        {
+            v_float32 v = vx_load(s + i);
+            v_store(dst + i, v_cvt_f64(v));
+            v_store(dst + i + v_float64::nlanes, v_cvt_f64_high(v));
+        }
+        return i;
+    }
+    return loadFusedSIMD_(src, depth, dst, n);
+#else
+    CV_UNUSED(src); CV_UNUSED(depth); CV_UNUSED(dst); CV_UNUSED(n);
+    return 0;
+#endif
+}
+
+static inline int storeFusedSIMD(const float* src, uchar* dst, int depth, int n)
+{
+#if CV_SIMD
+    if( depth == CV_32F )
+    {
+        int i = 0;
+        for( ; i <= n - v_float32::nlanes; i += v_float32::nlanes )
+            v_store((float*)dst + i, vx_load(src + i));
+        return i;
+    }
+    return storeFusedSIMD_(src, dst, depth, n);
+#else
+    CV_UNUSED(src); CV_UNUSED(dst); CV_UNUSED(depth); CV_UNUSED(n);
+    return 0;
+#endif
+}
+
+static inline int storeFusedSIMD(const double* src, uchar* dst, int depth, int n)
+{
+#if CV_SIMD_64F
+    int i = 0;
+    if( depth == CV_64F )
+    {
+        for( ; i <= n - v_float64::nlanes; i += v_float64::nlanes )
+            v_store((double*)dst + i, vx_load(src + i));
+        return i;
+    }
+    if( depth == CV_32F )
+    {
+        for( ; i <= n - v_float32::nlanes; i += v_float32::nlanes )
+            v_store((float*)dst + i, v_cvt_f32(vx_load(src + i), vx_load(src + i + v_float64::nlanes)));
+        return i;
+    }
+    return storeFusedSIMD_(src, dst, depth, n);
+#else
+    CV_UNUSED(src); CV_UNUSED(dst); CV_UNUSED(depth); CV_UNUSED(n);
+    return 0;
+#endif
+}
+
+static inline int saturateFusedSIMD(float* buf, int n, float lo, float hi)
+{
+#if CV_SIMD
+    return saturateFusedSIMD_(buf, n, lo, hi);
+#else
+    CV_UNUSED(buf); CV_UNUSED(n); CV_UNUSED(lo); CV_UNUSED(hi);
+    return 0;
+#endif
+}
+
+static inline int saturateFusedSIMD(double* buf, int n, double lo, double hi)
+{
+#if CV_SIMD_64F
+    return saturateFusedSIMD_(buf, n, lo, hi);
+#else
+    CV_UNUSED(buf); CV_UNUSED(n); CV_UNUSED(lo); CV_UNUSED(hi);
+    return 0;
+#endif
+}
+
+// rounds the double results to float like they are stored into the float matrix
+static inline int roundFusedSIMD(double* buf, int n)
+{
+#if CV_SIMD_64F
+    int i = 0;
+    for( ; i <= n - v_float64::nlanes; i += v_float64::nlanes )
+        v_store(buf + i, v_cvt_f64(v_cvt_f32(vx_load(buf + i))));
+    return i;
+#else
+    CV_UNUSED(buf); CV_UNUSED(n);
+    return 0;
+#endif
+}
+
+static inline int roundFusedSIMD(float*, int) { return 0; }
+
+static inline int evaluateFusedNodeSIMD(const MatExprFusedTree::Node& nd,
+                                        const float* a, const float* b, const float* s, float* r, int n)
+{
+#if CV_SIMD
+    return evaluateFusedNodeSIMD_(nd, a, b, s, r, n);
+#else
+    CV_UNUSED(nd); CV_UNUSED(a); CV_UNUSED(b); CV_UNUSED(s); CV_UNUSED(r); CV_UNUSED(n);
+    return 0;
+#endif
+}
+
+static inline int evaluateFusedNodeSIMD(const MatExprFusedTree::Node& nd,
+                                        const double* a, const double* b, const double* s, double* r, int n)
+{
+#if CV_SIMD_64F
+    return evaluateFusedNodeSIMD_(nd, a, b, s, r, n);
+#else
+    CV_UNUSED(nd); CV_UNUSED(a); CV_UNUSED(b); CV_UNUSED(s); CV_UNUSED(r); CV_UNUSED(n);
+    return 0;
+#endif
+}
+
+template<typename T, typename WT> static void loadFused_(const uchar* src, WT* dst, int i, int n)
+{
+    const T* s = (const T*)src;
+    for( ; i < n; i++ )
+        dst[i] = (WT)s[i];
+}
+
+template<typename WT> static void loadFused(const uchar* src, int depth, WT* dst, int n)
+{
+    int i = loadFusedSIMD(src, depth, dst, n);
+    switch( depth )
+    {
+    case CV_8U: loadFused_<uchar>(src, dst, i, n); break;
+    case CV_8S: loadFused_<schar>(src, dst, i, n); break;
+    case CV_16U: loadFused_<ushort>(src, dst, i, n); break;
+    case CV_16S: loadFused_<short>(src, dst, i, n); break;
+    case CV_32S: loadFused_<int>(src, dst, i, n); break;
+    case CV_32F: loadFused_<float>(src, dst, i, n); break;
+    case CV_64F: loadFused_<double>(src, dst, i, n); break;
+    default: CV_Error(Error::StsUnsupportedFormat, "");
+    }
+}
+
+template<typename T, typename WT> static void storeFused_(const WT* src, uchar* dst, int i, int n)
+{
+    T* d = (T*)dst;
+    for( ; i < n; i++ )
+        d[i] = saturate_cast<T>(src[i]);
+}
+
+template<typename WT> static void storeFused(const WT* src, uchar* dst, int depth, int n)
+{
+    int i = storeFusedSIMD(src, dst, depth, n);
+    switch( depth )
+    {
+    case CV_8U: storeFused_<uchar>(src, dst, i, n); break;
+    case CV_8S: storeFused_<schar>(src, dst, i, n); break;
+    case CV_16U: storeFused_<ushort>(src, dst, i, n); break;
+    case CV_16S: storeFused_<short>(src, dst, i, n); break;
+    case CV_32S: storeFused_<int>(src, dst, i, n); break;
+    case CV_32F: storeFused_<float>(src, dst, i, n); break;
+    case CV_64F: storeFused_<double>(src, dst, i, n); break;
+    default: CV_Error(Error::StsUnsupportedFormat, "");
+    }
+}
+
+// rounds and saturates the intermediate results like they are stored into the matrix of the given depth
+template<typename WT> static void saturateFused(WT* buf, int n, int depth)
+{
+    static const double lo[] = { 0, SCHAR_MIN, 0, SHRT_MIN, INT_MIN };
+    static const double hi[] = { UCHAR_MAX, SCHAR_MAX, USHRT_MAX, SHRT_MAX, INT_MAX };
+
+    if( depth == CV_64F || (depth == CV_32F && DataType<WT>::depth == CV_32F) )
+        return;
+    if( depth == CV_32F )
+    {
+        for( int i = roundFusedSIMD(buf, n); i < n; i++ )
+            buf[i] = (WT)(float)buf[i];
+        return;
+    }
+    WT v_lo = (WT)lo[depth], v_hi = (WT)hi[depth];
+    int i = saturateFusedSIMD(buf, n, v_lo, v_hi);
+    for( ; i < n; i++ )
+        buf[i] = (WT)cvRound(std::min(std::max(buf[i], v_lo), v_hi));
+}
+
+template<typename WT> static void evaluateFused(const MatExprFusedTree& t, Mat& dst)
+{
+    typedef MatExprFusedTree::Node Node;
+    const int BLOCK_SIZE = 256;
+    const int nnodes = (int)t.nodes.size(), cn = t.cn;
+    const int patSize = BLOCK_SIZE + cn;
+
+    bool continuous = dst.isContinuous();
+    size_t unitSize = dst.elemSize1();
+    for( size_t k = 0; k < t.args.size(); k++ )
+    {
+        continuous = continuous && t.args[k].isContinuous();
+        unitSize = std::max(unitSize, t.args[k].elemSize1());
+    }
+    Size sz = continuous ? Size((int)dst.total()*cn, 1) : Size(dst.cols*cn, dst.rows);
+
+    parallel_for_elemwise(sz, unitSize, [&](int x0, int y0, Size bsz)
+    {
+        AutoBuffer<WT> _buf(nnodes*(BLOCK_SIZE + patSize));
+        AutoBuffer<const WT*> _ptrs(nnodes);
+        WT* buf = _buf.data();
+        WT* pats = buf + nnodes*BLOCK_SIZE;
+        const WT** ptrs = _ptrs.data();
+
+        // the scalar operands are expanded over the channels,
+        // a block starting from the channel c uses the pattern from the offset c
+        for( int i = 0; i < nnodes; i++ )
+        {
+            const Node& nd = t.nodes[i];
+            // the real scalar is added to all the channels, see MatOp_AddEx::assign()
+            Scalar s = nd.op == MatExprFusedTree::OP_ADD && nd.s.isReal() ? Scalar::all(nd.s[0]) : nd.s;
+            for( int k = 0; k < patSize; k++ )
+                pats[i*patSize + k] = (WT)s[k % cn];
+        }
+
+        for( int y = y0; y < y0 + bsz.height; y++ )
+        {
+            for( int x = x0; x < x0 + bsz.width; x += BLOCK_SIZE )
+            {
+                int n = std::min(BLOCK_SIZE, x0 + bsz.width - x);
+                for( int i = 0; i < nnodes; i++ )
+                {
+                    const Node& nd = t.nodes[i];
+                    WT* r = buf + i*BLOCK_SIZE;
+                    if( nd.op == MatExprFusedTree::OP_ARG )
+                    {
+                        const Mat& m = t.args[nd.arg0];
+                        const uchar* src = m.ptr(y) + x*m.elemSize1();
+                        if( m.depth() == DataType<WT>::depth )
+                            ptrs[i] = (const WT*)src;
+                        else
+                        {
+                            loadFused(src, m.depth(), r, n);
+                            ptrs[i] = r;
+                        }
+                        continue;
+                    }
+
+                    const WT* a = ptrs[nd.arg0];
+                    const WT* s = pats + i*patSize + x % cn;
+                    const WT* b = nd.arg1 >= 0 ? ptrs[nd.arg1] : s;
+                    WT alpha = (WT)nd.alpha, beta = (WT)nd.beta;
+                    bool isInt = nd.depth < CV_32F;
+                    int k = evaluateFusedNodeSIMD(nd, a, b, s, r, n);
+                    switch( nd.op )
+                    {
+                    case MatExprFusedTree::OP_ADD:
+                        if( nd.arg1 >= 0 )
+                            for( ; k < n; k++ )
+                                r[k] = a[k]*alpha + b[k]*beta + s[k];
+                        else
+                            for( ; k < n; k++ )
+                                r[k] = a[k]*alpha + s[k];
+                        break;
+                    case MatExprFusedTree::OP_MUL:
+                        for( ; k < n; k++ )
+                            r[k] = a[k]*b[k]*alpha;
+                        break;
+                    case MatExprFusedTree::OP_DIV:
+                        for( ; k < n; k++ )
+                            r[k] = !isInt || b[k] != 0 ? a[k]*alpha/b[k] : 0;
+                        break;
+                    case MatExprFusedTree::OP_RECIP:
+                        for( ; k < n; k++ )
+                            r[k] = !isInt || a[k] != 0 ? alpha/a[k] : 0;
+                        break;
+                    case MatExprFusedTree::OP_ABSDIFF:
+                        for( ; k < n; k++ )
+                            r[k] = std::abs(a[k] - b[k]);
+                        break;
+                    case MatExprFusedTree::OP_MIN:
+                        for( ; k < n; k++ )
+                            r[k] = std::min(a[k], b[k]);
+                        break;
+                    case MatExprFusedTree::OP_MAX:
+                        for( ; k < n; k++ )
+                            r[k] = std::max(a[k], b[k]);
+                        break;
+                    case MatExprFusedTree::OP_CMP:
+                        for( ; k < n; k++ )
+                        {
+                            bool f = nd.cmpop == CMP_EQ ? a[k] == b[k] : nd.cmpop == CMP_NE ? a[k] != b[k] :
+                                     nd.cmpop == CMP_LT ? a[k] < b[k] : nd.cmpop == CMP_LE ? a[k] <= b[k] :
+                                     nd.cmpop == CMP_GT ? a[k] > b[k] : a[k] >= b[k];
+                            r[k] = f ? (WT)255 : (WT)0;
+                        }
+                        break;
+                    default:
+                        CV_Error(Error::StsInternal, "");
+                    }
+                    if( nd.op != MatExprFusedTree::OP_CMP )
+                        saturateFused(r, n, nd.depth);
+                    ptrs[i] = r;
+                }
+                storeFused(ptrs[nnodes - 1], dst.ptr(y) + x*dst.elemSize1(), dst.depth(), n);
+            }
+        }
+    });
+}
+
+void MatOp_Fused::assign(const MatExpr& e, Mat& m, int _type) const
+{
+    CV_INSTRUMENT_REGION();
+
+    const MatExprFusedTree& t = fusedTree(e);
+    int rtype = type(e);
+    Mat temp, &dst = _type == -1 || _type == rtype ? m : temp;
+    dst.create(t.sz, rtype);
+
+    // float is enough for the intermediate results of up to 16-bit integers
+    bool useDouble = false;
+    for( size_t i = 0; i < t.nodes.size(); i++ )
+        useDouble = useDouble || t.nodes[i].depth == CV_32S || t.nodes[i].depth == CV_64F;
+    if( useDouble )
+        evaluateFused<double>(t, dst);
+    else
+        evaluateFused<float>(t, dst);
+
+    if( dst.data != m.data )
+        dst.convertTo(m, _type);
+}
+
+// The scalar operations on the fused expressions are folded into the last node like MatOp_AddEx and MatOp_Bin do.
+// Besides saving the extra pass, it keeps the rounding of the intermediate results the same as without the fusion.
+
+void MatOp_Fused::add(const MatExpr& e, const Scalar& s, MatExpr& res) const
+{
+    CV_INSTRUMENT_REGION();
+
+    if( fusedTree(e).nodes.back().op != MatExprFusedTree::OP_ADD )
+    {
+        MatOp::add(e, s, res);
+        return;
+    }
+    MatExprFusedTree t(fusedTree(e));
+    t.nodes.back().s += s;
+    makeFused(t, (int)t.nodes.size() - 1, res);
+}
+
+void MatOp_Fused::subtract(const Scalar& s, const MatExpr& e, MatExpr& res) const
+{
+    CV_INSTRUMENT_REGION();
+
+    if( fusedTree(e).nodes.back().op != MatExprFusedTree::OP_ADD )
+    {
+        MatOp::subtract(s, e, res);
+        return;
+    }
+    MatExprFusedTree t(fusedTree(e));
+    MatExprFusedTree::Node& root = t.nodes.back();
+    root.alpha = -root.alpha;
+    root.beta = -root.beta;
+    root.s = s - root.s;
+    makeFused(t, (int)t.nodes.size() - 1, res);
+}
+
+void MatOp_Fused::multiply(const MatExpr& e, double s, MatExpr& res) const
+{
+    CV_INSTRUMENT_REGION();
+
+    int op = fusedTree(e).nodes.back().op;
+    if( op != MatExprFusedTree::OP_ADD && op != MatExprFusedTree::OP_MUL &&
+        op != MatExprFusedTree::OP_DIV && op != MatExprFusedTree::OP_RECIP )
+    {
+        MatOp::multiply(e, s, res);
+        return;
+    }
+    MatExprFusedTree t(fusedTree(e));
+    MatExprFusedTree::Node& root = t.nodes.back();
+    root.alpha *= s;
+    if( op == MatExprFusedTree::OP_ADD )
+    {
+        root.beta *= s;
+        root.s *= s;
+    }
+    makeFused(t, (int)t.nodes.size() - 1, res);
+}
+
+void MatOp_Fused::divide(double s, const MatExpr& e, MatExpr& res) const
+{
+    CV_INSTRUMENT_REGION();
+
+    const MatExprFusedTree::Node& last = fusedTree(e).nodes.back();
+    bool scaled = last.op == MatExprFusedTree::OP_ADD && last.arg1 < 0 && last.s == Scalar();
+    if( !scaled && last.op != MatExprFusedTree::OP_RECIP )
+    {
+        MatOp::divide(s, e, res);
+        return;
+    }
+    MatExprFusedTree t(fusedTree(e));
+    MatExprFusedTree::Node& root = t.nodes.back();
+    root.op = scaled ? MatExprFusedTree::OP_RECIP : MatExprFusedTree::OP_ADD;
+    root.alpha = s/root.alpha;
+    makeFused(t, (int)t.nodes.size() - 1, res);
+}
+
+void MatOp_Fused::abs(const MatExpr& e, MatExpr& res) const
+{
+    CV_INSTRUMENT_REGION();
+
+    const MatExprFusedTree::Node& last = fusedTree(e).nodes.back();
+    bool scaled = last.arg1 < 0 && fabs(last.alpha) == 1;
+    bool diff = last.arg1 >= 0 && last.alpha + last.beta == 0 && last.alpha*last.beta == -1 && last.s == Scalar();
+    if( last.op != MatExprFusedTree::OP_ADD || (!scaled && !diff) )
+    {
+        MatOp::abs(e, res);
+        return;
+    }
+    MatExprFusedTree t(fusedTree(e));
+    MatExprFusedTree::Node& root = t.nodes.back();
+    root.op = MatExprFusedTree::OP_ABSDIFF;
+    root.s = -root.s*root.alpha;
+    root.alpha = 1;
+    makeFused(t, (int)t.nodes.size() - 1, res);
+}
+
+Size MatOp_Fused::size(const MatExpr& e) const
+{
+    return fusedTree(e).sz;
+}
+
+int MatOp_Fused::type(const MatExpr& e) const
+{
+    return CV_MAKETYPE(fusedTree(e).nodes.back().depth, fusedTree(e).cn);
+}
+
 /////////////////////////////////////////////////////////////////////////////////////////////////////////
 
 void MatOp_T::assign(const MatExpr& e, Mat& m, int _type) const
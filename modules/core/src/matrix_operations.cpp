@@ -536,7 +536,11 @@ void cv::transpose( InputArray _src, OutputArray _dst )
     {
         TransposeFunc func = transposeTab[esz];
         CV_Assert( func != 0 );
-        func( src.ptr(), src.step, dst.ptr(), dst.step, src.size() );
+        // the source columns (i.e. the destination rows) are distributed between the threads
+        parallel_for_elemwise(Size(src.cols, 1), esz*src.rows, [&](int x, int, Size bsz)
+        {
+            func( src.ptr() + x*esz, src.step, dst.ptr(x), dst.step, Size(bsz.width, src.rows) );
+        });
     }
 }
 
@@ -1127,53 +1131,245 @@ void cv::reduce(InputArray _src, OutputArray _dst, int dim, int op, int dtype)
 namespace cv
 {
 
-template<typename T> static void sort_( const Mat& src, Mat& dst, int flags )
+// The order preserving mapping of the values to the unsigned integer keys for the radix sort.
+// The negative floating-point values are inverted (-inf < -1 < -0 < 0 < 1 < inf).
+template<typename T> struct RadixKey {};
+
+template<> struct RadixKey<uchar>
 {
-    AutoBuffer<T> buf;
-    int n, len;
-    bool sortRows = (flags & 1) == CV_SORT_EVERY_ROW;
-    bool inplace = src.data == dst.data;
-    bool sortDescending = (flags & CV_SORT_DESCENDING) != 0;
+    typedef uchar type;
+    static type get(uchar v) { return v; }
+    static uchar value(type k) { return k; }
+};
 
-    if( sortRows )
-        n = src.rows, len = src.cols;
-    else
+template<> struct RadixKey<schar>
+{
+    typedef uchar type;
+    static type get(schar v) { return (uchar)(v ^ 0x80); }
+    static schar value(type k) { return (schar)(k ^ 0x80); }
+};
+
+template<> struct RadixKey<ushort>
+{
+    typedef ushort type;
+    static type get(ushort v) { return v; }
+    static ushort value(type k) { return k; }
+};
+
+template<> struct RadixKey<short>
+{
+    typedef ushort type;
+    static type get(short v) { return (ushort)(v ^ 0x8000); }
+    static short value(type k) { return (short)(k ^ 0x8000); }
+};
+
+template<> struct RadixKey<int>
+{
+    typedef unsigned type;
+    static type get(int v) { return (unsigned)v ^ 0x80000000u; }
+    static int value(type k) { return (int)(k ^ 0x80000000u); }
+};
+
+template<> struct RadixKey<float>
+{
+    typedef unsigned type;
+    static type get(float v)
+    {
+        Cv32suf u; u.f = v;
+        return (unsigned)u.i ^ (u.i < 0 ? 0xffffffffu : 0x80000000u);
+    }
+    static float value(type k)
     {
-        n = src.cols, len = src.rows;
-        buf.allocate(len);
+        Cv32suf u; u.u = k ^ (k & 0x80000000u ? 0x80000000u : 0xffffffffu);
+        return u.f;
     }
-    T* bptr = buf.data();
+};
 
-    for( int i = 0; i < n; i++ )
+template<> struct RadixKey<double>
+{
+    typedef uint64 type;
+    static type get(double v)
+    {
+        Cv64suf u; u.f = v;
+        return (uint64)u.i ^ (u.i < 0 ? ~(uint64)0 : (uint64)1 << 63);
+    }
+    static double value(type k)
     {
-        T* ptr = bptr;
-        if( sortRows )
+        Cv64suf u; u.u = k ^ (k >> 63 ? (uint64)1 << 63 : ~(uint64)0);
+        return u.f;
+    }
+};
+
+// the shorter rows are sorted by std::sort; the threshold is per byte of the key, since each byte is a pass
+#define CV_SORT_RADIX_MIN_LEN 64
+// the longer rows are sorted by the parallel passes, when there are not enough rows for all the threads
+#define CV_SORT_RADIX_PARALLEL_MIN_LEN (1 << 16)
+
+// Stable LSD radix sort of the keys (and the indices, if idx != 0) by 8-bit digits.
+// The array is split into nblocks blocks, each pass computes the histograms of the blocks and
+// scatters the blocks in parallel. The passes are skipped for the digits that are the same for all
+// the keys. kbuf and ibuf are the buffers of len elements, the result is stored in keys and idx.
+template<typename K> static void radixSort(K* keys, K* kbuf, int* idx, int* ibuf, int len, int nblocks)
+{
+    enum { NDIGITS = (int)sizeof(K), NBINS = 256 };
+    K* keys0 = keys;
+    int* idx0 = idx;
+    std::vector<int> hist((size_t)nblocks*NDIGITS*NBINS, 0), total(NDIGITS*NBINS, 0);
+    std::vector<int> offsets((size_t)nblocks*NBINS);
+
+    auto block = [&](int b) { return Range((int)((int64)len*b/nblocks), (int)((int64)len*(b+1)/nblocks)); };
+    auto computeHist = [&](int d0, int d1)
+    {
+        parallel_for_(Range(0, nblocks), [&](const Range& r)
         {
-            T* dptr = dst.ptr<T>(i);
-            if( !inplace )
+            for( int b = r.start; b < r.end; b++ )
             {
-                const T* sptr = src.ptr<T>(i);
-                memcpy(dptr, sptr, sizeof(T) * len);
+                Range br = block(b);
+                int* h = &hist[(size_t)b*NDIGITS*NBINS];
+                for( int d = d0; d < d1; d++ )
+                    std::fill(h + d*NBINS, h + (d+1)*NBINS, 0);
+                for( int i = br.start; i < br.end; i++ )
+                {
+                    K k = keys[i];
+                    for( int d = d0; d < d1; d++ )
+                        h[d*NBINS + (int)((k >> d*8) & 255)]++;
+                }
             }
-            ptr = dptr;
-        }
-        else
+        }, nblocks);
+    };
+
+    // the histograms of all the digits are computed at once; the totals don't change
+    // between the passes, but the histograms of the blocks do (if there are several blocks)
+    computeHist(0, NDIGITS);
+    for( int b = 0; b < nblocks; b++ )
+        for( int j = 0; j < NDIGITS*NBINS; j++ )
+            total[j] += hist[(size_t)b*NDIGITS*NBINS + j];
+
+    bool sorted = false;
+    for( int d = 0; d < NDIGITS; d++ )
+    {
+        const int* t = &total[d*NBINS];
+        if( std::find(t, t + NBINS, len) != t + NBINS )
+            continue;
+        if( sorted && nblocks > 1 )
+            computeHist(d, d + 1);
+        sorted = true;
+
+        for( int v = 0, ofs = 0; v < NBINS; v++ )
+            for( int b = 0; b < nblocks; b++ )
+            {
+                offsets[(size_t)b*NBINS + v] = ofs;
+                ofs += hist[((size_t)b*NDIGITS + d)*NBINS + v];
+            }
+
+        parallel_for_(Range(0, nblocks), [&](const Range& r)
         {
-            for( int j = 0; j < len; j++ )
-                ptr[j] = src.ptr<T>(j)[i];
-        }
+            for( int b = r.start; b < r.end; b++ )
+            {
+                Range br = block(b);
+                int* ofs = &offsets[(size_t)b*NBINS];
+                int shift = d*8;
+                if( idx )
+                {
+                    for( int i = br.start; i < br.end; i++ )
+                    {
+                        int j = ofs[(int)((keys[i] >> shift) & 255)]++;
+                        kbuf[j] = keys[i];
+                        ibuf[j] = idx[i];
+                    }
+                }
+                else
+                {
+                    for( int i = br.start; i < br.end; i++ )
+                        kbuf[ofs[(int)((keys[i] >> shift) & 255)]++] = keys[i];
+                }
+            }
+        }, nblocks);
+        std::swap(keys, kbuf);
+        std::swap(idx, ibuf);
+    }
+
+    if( keys != keys0 )
+    {
+        memcpy(keys0, keys, len*sizeof(K));
+        if( idx0 )
+            memcpy(idx0, idx, len*sizeof(int));
+    }
+}
 
-        std::sort( ptr, ptr + len );
-        if( sortDescending )
+// the number of the blocks of the parallel radix sort passes; 1 if the rows are sorted in parallel
+static int radixSortBlocks(int n, int len)
+{
+    int nthreads = getNumThreads();
+    if( len < CV_SORT_RADIX_PARALLEL_MIN_LEN || n >= nthreads )
+        return 1;
+    return std::max(std::min(nthreads, len / (CV_SORT_RADIX_PARALLEL_MIN_LEN/4)), 1);
+}
+
+template<typename T> static void sort_( const Mat& src, Mat& dst, int flags )
+{
+    typedef typename RadixKey<T>::type K;
+    bool sortRows = (flags & 1) == CV_SORT_EVERY_ROW;
+    bool sortDescending = (flags & CV_SORT_DESCENDING) != 0;
+    int n = sortRows ? src.rows : src.cols, len = sortRows ? src.cols : src.rows;
+    bool radix = len >= CV_SORT_RADIX_MIN_LEN*(int)sizeof(K);
+    int nblocks = radix ? radixSortBlocks(n, len) : 1;
+
+    auto sortRange = [&](const Range& range)
+    {
+        AutoBuffer<T> buf(sortRows ? 0 : len);
+        AutoBuffer<K> kbuf(radix ? len*2 : 0);
+        K* keys = kbuf.data();
+
+        // the descending order is the ascending order of the inverted keys
+        K mask = sortDescending ? (K)~(K)0 : (K)0;
+
+        for( int i = range.start; i < range.end; i++ )
         {
-            for( int j = 0; j < len/2; j++ )
-                std::swap(ptr[j], ptr[len-1-j]);
+            const T* sptr = buf.data();
+            T* dptr = buf.data();
+            if( sortRows )
+            {
+                sptr = src.ptr<T>(i);
+                dptr = dst.ptr<T>(i);
+            }
+            else
+            {
+                for( int j = 0; j < len; j++ )
+                    dptr[j] = src.ptr<T>(j)[i];
+            }
+
+            if( radix )
+            {
+                for( int j = 0; j < len; j++ )
+                    keys[j] = RadixKey<T>::get(sptr[j]) ^ mask;
+                radixSort(keys, keys + len, (int*)0, (int*)0, len, nblocks);
+                for( int j = 0; j < len; j++ )
+                    dptr[j] = RadixKey<T>::value(keys[j] ^ mask);
+            }
+            else
+            {
+                if( sptr != dptr )
+                    memcpy(dptr, sptr, sizeof(T) * len);
+                std::sort( dptr, dptr + len );
+                if( sortDescending )
+                {
+                    for( int j = 0; j < len/2; j++ )
+                        std::swap(dptr[j], dptr[len-1-j]);
+                }
+            }
+
+            if( !sortRows )
+                for( int j = 0; j < len; j++ )
+                    dst.ptr<T>(j)[i] = dptr[j];
         }
+    };
 
-        if( !sortRows )
-            for( int j = 0; j < len; j++ )
-                dst.ptr<T>(j)[i] = ptr[j];
-    }
+    // the passes of radixSort() are parallel themselves, the nested parallel_for_ would run them serially
+    if( nblocks > 1 )
+        sortRange(Range(0, n));
+    else
+        parallel_for_(Range(0, n), sortRange, (double)n*len/(1 << 16));
 }
 
 #ifdef HAVE_IPP
@@ -1272,56 +1468,79 @@ public:
     const _Tp* arr;
 };
 
+template<typename _Tp> class GreaterThanIdx
+{
+public:
+    GreaterThanIdx( const _Tp* _arr ) : arr(_arr) {}
+    bool operator()(int a, int b) const { return arr[a] > arr[b]; }
+    const _Tp* arr;
+};
+
 template<typename T> static void sortIdx_( const Mat& src, Mat& dst, int flags )
 {
-    AutoBuffer<T> buf;
-    AutoBuffer<int> ibuf;
+    typedef typename RadixKey<T>::type K;
     bool sortRows = (flags & 1) == CV_SORT_EVERY_ROW;
     bool sortDescending = (flags & CV_SORT_DESCENDING) != 0;
 
     CV_Assert( src.data != dst.data );
 
-    int n, len;
-    if( sortRows )
-        n = src.rows, len = src.cols;
-    else
-    {
-        n = src.cols, len = src.rows;
-        buf.allocate(len);
-        ibuf.allocate(len);
-    }
-    T* bptr = buf.data();
-    int* _iptr = ibuf.data();
+    int n = sortRows ? src.rows : src.cols, len = sortRows ? src.cols : src.rows;
+    bool radix = len >= CV_SORT_RADIX_MIN_LEN*(int)sizeof(K);
+    int nblocks = radix ? radixSortBlocks(n, len) : 1;
 
-    for( int i = 0; i < n; i++ )
+    auto sortRange = [&](const Range& range)
     {
-        T* ptr = bptr;
-        int* iptr = _iptr;
-
-        if( sortRows )
-        {
-            ptr = (T*)(src.data + src.step*i);
-            iptr = dst.ptr<int>(i);
-        }
-        else
+        AutoBuffer<T> buf(sortRows ? 0 : len);
+        AutoBuffer<int> ibuf(sortRows ? len : len*2);
+        AutoBuffer<K> kbuf(radix ? len*2 : 0);
+        K* keys = kbuf.data();
+        // both sorts are stable, so the equal elements are ordered by their indices
+        // in both ascending and descending order (-0 and 0 are made equal by adding 0)
+        K mask = sortDescending ? (K)~(K)0 : (K)0;
+
+        for( int i = range.start; i < range.end; i++ )
         {
+            const T* ptr = buf.data();
+            int* iptr = ibuf.data() + (sortRows ? 0 : len);
+
+            if( sortRows )
+            {
+                ptr = src.ptr<T>(i);
+                iptr = dst.ptr<int>(i);
+            }
+            else
+            {
+                for( int j = 0; j < len; j++ )
+                    buf[j] = src.ptr<T>(j)[i];
+            }
             for( int j = 0; j < len; j++ )
-                ptr[j] = src.ptr<T>(j)[i];
-        }
-        for( int j = 0; j < len; j++ )
-            iptr[j] = j;
+                iptr[j] = j;
 
-        std::sort( iptr, iptr + len, LessThanIdx<T>(ptr) );
-        if( sortDescending )
-        {
-            for( int j = 0; j < len/2; j++ )
-                std::swap(iptr[j], iptr[len-1-j]);
+            if( radix )
+            {
+                for( int j = 0; j < len; j++ )
+                    keys[j] = RadixKey<T>::get((T)(ptr[j] + 0)) ^ mask;
+                radixSort(keys, keys + len, iptr, ibuf.data(), len, nblocks);
+            }
+            else
+            {
+                if( sortDescending )
+                    std::stable_sort( iptr, iptr + len, GreaterThanIdx<T>(ptr) );
+                else
+                    std::stable_sort( iptr, iptr + len, LessThanIdx<T>(ptr) );
+            }
+
+            if( !sortRows )
+                for( int j = 0; j < len; j++ )
+                    dst.ptr<int>(j)[i] = iptr[j];
         }
+    };
 
-        if( !sortRows )
-            for( int j = 0; j < len; j++ )
-                dst.ptr<int>(j)[i] = iptr[j];
-    }
+    // see sort_()
+    if( nblocks > 1 )
+        sortRange(Range(0, n));
+    else
+        parallel_for_(Range(0, n), sortRange, (double)n*len/(1 << 16));
 }
 
 #ifdef HAVE_IPP
@@ -1405,6 +1624,59 @@ static bool ipp_sortIdx( const Mat& src, Mat& dst, int flags )
 #endif
 
 typedef void (*SortFunc)(const Mat& src, Mat& dst, int flags);
+
+template<typename T> static void topK_( const Mat& src, Mat& dst, Mat& didx, int k, int flags )
+{
+    bool sortRows = (flags & 1) == CV_SORT_EVERY_ROW;
+    bool sortDescending = (flags & CV_SORT_DESCENDING) != 0;
+    int n = sortRows ? src.rows : src.cols, len = sortRows ? src.cols : src.rows;
+
+    parallel_for_(Range(0, n), [&](const Range& range)
+    {
+        AutoBuffer<T> buf(sortRows ? 0 : len);
+        AutoBuffer<int> ibuf(len);
+        int* iptr = ibuf.data();
+
+        for( int i = range.start; i < range.end; i++ )
+        {
+            const T* ptr = buf.data();
+            if( sortRows )
+                ptr = src.ptr<T>(i);
+            else
+            {
+                for( int j = 0; j < len; j++ )
+                    buf[j] = src.ptr<T>(j)[i];
+            }
+            for( int j = 0; j < len; j++ )
+                iptr[j] = j;
+
+            // the equal elements are ordered by their indices, so the result doesn't depend
+            // on the implementation of nth_element
+            auto less = [ptr](int a, int b) { return ptr[a] < ptr[b] || (ptr[a] == ptr[b] && a < b); };
+            auto greater = [ptr](int a, int b) { return ptr[a] > ptr[b] || (ptr[a] == ptr[b] && a < b); };
+            if( sortDescending )
+            {
+                std::nth_element(iptr, iptr + k - 1, iptr + len, greater);
+                std::sort(iptr, iptr + k, greater);
+            }
+            else
+            {
+                std::nth_element(iptr, iptr + k - 1, iptr + len, less);
+                std::sort(iptr, iptr + k, less);
+            }
+
+            for( int j = 0; j < k; j++ )
+            {
+                T* dptr = sortRows ? dst.ptr<T>(i) + j : dst.ptr<T>(j) + i;
+                int* diptr = sortRows ? didx.ptr<int>(i) + j : didx.ptr<int>(j) + i;
+                *dptr = ptr[iptr[j]];
+                *diptr = iptr[j];
+            }
+        }
+    }, (double)n*len/(1 << 16));
+}
+
+typedef void (*TopKFunc)(const Mat& src, Mat& dst, Mat& idx, int k, int flags);
 }
 
 void cv::sort( InputArray _src, OutputArray _dst, int flags )
@@ -1451,3 +1723,44 @@ void cv::sortIdx( InputArray _src, OutputArray _dst, int flags )
     CV_Assert( func != 0 );
     func( src, dst, flags );
 }
+
+void cv::topK( InputArray _src, OutputArray _dst, OutputArray _idx, int k, int flags )
+{
+    CV_INSTRUMENT_REGION();
+
+    Mat src = _src.getMat();
+    CV_Assert( src.dims <= 2 && src.channels() == 1 );
+    bool sortRows = (flags & 1) == SORT_EVERY_ROW;
+    int n = sortRows ? src.rows : src.cols, len = sortRows ? src.cols : src.rows;
+    CV_Assert( 0 < k && k <= len );
+
+    Size dsize = sortRows ? Size(k, n) : Size(n, k);
+    Mat dst0, idx0;
+    if( _dst.needed() )
+    {
+        _dst.create( dsize, src.type() );
+        dst0 = _dst.getMat();
+    }
+    if( _idx.needed() )
+    {
+        _idx.create( dsize, CV_32S );
+        idx0 = _idx.getMat();
+    }
+    // the temporary outputs are used if the outputs are missing or overwrite the input
+    Mat dst = dst0.data && dst0.data != src.data ? dst0 : Mat(dsize, src.type());
+    Mat idx = idx0.data && idx0.data != src.data ? idx0 : Mat(dsize, CV_32S);
+
+    static TopKFunc tab[] =
+    {
+        topK_<uchar>, topK_<schar>, topK_<ushort>, topK_<short>,
+        topK_<int>, topK_<float>, topK_<double>, 0
+    };
+    TopKFunc func = tab[src.depth()];
+    CV_Assert( func != 0 );
+    func( src, dst, idx, k, flags );
+
+    if( dst0.data && dst.data != dst0.data )
+        dst.copyTo(dst0);
+    if( idx0.data && idx.data != idx0.data )
+        idx.copyTo(idx0);
+}
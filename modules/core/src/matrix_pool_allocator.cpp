@@ -0,0 +1,275 @@
+// This file is part of OpenCV project.
+// It is subject to the license terms in the LICENSE file found in the top-level directory
+// of this distribution and at http://opencv.org/license.html.
+
+#include "precomp.hpp"
+#include "opencv2/core/utils/configuration.private.hpp"
+#include "opencv2/core/utils/logger.hpp"
+#include "opencv2/core/utils/tls.hpp"
+
+#include <atomic>
+
+namespace cv {
+
+namespace {
+
+// Blocks are rounded up to the size classes: 64 bytes and then 4 classes per power of 2,
+// so up to 20% of a block is not used.
+enum { POOL_MIN_BLOCK_SHIFT = 6, POOL_CLASSES_PER_OCTAVE = 4,
+       POOL_MAX_CLASSES = (64 - POOL_MIN_BLOCK_SHIFT)*POOL_CLASSES_PER_OCTAVE + 1 };
+
+static int poolSizeClass(size_t size)
+{
+    if( size <= ((size_t)1 << POOL_MIN_BLOCK_SHIFT) )
+        return 0;
+    int e = 0;
+    for( size_t s = size - 1; s > 1; s >>= 1 )
+        e++;
+    size_t base = (size_t)1 << e, step = base / POOL_CLASSES_PER_OCTAVE;
+    int sub = (int)((size - base + step - 1) / step);
+    return (e - POOL_MIN_BLOCK_SHIFT)*POOL_CLASSES_PER_OCTAVE + sub;
+}
+
+static size_t poolBlockSize(int cls)
+{
+    if( cls == 0 )
+        return (size_t)1 << POOL_MIN_BLOCK_SHIFT;
+    int e = POOL_MIN_BLOCK_SHIFT + (cls - 1) / POOL_CLASSES_PER_OCTAVE;
+    int sub = (cls - 1) % POOL_CLASSES_PER_OCTAVE + 1;
+    size_t base = (size_t)1 << e;
+    return base + sub*(base / POOL_CLASSES_PER_OCTAVE);
+}
+
+class PoolMatAllocator;
+
+// Free lists of the thread. The blocks released by a thread are reused by the same thread,
+// so allocate/deallocate don't contend with the other threads.
+struct PoolThreadCache
+{
+    explicit PoolThreadCache(PoolMatAllocator& owner);
+    ~PoolThreadCache();
+
+    uchar* take(int cls);
+    void put(uchar* block, int cls);
+    size_t releaseAll();
+
+    PoolMatAllocator& owner;
+    Mutex mutex;  // the blocks may be released by freeAllReservedBuffers() from another thread
+    std::vector<uchar*> blocks[POOL_MAX_CLASSES];
+};
+
+class PoolThreadCaches : public TLSDataContainer
+{
+public:
+    explicit PoolThreadCaches(PoolMatAllocator& owner_) : owner(owner_) {}
+    ~PoolThreadCaches() { release(); }
+
+    PoolThreadCache& getRef() const { return *(PoolThreadCache*)getData(); }
+
+protected:
+    void* createDataInstance() const CV_OVERRIDE { return new PoolThreadCache(owner); }
+    void deleteDataInstance(void* pData) const CV_OVERRIDE { delete (PoolThreadCache*)pData; }
+
+    PoolMatAllocator& owner;
+};
+
+class PoolMatAllocator CV_FINAL : public MatAllocator, public BufferPoolController
+{
+public:
+    PoolMatAllocator() : caches(*this), reservedSize(0), hits(0), misses(0)
+    {
+        maxReservedSize = utils::getConfigurationParameterSizeT("OPENCV_MAT_POOL_ALLOCATOR_LIMIT", (size_t)256 << 20);
+        CV_LOG_INFO(NULL, "Mat pool allocator: max capacity: " << maxReservedSize.load());
+    }
+
+    UMatData* allocate(int dims, const int* sizes, int type,
+                       void* data0, size_t* step, AccessFlag /*flags*/, UMatUsageFlags /*usageFlags*/) const CV_OVERRIDE
+    {
+        size_t total = CV_ELEM_SIZE(type);
+        for( int i = dims-1; i >= 0; i-- )
+        {
+            if( step )
+            {
+                if( data0 && step[i] != CV_AUTOSTEP )
+                {
+                    CV_Assert(total <= step[i]);
+                    total = step[i];
+                }
+                else
+                    step[i] = total;
+            }
+            total *= sizes[i];
+        }
+
+        int cls = -1;
+        uchar* data = (uchar*)data0;
+        if( !data )
+        {
+            cls = poolSizeClass(total);
+            data = caches.getRef().take(cls);
+            if( data )
+                hits++;
+            else
+            {
+                misses++;
+                data = (uchar*)fastMalloc(poolBlockSize(cls));
+            }
+        }
+        UMatData* u = new UMatData(this);
+        u->data = u->origdata = data;
+        u->size = total;
+        u->allocatorFlags_ = cls;
+        if( data0 )
+            u->flags |= UMatData::USER_ALLOCATED;
+
+        return u;
+    }
+
+    bool allocate(UMatData* u, AccessFlag /*accessFlags*/, UMatUsageFlags /*usageFlags*/) const CV_OVERRIDE
+    {
+        if(!u) return false;
+        return true;
+    }
+
+    void deallocate(UMatData* u) const CV_OVERRIDE
+    {
+        if(!u)
+            return;
+
+        CV_Assert(u->urefcount == 0);
+        CV_Assert(u->refcount == 0);
+        if( !(u->flags & UMatData::USER_ALLOCATED) )
+        {
+            int cls = u->allocatorFlags_;
+            size_t blockSize = poolBlockSize(cls);
+            if( reservedSize.fetch_add(blockSize) + blockSize <= maxReservedSize )
+                caches.getRef().put(u->origdata, cls);
+            else
+            {
+                reservedSize -= blockSize;
+                fastFree(u->origdata);
+            }
+            u->origdata = 0;
+        }
+        delete u;
+    }
+
+    BufferPoolController* getBufferPoolController(const char* id) const CV_OVERRIDE
+    {
+        CV_UNUSED(id);
+        return const_cast<PoolMatAllocator*>(this);
+    }
+
+    size_t getReservedSize() const CV_OVERRIDE { return reservedSize; }
+    size_t getMaxReservedSize() const CV_OVERRIDE { return maxReservedSize; }
+
+    void setMaxReservedSize(size_t size) CV_OVERRIDE
+    {
+        maxReservedSize = size;
+        if( reservedSize > size )
+            freeAllReservedBuffers();
+    }
+
+    void freeAllReservedBuffers() CV_OVERRIDE
+    {
+        AutoLock lock(registryMutex);
+        for( size_t i = 0; i < registry.size(); i++ )
+            registry[i]->releaseAll();
+    }
+
+    void registerCache(PoolThreadCache* cache)
+    {
+        AutoLock lock(registryMutex);
+        registry.push_back(cache);
+    }
+
+    void unregisterCache(PoolThreadCache* cache)
+    {
+        AutoLock lock(registryMutex);
+        registry.erase(std::find(registry.begin(), registry.end(), cache));
+        cache->releaseAll();
+    }
+
+    MatPoolAllocatorStatistics getStatistics() const
+    {
+        MatPoolAllocatorStatistics stats;
+        stats.hits = hits;
+        stats.misses = misses;
+        stats.reservedSize = reservedSize;
+        stats.maxReservedSize = maxReservedSize;
+        return stats;
+    }
+
+    PoolThreadCaches caches;
+    Mutex registryMutex;
+    std::vector<PoolThreadCache*> registry;  // caches of all the threads, guarded by registryMutex
+
+    mutable std::atomic<size_t> reservedSize;
+    std::atomic<size_t> maxReservedSize;
+    mutable std::atomic<uint64> hits;
+    mutable std::atomic<uint64> misses;
+};
+
+PoolThreadCache::PoolThreadCache(PoolMatAllocator& owner_) : owner(owner_)
+{
+    owner.registerCache(this);
+}
+
+PoolThreadCache::~PoolThreadCache()
+{
+    // thread exit: the blocks are not accessible anymore
+    owner.unregisterCache(this);
+}
+
+uchar* PoolThreadCache::take(int cls)
+{
+    AutoLock lock(mutex);
+    std::vector<uchar*>& list = blocks[cls];
+    if( list.empty() )
+        return 0;
+    uchar* block = list.back();
+    list.pop_back();
+    owner.reservedSize -= poolBlockSize(cls);
+    return block;
+}
+
+void PoolThreadCache::put(uchar* block, int cls)
+{
+    AutoLock lock(mutex);
+    blocks[cls].push_back(block);
+}
+
+size_t PoolThreadCache::releaseAll()
+{
+    AutoLock lock(mutex);
+    size_t released = 0;
+    for( int cls = 0; cls < POOL_MAX_CLASSES; cls++ )
+    {
+        std::vector<uchar*>& list = blocks[cls];
+        for( size_t i = 0; i < list.size(); i++ )
+            fastFree(list[i]);
+        released += list.size()*poolBlockSize(cls);
+        std::vector<uchar*>().swap(list);
+    }
+    owner.reservedSize -= released;
+    return released;
+}
+
+static PoolMatAllocator* getPoolMatAllocator()
+{
+    CV_SINGLETON_LAZY_INIT(PoolMatAllocator, new PoolMatAllocator())
+}
+
+} // namespace
+
+MatAllocator* Mat::getPoolAllocator()
+{
+    return getPoolMatAllocator();
+}
+
+MatPoolAllocatorStatistics getPoolAllocatorStatistics()
+{
+    return getPoolMatAllocator()->getStatistics();
+}
+
+} // namespace cv
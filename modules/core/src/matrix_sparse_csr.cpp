@@ -0,0 +1,326 @@
+// This file is part of OpenCV project.
+// It is subject to the license terms in the LICENSE file found in the top-level directory
+// of this distribution and at http://opencv.org/license.html.
+
+#include "precomp.hpp"
+#include "opencv2/core/hal/intrin.hpp"
+
+namespace cv {
+
+//////////////////////////////////////// SparseMatCSR ////////////////////////////////////////
+
+SparseMatCSR::SparseMatCSR() : flags(CV_64F), rows(0), cols(0)
+{
+    rowPtr.assign(1, 0);
+}
+
+SparseMatCSR::SparseMatCSR(int rows_, int cols_, InputArray _rowPtr, InputArray _colIdx, InputArray _values)
+    : flags(CV_64F), rows(rows_), cols(cols_)
+{
+    CV_Assert( rows >= 0 && cols >= 0 );
+    Mat rp = _rowPtr.getMat(), ci = _colIdx.getMat(), v = _values.getMat();
+    CV_Assert( rp.type() == CV_32S && rp.isContinuous() && (int)rp.total() == rows + 1 );
+    CV_Assert( ci.type() == CV_32S && ci.isContinuous() );
+    CV_Assert( (v.type() == CV_32F || v.type() == CV_64F) && v.total() == ci.total() );
+
+    const int* rpp = rp.ptr<int>();
+    const int* cip = ci.ptr<int>();
+    CV_Assert( rpp[0] == 0 && (size_t)rpp[rows] == ci.total() );
+    for( int i = 0; i < rows; i++ )
+    {
+        CV_Assert( rpp[i] <= rpp[i+1] );
+        for( int p = rpp[i]; p < rpp[i+1]; p++ )
+            CV_Assert( (unsigned)cip[p] < (unsigned)cols && (p == rpp[i] || cip[p-1] < cip[p]) );
+    }
+
+    rowPtr.assign(rpp, rpp + rows + 1);
+    colIdx.assign(cip, cip + ci.total());
+    flags = v.type();
+    v.reshape(1, 1).copyTo(values);
+}
+
+SparseMatCSR::SparseMatCSR(const SparseMat& m0) : flags(CV_64F), rows(0), cols(0)
+{
+    CV_Assert( m0.dims() == 2 && m0.channels() == 1 );
+    SparseMat m = m0;
+    if( m.depth() != CV_32F && m.depth() != CV_64F )
+        m0.convertTo(m, CV_64F);
+    flags = m.type();
+    rows = m.size(0);
+    cols = m.size(1);
+
+    // counting sort of the hash table nodes by row, then by column within each row
+    rowPtr.assign(rows + 1, 0);
+    SparseMatConstIterator it = m.begin(), it_end = m.end();
+    for( ; it != it_end; ++it )
+        rowPtr[it.node()->idx[0] + 1]++;
+    for( int i = 0; i < rows; i++ )
+        rowPtr[i+1] += rowPtr[i];
+
+    size_t nz = rowPtr[rows], esz = m.elemSize();
+    std::vector<int> pos(rowPtr.begin(), rowPtr.end() - 1);
+    std::vector<const SparseMat::Node*> nodes(nz);
+    for( it = m.begin(); it != it_end; ++it )
+        nodes[pos[it.node()->idx[0]]++] = it.node();
+
+    colIdx.resize(nz);
+    values.create(1, (int)nz, m.type());
+    uchar* vptr = values.ptr();
+    std::vector<std::pair<int, const SparseMat::Node*> > row;
+    for( int i = 0; i < rows; i++ )
+    {
+        row.clear();
+        for( int p = rowPtr[i]; p < rowPtr[i+1]; p++ )
+            row.push_back(std::make_pair(nodes[p]->idx[1], nodes[p]));
+        std::sort(row.begin(), row.end());
+        for( size_t j = 0; j < row.size(); j++ )
+        {
+            int p = rowPtr[i] + (int)j;
+            colIdx[p] = row[j].first;
+            memcpy(vptr + p*esz, &m.value<uchar>(row[j].second), esz);
+        }
+    }
+}
+
+SparseMatCSR::SparseMatCSR(const Mat& m0) : flags(CV_64F), rows(m0.rows), cols(m0.cols)
+{
+    CV_Assert( m0.dims <= 2 && m0.channels() == 1 );
+    Mat m = m0;
+    if( m.depth() != CV_32F && m.depth() != CV_64F )
+        m0.convertTo(m, CV_64F);
+    flags = m.type();
+
+    rowPtr.assign(rows + 1, 0);
+    Mat mask = m != 0;
+    for( int i = 0; i < rows; i++ )
+        rowPtr[i+1] = rowPtr[i] + countNonZero(mask.row(i));
+
+    size_t nz = rowPtr[rows], esz = m.elemSize();
+    colIdx.resize(nz);
+    values.create(1, (int)nz, m.type());
+    uchar* vptr = values.ptr();
+    for( int i = 0; i < rows; i++ )
+    {
+        const uchar* mrow = mask.ptr(i);
+        const uchar* src = m.ptr(i);
+        for( int j = 0, p = rowPtr[i]; j < cols; j++ )
+        {
+            if( mrow[j] )
+            {
+                colIdx[p] = j;
+                memcpy(vptr + p*esz, src + j*esz, esz);
+                p++;
+            }
+        }
+    }
+}
+
+int SparseMatCSR::type() const
+{
+    return CV_MAT_TYPE(flags);
+}
+
+bool SparseMatCSR::empty() const
+{
+    return rows == 0 || cols == 0;
+}
+
+size_t SparseMatCSR::nonZeros() const
+{
+    return colIdx.size();
+}
+
+Size SparseMatCSR::size() const
+{
+    return Size(cols, rows);
+}
+
+void SparseMatCSR::copyTo(OutputArray _m) const
+{
+    _m.create(rows, cols, type());
+    Mat m = _m.getMat();
+    m = Scalar::all(0);
+    size_t esz = m.elemSize();
+    const uchar* vptr = values.ptr();
+    for( int i = 0; i < rows; i++ )
+    {
+        uchar* dst = m.ptr(i);
+        for( int p = rowPtr[i]; p < rowPtr[i+1]; p++ )
+            memcpy(dst + colIdx[p]*esz, vptr + p*esz, esz);
+    }
+}
+
+void SparseMatCSR::copyTo(SparseMat& m) const
+{
+    int sizes[] = { rows, cols };
+    m.create(2, sizes, type());
+    size_t esz = m.elemSize();
+    const uchar* vptr = values.ptr();
+    for( int i = 0; i < rows; i++ )
+        for( int p = rowPtr[i]; p < rowPtr[i+1]; p++ )
+            memcpy(m.ptr(i, colIdx[p], true), vptr + p*esz, esz);
+}
+
+SparseMatCSR SparseMatCSR::t() const
+{
+    SparseMatCSR dst;
+    dst.flags = flags;
+    dst.rows = cols;
+    dst.cols = rows;
+    dst.rowPtr.assign(cols + 1, 0);
+    size_t nz = nonZeros(), esz = CV_ELEM_SIZE(type());
+    for( size_t p = 0; p < nz; p++ )
+        dst.rowPtr[colIdx[p] + 1]++;
+    for( int j = 0; j < cols; j++ )
+        dst.rowPtr[j+1] += dst.rowPtr[j];
+
+    // the rows are scanned in order, so the columns of the transposed rows come out sorted
+    std::vector<int> pos(dst.rowPtr.begin(), dst.rowPtr.end() - 1);
+    dst.colIdx.resize(nz);
+    dst.values.create(1, (int)nz, type());
+    const uchar* sptr = values.ptr();
+    uchar* dptr = dst.values.ptr();
+    for( int i = 0; i < rows; i++ )
+    {
+        for( int p = rowPtr[i]; p < rowPtr[i+1]; p++ )
+        {
+            int q = pos[colIdx[p]]++;
+            dst.colIdx[q] = i;
+            memcpy(dptr + q*esz, sptr + p*esz, esz);
+        }
+    }
+    return dst;
+}
+
+////////////////////////////////////// sparse * dense //////////////////////////////////////
+
+// sum_p vals[p]*b[idx[p]]
+static inline float dotGather(const float* vals, const int* idx, const float* b, int n)
+{
+    int p = 0;
+    float s = 0.f;
+#if CV_SIMD
+    v_float32 vs = vx_setzero_f32();
+    for( ; p <= n - v_float32::nlanes; p += v_float32::nlanes )
+        vs = v_fma(vx_load(vals + p), vx_lut(b, idx + p), vs);
+    s = v_reduce_sum(vs);
+#endif
+    for( ; p < n; p++ )
+        s += vals[p]*b[idx[p]];
+    return s;
+}
+
+static inline double dotGather(const double* vals, const int* idx, const double* b, int n)
+{
+    int p = 0;
+    double s = 0.;
+#if CV_SIMD_64F
+    v_float64 vs = vx_setzero_f64();
+    for( ; p <= n - v_float64::nlanes; p += v_float64::nlanes )
+        vs = v_fma(vx_load(vals + p), vx_lut(b, idx + p), vs);
+    s = v_reduce_sum(vs);
+#endif
+    for( ; p < n; p++ )
+        s += vals[p]*b[idx[p]];
+    return s;
+}
+
+// d += a*b
+static inline void axpy(float a, const float* b, float* d, int n)
+{
+    int j = 0;
+#if CV_SIMD
+    v_float32 va = vx_setall_f32(a);
+    for( ; j <= n - v_float32::nlanes; j += v_float32::nlanes )
+        v_store(d + j, v_fma(va, vx_load(b + j), vx_load(d + j)));
+#endif
+    for( ; j < n; j++ )
+        d[j] += a*b[j];
+}
+
+static inline void axpy(double a, const double* b, double* d, int n)
+{
+    int j = 0;
+#if CV_SIMD_64F
+    v_float64 va = vx_setall_f64(a);
+    for( ; j <= n - v_float64::nlanes; j += v_float64::nlanes )
+        v_store(d + j, v_fma(va, vx_load(b + j), vx_load(d + j)));
+#endif
+    for( ; j < n; j++ )
+        d[j] += a*b[j];
+}
+
+template<typename T> static void
+sparseGemmRows(const SparseMatCSR& A, const Mat& B, T alpha, const Mat& C, T beta, Mat& D, const Range& range)
+{
+    const int* rowPtr = A.rowPtr.data();
+    const int* colIdx = A.colIdx.data();
+    const T* vals = A.values.ptr<T>();
+    int k = D.cols;
+    // a column vector: the elements of B are gathered by the column indices
+    bool gather = k == 1 && (B.isContinuous() || B.rows == 1);
+
+    for( int i = range.start; i < range.end; i++ )
+    {
+        T* d = D.ptr<T>(i);
+        const T* c = C.empty() ? 0 : C.ptr<T>(i);
+        int p0 = rowPtr[i], n = rowPtr[i+1] - p0;
+
+        if( gather )
+        {
+            T s = alpha*dotGather(vals + p0, colIdx + p0, B.ptr<T>(), n);
+            d[0] = c ? s + beta*c[0] : s;
+            continue;
+        }
+
+        for( int j = 0; j < k; j++ )
+            d[j] = c ? beta*c[j] : T(0);
+        for( int p = p0; p < p0 + n; p++ )
+            axpy(alpha*vals[p], B.ptr<T>(colIdx[p]), d, k);
+    }
+}
+
+void gemm(const SparseMatCSR& A0, InputArray _B, double alpha, InputArray _C, double beta, OutputArray _D, int flags)
+{
+    CV_INSTRUMENT_REGION();
+
+    int type = A0.type();
+    Mat B = _B.getMat(), C;
+    CV_Assert( B.type() == type && B.dims <= 2 );
+    if( flags & GEMM_2_T )
+        B = B.t();
+
+    // A^T*B is computed as the product of the transposed CSR matrix: the row-wise
+    // scatter of A^T*B would need the synchronization of the threads
+    SparseMatCSR At;
+    const SparseMatCSR& A = (flags & GEMM_1_T) ? (At = A0.t()) : A0;
+    CV_Assert( A.cols == B.rows );
+
+    if( !_C.empty() && beta != 0 )
+    {
+        C = _C.getMat();
+        CV_Assert( C.type() == type && C.dims <= 2 );
+        if( flags & GEMM_3_T )
+            C = C.t();
+        CV_Assert( C.rows == A.rows && C.cols == B.cols );
+    }
+
+    _D.create(A.rows, B.cols, type);
+    Mat D = _D.getMat(), dst = D;
+    if( D.data == B.data || (!C.empty() && D.data == C.data) )
+        dst = Mat(D.size(), type);  // the inputs are overwritten otherwise
+
+    double work = (double)A.nonZeros()*B.cols + (double)D.total();
+    parallel_for_(Range(0, A.rows), [&](const Range& r)
+    {
+        if( type == CV_32F )
+            sparseGemmRows<float>(A, B, (float)alpha, C, (float)beta, dst, r);
+        else
+            sparseGemmRows<double>(A, B, alpha, C, beta, dst, r);
+    }, work/(1 << 16));
+
+    if( dst.data != D.data )
+        dst.copyTo(D);
+}
+
+} // namespace cv
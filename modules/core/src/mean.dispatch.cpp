@@ -134,6 +134,33 @@ Scalar mean(InputArray _src, InputArray _mask)
 
     CV_Assert( cn <= 4 && func != 0 );
 
+    int nchunks = getReduceChunks(src, mask);
+    if( nchunks > 0 )
+    {
+        std::vector<Scalar> partial(nchunks);
+        std::vector<size_t> nzs(nchunks, 0);
+        int intSumBlockSize = depth <= CV_8S ? (1 << 23) : (1 << 15);
+        size_t esz = src.elemSize();
+        parallel_reduce_chunks(src, mask, nchunks, [&](int c, const uchar* ptr, const uchar* mptr, int len, size_t)
+        {
+            Scalar& ps = partial[c];
+            if( depth > CV_16S )
+            {
+                nzs[c] += func( ptr, mptr, (uchar*)&ps[0], len, cn );
+                return;
+            }
+            for( int j = 0; j < len; j += intSumBlockSize )
+            {
+                int bsz = std::min(len - j, intSumBlockSize), buf[4] = {0, 0, 0, 0};
+                nzs[c] += func( ptr + j*esz, mptr ? mptr + j : 0, (uchar*)buf, bsz, cn );
+                for( int i = 0; i < cn; i++ )
+                    ps[i] += buf[i];
+            }
+        });
+        reduceChunksTree(nchunks, [&](int i, int j) { partial[i] += partial[j]; nzs[i] += nzs[j]; });
+        return partial[0]*(nzs[0] ? 1./nzs[0] : 0);
+    }
+
     const Mat* arrays[] = {&src, &mask, 0};
     uchar* ptrs[2] = {};
     NAryMatIterator it(arrays, ptrs);
@@ -546,46 +573,94 @@ void meanStdDev(InputArray _src, OutputArray _mean, OutputArray _sdv, InputArray
     for( k = 0; k < cn; k++ )
         s[k] = sq[k] = 0;
 
-    if( blockSum )
+    int nchunks = getReduceChunks(src, mask);
+    if( nchunks > 0 )
     {
-        intSumBlockSize = 1 << 15;
-        blockSize = std::min(blockSize, intSumBlockSize);
-        sbuf = (int*)(sq + cn);
-        if( blockSqSum )
-            sqbuf = sbuf + cn;
-        for( k = 0; k < cn; k++ )
-            sbuf[k] = sqbuf[k] = 0;
+        // the sums and the sums of squares of the chunks
+        std::vector<double> partial((size_t)nchunks*cn*2, 0.);
+        std::vector<int> nzs(nchunks, 0);
         esz = src.elemSize();
-    }
-
-    for( size_t i = 0; i < it.nplanes; i++, ++it )
-    {
-        for( j = 0; j < total; j += blockSize )
+        parallel_reduce_chunks(src, mask, nchunks, [&](int c, const uchar* ptr, const uchar* mptr, int len, size_t)
         {
-            int bsz = std::min(total - j, blockSize);
-            int nz = func( ptrs[0], ptrs[1], (uchar*)sbuf, (uchar*)sqbuf, bsz, cn );
-            count += nz;
-            nz0 += nz;
-            if( blockSum && (count + blockSize >= intSumBlockSize || (i+1 >= it.nplanes && j+bsz >= total)) )
+            double *ps = &partial[(size_t)c*cn*2], *psq = ps + cn;
+            if( !blockSum )
             {
-                for( k = 0; k < cn; k++ )
+                nzs[c] += func( ptr, mptr, (uchar*)ps, (uchar*)psq, len, cn );
+                return;
+            }
+            AutoBuffer<int, 8> ibuf(cn*2);
+            int *isum = ibuf.data(), *isqsum = isum + cn;
+            for( int i = 0; i < len; i += 1 << 15 )
+            {
+                int bsz = std::min(len - i, 1 << 15);
+                for( int t = 0; t < cn*2; t++ )
+                    isum[t] = 0;
+                nzs[c] += func( ptr + i*esz, mptr ? mptr + i : 0, (uchar*)isum,
+                                blockSqSum ? (uchar*)isqsum : (uchar*)psq, bsz, cn );
+                for( int t = 0; t < cn; t++ )
                 {
-                    s[k] += sbuf[k];
-                    sbuf[k] = 0;
+                    ps[t] += isum[t];
+                    if( blockSqSum )
+                        psq[t] += isqsum[t];
                 }
-                if( blockSqSum )
+            }
+        });
+        reduceChunksTree(nchunks, [&](int i, int t)
+        {
+            for( int l = 0; l < cn*2; l++ )
+                partial[(size_t)i*cn*2 + l] += partial[(size_t)t*cn*2 + l];
+            nzs[i] += nzs[t];
+        });
+        for( k = 0; k < cn; k++ )
+        {
+            s[k] = partial[k];
+            sq[k] = partial[cn + k];
+        }
+        nz0 = nzs[0];
+    }
+    else
+    {
+        if( blockSum )
+        {
+            intSumBlockSize = 1 << 15;
+            blockSize = std::min(blockSize, intSumBlockSize);
+            sbuf = (int*)(sq + cn);
+            if( blockSqSum )
+                sqbuf = sbuf + cn;
+            for( k = 0; k < cn; k++ )
+                sbuf[k] = sqbuf[k] = 0;
+            esz = src.elemSize();
+        }
+
+        for( size_t i = 0; i < it.nplanes; i++, ++it )
+        {
+            for( j = 0; j < total; j += blockSize )
+            {
+                int bsz = std::min(total - j, blockSize);
+                int nz = func( ptrs[0], ptrs[1], (uchar*)sbuf, (uchar*)sqbuf, bsz, cn );
+                count += nz;
+                nz0 += nz;
+                if( blockSum && (count + blockSize >= intSumBlockSize || (i+1 >= it.nplanes && j+bsz >= total)) )
                 {
                     for( k = 0; k < cn; k++ )
                     {
-                        sq[k] += sqbuf[k];
-                        sqbuf[k] = 0;
+                        s[k] += sbuf[k];
+                        sbuf[k] = 0;
+                    }
+                    if( blockSqSum )
+                    {
+                        for( k = 0; k < cn; k++ )
+                        {
+                            sq[k] += sqbuf[k];
+                            sqbuf[k] = 0;
+                        }
                     }
+                    count = 0;
                 }
-                count = 0;
+                ptrs[0] += bsz*esz;
+                if( ptrs[1] )
+                    ptrs[1] += bsz;
             }
-            ptrs[0] += bsz*esz;
-            if( ptrs[1] )
-                ptrs[1] += bsz;
         }
     }
 
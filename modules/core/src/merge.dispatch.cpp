@@ -178,6 +178,24 @@ void merge(const Mat* mv, size_t n, OutputArray _dst)
     size_t total = (int)it.size;
     size_t blocksize = std::min((size_t)CV_SPLIT_MERGE_MAX_BLOCK_SIZE(cn), cn <= 4 ? total : std::min(total, blocksize0));
 
+    if( it.nplanes == 1 && total < (size_t)INT_MAX )
+    {
+        // continuous arrays: the large ones are processed by several threads
+        parallel_for_elemwise(Size((int)total, 1), esz, [&](int x, int, Size bsz)
+        {
+            AutoBuffer<const uchar*, 16> _sptrs(cn);
+            const uchar** sptrs = _sptrs.data();
+            for( size_t j = x; j < (size_t)x + bsz.width; j += blocksize )
+            {
+                size_t len = std::min((size_t)x + bsz.width - j, blocksize);
+                for( int t = 0; t < cn; t++ )
+                    sptrs[t] = ptrs[t+1] + j*esz1;
+                func( sptrs, ptrs[0] + j*esz, (int)len, cn );
+            }
+        });
+        return;
+    }
+
     for( i = 0; i < it.nplanes; i++, ++it )
     {
         for( size_t j = 0; j < total; j += blocksize )
@@ -1528,8 +1528,60 @@ void cv::minMaxIdx(InputArray _src, double* minVal,
     else if( depth == CV_64F )
         minval = (int*)&dminval, maxval = (int*)&dmaxval;
 
-    for( size_t i = 0; i < it.nplanes; i++, ++it, startidx += planeSize )
-        func( ptrs[0], ptrs[1], minval, maxval, &minidx, &maxidx, planeSize, startidx );
+    int nchunks = getReduceChunks(src, mask);
+    if( nchunks > 0 )
+    {
+        struct MinMaxChunk
+        {
+            union Value { int i; float f; double d; } minval, maxval;
+            size_t minidx, maxidx;
+        };
+        std::vector<MinMaxChunk> partial(nchunks);
+        for( int c = 0; c < nchunks; c++ )
+        {
+            MinMaxChunk& p = partial[c];
+            if( depth == CV_32F )
+                p.minval.f = fminval, p.maxval.f = fmaxval;
+            else if( depth == CV_64F )
+                p.minval.d = dminval, p.maxval.d = dmaxval;
+            else
+                p.minval.i = iminval, p.maxval.i = imaxval;
+            p.minidx = p.maxidx = 0;
+        }
+        parallel_reduce_chunks(src, mask, nchunks, [&](int c, const uchar* ptr, const uchar* mptr, int len, size_t startIdx)
+        {
+            MinMaxChunk& p = partial[c];
+            func( ptr, mptr, &p.minval.i, &p.maxval.i, &p.minidx, &p.maxidx, len*cn, startIdx*cn + 1 );
+        });
+
+        // the chunks are merged in order and only the strictly better values are taken,
+        // so the first occurrence is found as in the serial code
+        auto value = [&](const MinMaxChunk::Value& v)
+        {
+            return depth == CV_64F ? v.d : depth == CV_32F ? (double)v.f : (double)v.i;
+        };
+        reduceChunksTree(nchunks, [&](int i, int j)
+        {
+            MinMaxChunk &a = partial[i], &b = partial[j];
+            if( b.minidx != 0 && (a.minidx == 0 || value(b.minval) < value(a.minval)) )
+                a.minval = b.minval, a.minidx = b.minidx;
+            if( b.maxidx != 0 && (a.maxidx == 0 || value(b.maxval) > value(a.maxval)) )
+                a.maxval = b.maxval, a.maxidx = b.maxidx;
+        });
+        const MinMaxChunk& p = partial[0];
+        if( depth == CV_32F )
+            fminval = p.minval.f, fmaxval = p.maxval.f;
+        else if( depth == CV_64F )
+            dminval = p.minval.d, dmaxval = p.maxval.d;
+        else
+            iminval = p.minval.i, imaxval = p.maxval.i;
+        minidx = p.minidx, maxidx = p.maxidx;
+    }
+    else
+    {
+        for( size_t i = 0; i < it.nplanes; i++, ++it, startidx += planeSize )
+            func( ptrs[0], ptrs[1], minval, maxval, &minidx, &maxidx, planeSize, startidx );
+    }
 
     if (!src.empty() && mask.empty())
     {
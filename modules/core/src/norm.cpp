@@ -597,6 +597,65 @@ static bool ipp_norm(Mat &src, int normType, Mat &mask, double &result)
 }
 #endif
 
+// see parallel_reduce_chunks()
+static double normChunks(const Mat& src, const Mat& mask, int normType, int nchunks)
+{
+    int depth = src.depth(), cn = src.channels();
+    std::vector<double> partial(nchunks, 0.);
+
+    if( normType == NORM_HAMMING || normType == NORM_HAMMING2 )
+    {
+        int cellSize = normType == NORM_HAMMING ? 1 : 2;
+        parallel_reduce_chunks(src, mask, nchunks, [&](int c, const uchar* ptr, const uchar*, int len, size_t)
+        {
+            partial[c] += hal::normHamming(ptr, len, cellSize);
+        });
+    }
+    else
+    {
+        NormFunc func = getNormFunc(normType >> 1, depth);
+        CV_Assert( func != 0 );
+
+        // the integer accumulators are flushed before they overflow
+        bool intSum = (normType == NORM_L1 && depth <= CV_16S) ||
+                      ((normType == NORM_L2 || normType == NORM_L2SQR) && depth <= CV_8S);
+        int blockSize = intSum ? (normType == NORM_L1 && depth <= CV_8S ? (1 << 23) : (1 << 15))/cn : INT_MAX;
+        size_t esz = src.elemSize();
+
+        parallel_reduce_chunks(src, mask, nchunks, [&](int c, const uchar* ptr, const uchar* mptr, int len, size_t)
+        {
+            for( int j = 0; j < len; )
+            {
+                int bsz = std::min(len - j, blockSize);
+                union
+                {
+                    double d;
+                    int i;
+                    float f;
+                }
+                result;
+                result.d = 0;
+                func(ptr + j*esz, mptr ? mptr + j : 0, (uchar*)&result, bsz, cn);
+
+                if( normType == NORM_INF )
+                {
+                    double v = depth == CV_64F ? result.d : depth == CV_32F ? (double)result.f : (double)result.i;
+                    partial[c] = std::max(partial[c], v);
+                }
+                else
+                    partial[c] += intSum ? result.i : result.d;
+                j += bsz;
+            }
+        });
+    }
+
+    reduceChunksTree(nchunks, [&](int i, int j)
+    {
+        partial[i] = normType == NORM_INF ? std::max(partial[i], partial[j]) : partial[i] + partial[j];
+    });
+    return normType == NORM_L2 ? std::sqrt(partial[0]) : partial[0];
+}
+
 } // cv::
 
 double cv::norm( InputArray _src, int normType, InputArray _mask )
@@ -622,6 +681,14 @@ double cv::norm( InputArray _src, int normType, InputArray _mask )
     CV_IPP_RUN(IPP_VERSION_X100 >= 700, ipp_norm(src, normType, mask, _result), _result);
 
     int depth = src.depth(), cn = src.channels();
+    CV_Assert( mask.empty() || mask.type() == CV_8U );
+
+    // the masked Hamming norm is computed for bitwise_and(src, mask) below
+    bool hamming = normType == NORM_HAMMING || normType == NORM_HAMMING2;
+    int nchunks = depth == CV_16F || (hamming && !mask.empty()) ? 0 : getReduceChunks(src, mask);
+    if( nchunks > 0 )
+        return normChunks(src, mask, normType, nchunks);
+
     if( src.isContinuous() && mask.empty() )
     {
         size_t len = src.total()*cn;
@@ -673,9 +740,7 @@ double cv::norm( InputArray _src, int normType, InputArray _mask )
         }
     }
 
-    CV_Assert( mask.empty() || mask.type() == CV_8U );
-
-    if( normType == NORM_HAMMING || normType == NORM_HAMMING2 )
+    if( hamming )
     {
         if( !mask.empty() )
         {
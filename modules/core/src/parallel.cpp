@@ -89,6 +89,7 @@
    - HAVE_TBB         - 3rdparty library, should be explicitly enabled
    - HAVE_HPX         - 3rdparty library, should be explicitly enabled
    - HAVE_OPENMP      - integrated to compiler, should be explicitly enabled
+   - HAVE_WORKSTEALING_PF - built-in work-stealing scheduler, should be explicitly enabled
    - HAVE_GCD         - system wide, used automatically        (APPLE only)
    - WINRT            - system wide, used automatically        (Windows RT only)
    - HAVE_CONCURRENCY - part of runtime, used automatically    (Windows only - MSVS 10, MSVS 11)
@@ -119,6 +120,8 @@
 
 #elif defined HAVE_OPENMP
     #include <omp.h>
+#elif defined HAVE_WORKSTEALING_PF
+    // see parallel_workstealing.cpp
 #elif defined HAVE_GCD
     #include <dispatch/dispatch.h>
     #include <pthread.h>
@@ -135,6 +138,8 @@
 #  define CV_PARALLEL_FRAMEWORK "hpx"
 #elif defined HAVE_OPENMP
 #  define CV_PARALLEL_FRAMEWORK "openmp"
+#elif defined HAVE_WORKSTEALING_PF
+#  define CV_PARALLEL_FRAMEWORK "workstealing"
 #elif defined HAVE_GCD
 #  define CV_PARALLEL_FRAMEWORK "gcd"
 #elif defined WINRT
@@ -153,6 +158,17 @@
 
 #include "opencv2/core/detail/exception_ptr.hpp"  // CV__EXCEPTION_PTR = 1 if std::exception_ptr is available
 
+#include <fstream>
+#include <map>
+#include <typeinfo>
+#if defined __GNUC__
+#include <cxxabi.h>  // abi::__cxa_demangle
+#endif
+#if defined __GNUC__ && (defined __linux__ || defined __APPLE__)
+#include <dlfcn.h>  // dladdr
+#define CV_PARALLEL_FOR_CALLER_ADDRESS
+#endif
+
 using namespace cv;
 
 namespace cv {
@@ -161,6 +177,232 @@ ParallelLoopBody::~ParallelLoopBody() {}
 
 namespace {
 
+/* ================================   parallel_for_ statistics   ================================ */
+
+struct ParallelForSiteStatistics
+{
+    ParallelForSiteStatistics() :
+        calls(0), stripes(0), threads(0), wallTicks(0), wallTicksMax(0), busyTicks(0), idleTicks(0),
+        imbalance(0), imbalanceMax(0), wakeCount(0), wakeTicks(0), wakeTicksMax(0)
+    {}
+
+    int64 calls;
+    int64 stripes;
+    int64 threads;       // threads which have executed stripes (sum over calls)
+    int64 wallTicks;
+    int64 wallTicksMax;
+    int64 busyTicks;     // time spent in the loop body by all threads
+    int64 idleTicks;     // time of the thread pool which is not spent in the loop body
+    double imbalance;    // max / mean busy time of participating threads (sum over calls)
+    double imbalanceMax;
+    int64 wakeCount;     // number of worker threads joined the calls (the calling thread is not counted)
+    int64 wakeTicks;     // delay between the call and the first stripe executed by a worker thread
+    int64 wakeTicksMax;
+
+    void merge(const ParallelForSiteStatistics& s)
+    {
+        calls += s.calls;
+        stripes += s.stripes;
+        threads += s.threads;
+        wallTicks += s.wallTicks;
+        wallTicksMax = std::max(wallTicksMax, s.wallTicksMax);
+        busyTicks += s.busyTicks;
+        idleTicks += s.idleTicks;
+        imbalance += s.imbalance;
+        imbalanceMax = std::max(imbalanceMax, s.imbalanceMax);
+        wakeCount += s.wakeCount;
+        wakeTicks += s.wakeTicks;
+        wakeTicksMax = std::max(wakeTicksMax, s.wakeTicksMax);
+    }
+};
+
+static std::string escapeJSON(const std::string& str)
+{
+    std::string res;
+    for (size_t i = 0; i < str.size(); i++)
+    {
+        char c = str[i];
+        if (c == '"' || c == '\\')
+            res += '\\';
+        if ((unsigned char)c < ' ')
+            res += ' ';
+        else
+            res += c;
+    }
+    return res;
+}
+
+static std::string escapeCSV(const std::string& str)
+{
+    std::string res = "\"";
+    for (size_t i = 0; i < str.size(); i++)
+    {
+        if (str[i] == '"')
+            res += '"';
+        res += str[i];
+    }
+    return res + "\"";
+}
+
+class ParallelForStatistics
+{
+public:
+    ParallelForStatistics() :
+        enabled(false)
+    {
+        reportFilename = utils::getConfigurationParameterString("OPENCV_PARALLEL_FOR_STATS", "");
+        enabled = !reportFilename.empty();
+    }
+    ~ParallelForStatistics()
+    {
+        if (!reportFilename.empty() && !dump(reportFilename))
+            fprintf(stderr, "OpenCV: can't write parallel_for_() statistics: %s\n", reportFilename.c_str());
+    }
+
+    void add(const std::string& site, const ParallelForSiteStatistics& call)
+    {
+        cv::AutoLock lock(mutex);
+        sites[site].merge(call);
+    }
+
+    void reset()
+    {
+        cv::AutoLock lock(mutex);
+        sites.clear();
+    }
+
+    bool dump(const std::string& filename)
+    {
+        std::vector<std::pair<std::string, ParallelForSiteStatistics> > data;
+        {
+            cv::AutoLock lock(mutex);
+            data.assign(sites.begin(), sites.end());
+        }
+        // the most expensive call sites go first
+        std::sort(data.begin(), data.end(), compareWallTime);
+
+        std::ofstream f(filename.c_str());
+        if (!f.is_open())
+            return false;
+        const bool csv = filename.size() >= 4 &&
+            (filename.compare(filename.size() - 4, 4, ".csv") == 0 || filename.compare(filename.size() - 4, 4, ".CSV") == 0);
+        const double ms = 1000. / cv::getTickFrequency();
+        if (csv)
+            f << "site,calls,stripes,threads_avg,wall_ms,wall_ms_max,busy_ms,idle_ms,imbalance_avg,imbalance_max,wake_ms_avg,wake_ms_max\n";
+        else
+            f << "{\n  \"parallel_for\": [";
+        for (size_t i = 0; i < data.size(); i++)
+        {
+            const ParallelForSiteStatistics& s = data[i].second;
+            const double calls = (double)std::max(s.calls, (int64)1);
+            const double wakeAvg = s.wakeCount > 0 ? s.wakeTicks * ms / s.wakeCount : 0.;
+            if (csv)
+            {
+                f << escapeCSV(data[i].first) << ',' << s.calls << ',' << s.stripes << ',' << s.threads / calls << ','
+                  << s.wallTicks * ms << ',' << s.wallTicksMax * ms << ',' << s.busyTicks * ms << ',' << s.idleTicks * ms << ','
+                  << s.imbalance / calls << ',' << s.imbalanceMax << ',' << wakeAvg << ',' << s.wakeTicksMax * ms << '\n';
+            }
+            else
+            {
+                f << (i > 0 ? "," : "") << "\n    {"
+                  << " \"site\": \"" << escapeJSON(data[i].first) << "\","
+                  << " \"calls\": " << s.calls << ","
+                  << " \"stripes\": " << s.stripes << ","
+                  << " \"threads_avg\": " << s.threads / calls << ","
+                  << " \"wall_ms\": " << s.wallTicks * ms << ","
+                  << " \"wall_ms_max\": " << s.wallTicksMax * ms << ","
+                  << " \"busy_ms\": " << s.busyTicks * ms << ","
+                  << " \"idle_ms\": " << s.idleTicks * ms << ","
+                  << " \"imbalance_avg\": " << s.imbalance / calls << ","
+                  << " \"imbalance_max\": " << s.imbalanceMax << ","
+                  << " \"wake_ms_avg\": " << wakeAvg << ","
+                  << " \"wake_ms_max\": " << s.wakeTicksMax * ms << " }";
+            }
+        }
+        if (!csv)
+            f << "\n  ]\n}\n";
+        return !f.fail();
+    }
+
+    std::atomic<bool> enabled;
+
+private:
+    static bool compareWallTime(const std::pair<std::string, ParallelForSiteStatistics>& a,
+                                const std::pair<std::string, ParallelForSiteStatistics>& b)
+    {
+        return a.second.wallTicks > b.second.wallTicks;
+    }
+
+    cv::Mutex mutex;
+    std::map<std::string, ParallelForSiteStatistics> sites;
+    std::string reportFilename;
+};
+
+static ParallelForStatistics& getParallelForStatistics()
+{
+    static ParallelForStatistics instance;  // destroyed at exit to write the report
+    return instance;
+}
+
+#ifdef CV_PARALLEL_FRAMEWORK
+static std::string getDemangledName(const char* name)
+{
+#if defined __GNUC__
+    int status = 0;
+    char* demangled = abi::__cxa_demangle(name, NULL, NULL, &status);
+    if (demangled)
+    {
+        std::string res(demangled);
+        free(demangled);
+        return res;
+    }
+#endif
+    return name;
+}
+
+// the nearest exported symbol and the offset from it, or the offset in the module
+static std::string getCallerName(const void* address)
+{
+#ifdef CV_PARALLEL_FOR_CALLER_ADDRESS
+    Dl_info info;
+    if (address && dladdr(address, &info) && info.dli_fname)
+    {
+        const char* module = strrchr(info.dli_fname, '/');
+        module = module ? module + 1 : info.dli_fname;
+        if (info.dli_sname && info.dli_saddr)
+            return cv::format("%s!%s+0x%zx", module, getDemangledName(info.dli_sname).c_str(),
+                              (size_t)((const char*)address - (const char*)info.dli_saddr));
+        return cv::format("%s+0x%zx", module, (size_t)((const char*)address - (const char*)info.dli_fbase));
+    }
+#endif
+    return cv::format("%p", address);
+}
+
+static std::string getLoopBodyName(const cv::ParallelLoopBody& body, const void* caller)
+{
+    // all the lambdas share the wrapper type, so they are told apart by the calling code
+    if (caller && dynamic_cast<const ParallelLoopBodyLambdaWrapper*>(&body))
+        return getCallerName(caller);
+    return getDemangledName(typeid(body).name());
+}
+
+#ifdef OPENCV_TRACE
+static std::string getTraceCallerName(const CV_TRACE_NS::details::Region* parallelForRegion)
+{
+    if (parallelForRegion && parallelForRegion->pImpl)
+    {
+        const CV_TRACE_NS::details::Region* caller = parallelForRegion->pImpl->parentRegion;
+        if (caller && caller->pImpl)
+        {
+            const CV_TRACE_NS::details::Region::LocationStaticStorage& location = caller->pImpl->location;
+            return cv::format("%s (%s:%d)", location.name, location.filename, location.line);
+        }
+    }
+    return std::string();
+}
+#endif
+#endif // CV_PARALLEL_FRAMEWORK
+
 #ifdef CV_PARALLEL_FRAMEWORK
 #ifdef ENABLE_INSTRUMENTATION
     static void SyncNodes(cv::instr::InstrNode *pNode)
@@ -191,8 +433,10 @@ namespace {
     class ParallelLoopBodyWrapperContext
     {
     public:
-        ParallelLoopBodyWrapperContext(const cv::ParallelLoopBody& _body, const cv::Range& _r, double _nstripes) :
-            is_rng_used(false), hasException(false)
+        ParallelLoopBodyWrapperContext(const cv::ParallelLoopBody& _body, const cv::Range& _r, double _nstripes,
+                                       const void* _caller) :
+            is_rng_used(false), hasException(false), collectStatistics(false), startTicks(0), callerThreadID(-1),
+            caller(_caller)
         {
 
             body = &_body;
@@ -211,9 +455,18 @@ namespace {
 #ifdef ENABLE_INSTRUMENTATION
             pThreadRoot = cv::instr::getInstrumentTLSStruct().pCurrentNode;
 #endif
+
+            if (getParallelForStatistics().enabled)
+            {
+                collectStatistics = true;
+                callerThreadID = cv::utils::getThreadID();
+                startTicks = cv::getTickCount();
+            }
         }
         void finalize()
         {
+            if (collectStatistics)
+                finalizeStatistics();
 #ifdef ENABLE_INSTRUMENTATION
             for(size_t i = 0; i < pThreadRoot->m_childs.size(); i++)
                 SyncNodes(pThreadRoot->m_childs[i]);
@@ -257,6 +510,72 @@ namespace {
         cv::instr::InstrNode *pThreadRoot;
 #endif
         bool hasException;
+
+        struct ThreadStatistics
+        {
+            int threadID;
+            int stripes;
+            int64 firstTicks;
+            int64 busyTicks;
+        };
+        bool collectStatistics;
+        int64 startTicks;
+        int callerThreadID;
+        const void* caller;  // return address of parallel_for_(), identifies the call site
+        cv::Mutex statisticsMutex;
+        std::vector<ThreadStatistics> threadStatistics;
+
+        void recordStripe(int64 beginTicks, int64 endTicks)
+        {
+            const int threadID = cv::utils::getThreadID();
+            cv::AutoLock lock(statisticsMutex);
+            for (size_t i = 0; i < threadStatistics.size(); i++)
+            {
+                ThreadStatistics& t = threadStatistics[i];
+                if (t.threadID == threadID)
+                {
+                    t.stripes++;
+                    t.busyTicks += endTicks - beginTicks;
+                    return;
+                }
+            }
+            ThreadStatistics t = { threadID, 1, beginTicks, endTicks - beginTicks };
+            threadStatistics.push_back(t);
+        }
+
+        void finalizeStatistics()
+        {
+            ParallelForSiteStatistics call;
+            call.calls = 1;
+            call.wallTicks = call.wallTicksMax = cv::getTickCount() - startTicks;
+            call.threads = (int64)threadStatistics.size();
+            int64 busyTicksMax = 0;
+            for (size_t i = 0; i < threadStatistics.size(); i++)
+            {
+                const ThreadStatistics& t = threadStatistics[i];
+                call.stripes += t.stripes;
+                call.busyTicks += t.busyTicks;
+                busyTicksMax = std::max(busyTicksMax, t.busyTicks);
+                if (t.threadID != callerThreadID)
+                {
+                    const int64 wakeTicks = std::max(t.firstTicks - startTicks, (int64)0);
+                    call.wakeCount++;
+                    call.wakeTicks += wakeTicks;
+                    call.wakeTicksMax = std::max(call.wakeTicksMax, wakeTicks);
+                }
+            }
+            const int64 poolSize = std::max((int64)cv::getNumThreads(), call.threads);
+            call.idleTicks = std::max(call.wallTicks * poolSize - call.busyTicks, (int64)0);
+            call.imbalance = call.imbalanceMax = call.busyTicks > 0 ? (double)busyTicksMax * call.threads / call.busyTicks : 1.;
+            std::string site;
+#ifdef OPENCV_TRACE
+            site = getTraceCallerName(traceRootRegion);
+#endif
+            if (site.empty())
+                site = getLoopBodyName(*body, caller);
+            getParallelForStatistics().add(site, call);
+        }
+
 #if CV__EXCEPTION_PTR
         std::exception_ptr pException;
 #else
@@ -332,6 +651,7 @@ namespace {
             CV_TRACE_ARG_VALUE(range_end, "range.end", (int64)r.end);
 #endif
 
+            const int64 beginTicks = ctx.collectStatistics ? cv::getTickCount() : 0;
             try
             {
                 (*ctx.body)(r);
@@ -356,6 +676,9 @@ namespace {
             }
 #endif
 
+            if (ctx.collectStatistics)
+                ctx.recordStripe(beginTicks, cv::getTickCount());
+
             if (!ctx.is_rng_used && !(cv::theRNG() == ctx.rng))
                 ctx.is_rng_used = true;
         }
@@ -451,6 +774,8 @@ static inline int _initMaxThreads()
     return maxThreads;
 }
 static int numThreadsMax = _initMaxThreads();
+#elif defined HAVE_WORKSTEALING_PF
+// nothing for the work-stealing scheduler
 #elif defined HAVE_GCD
 // nothing for GCD
 #elif defined WINRT
@@ -484,7 +809,7 @@ static SchedPtr pplScheduler;
 /* ================================   parallel_for_  ================================ */
 
 #ifdef CV_PARALLEL_FRAMEWORK
-static void parallel_for_impl(const cv::Range& range, const cv::ParallelLoopBody& body, double nstripes); // forward declaration
+static void parallel_for_impl(const cv::Range& range, const cv::ParallelLoopBody& body, double nstripes, const void* caller); // forward declaration
 #endif
 
 void parallel_for_(const cv::Range& range, const cv::ParallelLoopBody& body, double nstripes)
@@ -500,6 +825,16 @@ void parallel_for_(const cv::Range& range, const cv::ParallelLoopBody& body, dou
     if (range.empty())
         return;
 
+#ifdef CV_PARALLEL_FOR_CALLER_ADDRESS
+    const void* caller = __builtin_return_address(0);
+#else
+    const void* caller = NULL;
+#endif
+
+#if defined HAVE_WORKSTEALING_PF
+    // nested calls are parallelized by the scheduler itself
+    parallel_for_impl(range, body, nstripes, caller);
+#else
 #ifdef CV_PARALLEL_FRAMEWORK
     static std::atomic<bool> flagNestedParallelFor(false);
     bool isNotNestedRegion = !flagNestedParallelFor.load();
@@ -509,7 +844,7 @@ void parallel_for_(const cv::Range& range, const cv::ParallelLoopBody& body, dou
     {
         try
         {
-            parallel_for_impl(range, body, nstripes);
+            parallel_for_impl(range, body, nstripes, caller);
             flagNestedParallelFor = false;
         }
         catch (...)
@@ -522,16 +857,18 @@ void parallel_for_(const cv::Range& range, const cv::ParallelLoopBody& body, dou
 #endif // CV_PARALLEL_FRAMEWORK
     {
         CV_UNUSED(nstripes);
+        CV_UNUSED(caller);
         body(range);
     }
+#endif // HAVE_WORKSTEALING_PF
 }
 
 #ifdef CV_PARALLEL_FRAMEWORK
-static void parallel_for_impl(const cv::Range& range, const cv::ParallelLoopBody& body, double nstripes)
+static void parallel_for_impl(const cv::Range& range, const cv::ParallelLoopBody& body, double nstripes, const void* caller)
 {
     if ((numThreads < 0 || numThreads > 1) && range.end - range.start > 1)
     {
-        ParallelLoopBodyWrapperContext ctx(body, range, nstripes);
+        ParallelLoopBodyWrapperContext ctx(body, range, nstripes, caller);
         ProxyLoopBody pbody(ctx);
         cv::Range stripeRange = pbody.stripeRange();
         if( stripeRange.end - stripeRange.start == 1 )
@@ -557,6 +894,10 @@ static void parallel_for_impl(const cv::Range& range, const cv::ParallelLoopBody
         for (int i = stripeRange.start; i < stripeRange.end; ++i)
             pbody(Range(i, i + 1));
 
+#elif defined HAVE_WORKSTEALING_PF
+
+        parallel_for_workstealing(stripeRange, pbody);
+
 #elif defined HAVE_GCD
 
         dispatch_queue_t concurrent_queue = dispatch_get_global_queue(DISPATCH_QUEUE_PRIORITY_DEFAULT, 0);
@@ -631,6 +972,9 @@ int getNumThreads(void)
            ? numThreads
            : numThreadsMax;
 
+#elif defined HAVE_WORKSTEALING_PF
+
+    return (int)parallel_workstealing_get_threads_num();
 
 #elif defined HAVE_GCD
 
@@ -704,6 +1048,10 @@ void setNumThreads( int threads_ )
 
     return; // nothing needed as num_threads clause is used in #pragma omp parallel for
 
+#elif defined HAVE_WORKSTEALING_PF
+
+    parallel_workstealing_set_threads_num(threads);
+
 #elif defined HAVE_GCD
 
     // unsupported
@@ -753,6 +1101,8 @@ int getThreadNum()
         return (int)(hpx::get_num_worker_threads());
 #elif defined HAVE_OPENMP
     return omp_get_thread_num();
+#elif defined HAVE_WORKSTEALING_PF
+    return parallel_workstealing_get_thread_num();
 #elif defined HAVE_GCD
     return (int)(size_t)(void*)pthread_self(); // no zero-based indexing
 #elif defined WINRT
@@ -971,6 +1321,31 @@ const char* currentParallelFramework() {
 #endif
 }
 
+namespace utils { namespace trace {
+
+void setParallelForStatisticsEnabled(bool enabled)
+{
+    getParallelForStatistics().enabled = enabled;
+}
+
+bool isParallelForStatisticsEnabled()
+{
+    return getParallelForStatistics().enabled;
+}
+
+bool dumpParallelForStatistics(const char* filename)
+{
+    CV_Assert(filename);
+    return getParallelForStatistics().dump(filename);
+}
+
+void resetParallelForStatistics()
+{
+    getParallelForStatistics().reset();
+}
+
+}}  // namespace cv::utils::trace
+
 }  // namespace cv::
 
 CV_IMPL void cvSetNumThreads(int nt)
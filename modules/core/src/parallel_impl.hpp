@@ -12,6 +12,11 @@ void parallel_for_pthreads(const Range& range, const ParallelLoopBody& body, dou
 size_t parallel_pthreads_get_threads_num();
 void parallel_pthreads_set_threads_num(int num);
 
+void parallel_for_workstealing(const Range& range, const ParallelLoopBody& body);
+size_t parallel_workstealing_get_threads_num();
+void parallel_workstealing_set_threads_num(int num);
+int parallel_workstealing_get_thread_num();
+
 }
 
 #endif // OPENCV_CORE_PARALLEL_IMPL_HPP
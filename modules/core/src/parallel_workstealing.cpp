@@ -0,0 +1,440 @@
+// This file is part of OpenCV project.
+// It is subject to the license terms in the LICENSE file found in the top-level directory
+// of this distribution and at http://opencv.org/license.html.
+
+#include "precomp.hpp"
+
+#include "parallel_impl.hpp"
+
+#ifdef HAVE_WORKSTEALING_PF
+
+#include <atomic>
+#include <chrono>
+#include <condition_variable>
+#include <deque>
+#include <memory>
+#include <mutex>
+#include <thread>
+
+#if defined __linux__
+#include <pthread.h>
+#include <sched.h>
+#include <cstdio>
+#include <fstream>
+#include <sstream>
+#endif
+
+#include <opencv2/core/utils/configuration.private.hpp>
+
+#include <opencv2/core/utils/logger.defines.hpp>
+#include <opencv2/core/utils/logger.hpp>
+
+/*
+  Work-stealing scheduler for parallel_for_().
+
+  Every worker thread owns a deque of tasks, a task is a range of stripes of some parallel_for_() call.
+  The thread executing a task splits it in halves (lazy binary splitting): the second half goes to
+  the back of its own deque, so idle threads can steal it from the front (thieves take the biggest
+  pieces), and the first half is processed further. Threads which wait for completion of their
+  parallel_for_() call execute available tasks in the meantime, so nested parallel_for_() calls
+  are parallelized and can't deadlock. Threads which are not owned by the scheduler share the
+  deque #0.
+
+  Workers can be pinned to NUMA nodes (OPENCV_WORKSTEALING_PIN_THREADS=1, Linux only). In this case
+  thieves look for the work on the same node first.
+*/
+
+namespace cv
+{
+
+static bool CV_WORKSTEALING_PIN_THREADS = utils::getConfigurationParameterBool("OPENCV_WORKSTEALING_PIN_THREADS", false);
+static int CV_WORKSTEALING_ACTIVE_WAIT = (int)utils::getConfigurationParameterSizeT("OPENCV_WORKSTEALING_ACTIVE_WAIT", 2000);  // iterations
+
+namespace {
+
+struct WSJob
+{
+    explicit WSJob(const ParallelLoopBody& body_, int nstripes) : body(body_), remaining(nstripes) {}
+
+    const ParallelLoopBody& body;
+    std::atomic<int> remaining;  // number of stripes which are not completed yet
+    std::mutex mutex;
+    std::condition_variable cond_complete;
+};
+
+struct WSTask
+{
+    WSJob* job;
+    Range stripes;
+};
+
+class WSDeque
+{
+public:
+    WSDeque() : count(0) {}
+
+    void push(const WSTask& task)
+    {
+        std::lock_guard<std::mutex> lock(mutex);
+        tasks.push_back(task);
+        count++;
+    }
+
+    // owner side: the most recent (and the smallest) task
+    bool pop(WSTask& task)
+    {
+        if (count.load(std::memory_order_relaxed) == 0)
+            return false;
+        std::lock_guard<std::mutex> lock(mutex);
+        if (tasks.empty())
+            return false;
+        task = tasks.back();
+        tasks.pop_back();
+        count--;
+        return true;
+    }
+
+    // thief side: the oldest (and the biggest) task
+    bool steal(WSTask& task)
+    {
+        if (count.load(std::memory_order_relaxed) == 0)
+            return false;
+        std::lock_guard<std::mutex> lock(mutex);
+        if (tasks.empty())
+            return false;
+        task = tasks.front();
+        tasks.pop_front();
+        count--;
+        return true;
+    }
+
+private:
+    std::mutex mutex;
+    std::deque<WSTask> tasks;
+    std::atomic<int> count;
+};
+
+static thread_local int wsThreadIndex = 0;  // 0 for threads which are not owned by the scheduler
+
+#if defined __linux__
+static std::vector<int> parseCPUList(const std::string& s)
+{
+    std::vector<int> cpus;
+    std::istringstream ss(s);
+    std::string item;
+    while (std::getline(ss, item, ','))
+    {
+        int first = -1, last = -1;
+        if (sscanf(item.c_str(), "%d-%d", &first, &last) == 2)
+        {
+            for (int i = first; i <= last; i++)
+                cpus.push_back(i);
+        }
+        else if (first >= 0)
+            cpus.push_back(first);
+    }
+    return cpus;
+}
+
+// CPUs of every NUMA node which are available for the process
+static std::vector<std::vector<int> > getNUMANodesCPUs()
+{
+    std::vector<std::vector<int> > nodes;
+    cpu_set_t available;
+    CPU_ZERO(&available);
+    if (sched_getaffinity(0, sizeof(available), &available) != 0)
+        return nodes;
+    for (int node = 0; ; node++)
+    {
+        std::ifstream f(cv::format("/sys/devices/system/node/node%d/cpulist", node).c_str());
+        if (!f.is_open())
+            break;
+        std::string line;
+        std::getline(f, line);
+        std::vector<int> cpus, nodeCPUs = parseCPUList(line);
+        for (size_t i = 0; i < nodeCPUs.size(); i++)
+        {
+            if (nodeCPUs[i] < CPU_SETSIZE && CPU_ISSET(nodeCPUs[i], &available))
+                cpus.push_back(nodeCPUs[i]);
+        }
+        if (!cpus.empty())
+            nodes.push_back(cpus);
+    }
+    return nodes;
+}
+#endif
+
+class WorkStealingScheduler
+{
+public:
+    static WorkStealingScheduler& instance()
+    {
+        CV_SINGLETON_LAZY_INIT_REF(WorkStealingScheduler, new WorkStealingScheduler())
+    }
+
+    WorkStealingScheduler()
+        : num_threads(defaultNumberOfThreads()), pending_tasks(0), sleeping_workers(0),
+          active_jobs(0), stopping(false)
+    {}
+
+    ~WorkStealingScheduler()
+    {
+        reconfigure_(0);
+    }
+
+    void run(const Range& range, const ParallelLoopBody& body);
+
+    unsigned getNumOfThreads() const { return num_threads; }
+
+    void setNumOfThreads(unsigned n)
+    {
+        if (n == num_threads)
+            return;
+        num_threads = n;
+        std::lock_guard<std::mutex> lock(config_mutex);
+        if (active_jobs == 0 && n <= 1)
+            reconfigure_(0);  // stop worker threads immediately
+    }
+
+private:
+    void reconfigure_(unsigned new_workers_count);  // requires config_mutex or exclusive access
+    void workerLoop(int idx);
+    bool findTask(int idx, WSTask& task);
+    void execute(int idx, WSTask task);
+    void pushTask(int idx, const WSTask& task);
+
+    std::atomic<unsigned> num_threads;  // including the calling thread
+
+    std::vector<std::thread> workers;
+    std::vector<std::unique_ptr<WSDeque> > deques;  // #0 is shared by all non-worker threads
+    std::vector<int> deque_node;  // NUMA node of the deque owner, -1 if the owner isn't pinned
+    std::vector<std::vector<int> > victims;  // stealing order for every deque owner
+
+    std::mutex sleep_mutex;
+    std::condition_variable cond_wake;
+    std::atomic<int> pending_tasks;
+    std::atomic<int> sleeping_workers;
+
+    std::mutex config_mutex;  // guards the set of workers
+    int active_jobs;
+    std::atomic<bool> stopping;
+};
+
+void WorkStealingScheduler::reconfigure_(unsigned new_workers_count)
+{
+    if (new_workers_count == workers.size())
+        return;
+    if (!workers.empty())
+    {
+        {
+            std::lock_guard<std::mutex> lock(sleep_mutex);
+            stopping = true;
+        }
+        cond_wake.notify_all();
+        for (size_t i = 0; i < workers.size(); i++)
+            workers[i].join();
+        workers.clear();
+        stopping = false;
+    }
+    CV_Assert(pending_tasks == 0);
+
+    const int n = (int)new_workers_count + 1;
+    deques.clear();
+    for (int i = 0; i < n; i++)
+        deques.push_back(std::unique_ptr<WSDeque>(new WSDeque()));
+
+    std::vector<std::vector<int> > nodes;
+#if defined __linux__
+    if (CV_WORKSTEALING_PIN_THREADS)
+        nodes = getNUMANodesCPUs();
+#endif
+    deque_node.assign(n, -1);
+    if (!nodes.empty())
+    {
+        for (int i = 1; i < n; i++)
+            deque_node[i] = (i - 1) % (int)nodes.size();
+    }
+
+    // same node first, then the others in the round-robin order
+    victims.assign(n, std::vector<int>());
+    for (int i = 0; i < n; i++)
+    {
+        for (int pass = 0; pass < 2; pass++)
+        {
+            for (int k = 1; k < n; k++)
+            {
+                int j = (i + k) % n;
+                bool sameNode = deque_node[i] >= 0 && deque_node[i] == deque_node[j];
+                if (sameNode == (pass == 0))
+                    victims[i].push_back(j);
+            }
+        }
+    }
+
+    for (int i = 1; i < n; i++)
+    {
+        workers.push_back(std::thread(&WorkStealingScheduler::workerLoop, this, i));
+#if defined __linux__
+        if (deque_node[i] >= 0)
+        {
+            const std::vector<int>& cpus = nodes[deque_node[i]];
+            cpu_set_t cpuset;
+            CPU_ZERO(&cpuset);
+            for (size_t k = 0; k < cpus.size(); k++)
+                CPU_SET(cpus[k], &cpuset);
+            int res = pthread_setaffinity_np(workers.back().native_handle(), sizeof(cpuset), &cpuset);
+            if (res != 0)
+                CV_LOG_WARNING(NULL, "Work-stealing scheduler: can't pin worker " << i << " to NUMA node " << deque_node[i]);
+        }
+#endif
+    }
+    CV_LOG_VERBOSE(NULL, 1, "Work-stealing scheduler: " << workers.size() << " workers, "
+                   << std::max((size_t)1, nodes.size()) << " NUMA node(s)");
+}
+
+void WorkStealingScheduler::pushTask(int idx, const WSTask& task)
+{
+    deques[idx]->push(task);
+    pending_tasks++;
+    if (sleeping_workers > 0)
+    {
+        std::lock_guard<std::mutex> lock(sleep_mutex);
+        cond_wake.notify_one();
+    }
+}
+
+bool WorkStealingScheduler::findTask(int idx, WSTask& task)
+{
+    bool found = deques[idx]->pop(task);
+    const std::vector<int>& order = victims[idx];
+    for (size_t k = 0; !found && k < order.size(); k++)
+        found = deques[order[k]]->steal(task);
+    if (found)
+        pending_tasks--;
+    return found;
+}
+
+void WorkStealingScheduler::execute(int idx, WSTask task)
+{
+    Range r = task.stripes;
+    while (r.size() > 1)
+    {
+        int mid = r.start + r.size() / 2;
+        WSTask rest = { task.job, Range(mid, r.end) };
+        pushTask(idx, rest);
+        r.end = mid;
+    }
+    WSJob& job = *task.job;
+    job.body(r);  // exceptions are handled by the body wrapper (see parallel.cpp)
+
+    // the job object may be destroyed as soon as the last stripe is reported,
+    // so the counter is updated under the lock which the waiting thread acquires on exit
+    std::lock_guard<std::mutex> lock(job.mutex);
+    if (job.remaining.fetch_sub(r.size()) == r.size())
+        job.cond_complete.notify_all();
+}
+
+void WorkStealingScheduler::workerLoop(int idx)
+{
+    wsThreadIndex = idx;
+    for (;;)
+    {
+        WSTask task;
+        if (findTask(idx, task))
+        {
+            execute(idx, task);
+            continue;
+        }
+        for (int i = 0; i < CV_WORKSTEALING_ACTIVE_WAIT && pending_tasks == 0 && !stopping; i++)
+            std::this_thread::yield();
+        if (pending_tasks > 0)
+            continue;
+
+        std::unique_lock<std::mutex> lock(sleep_mutex);
+        if (stopping && pending_tasks == 0)
+            break;
+        sleeping_workers++;
+        cond_wake.wait(lock, [&]() { return stopping || pending_tasks > 0; });
+        sleeping_workers--;
+    }
+}
+
+void WorkStealingScheduler::run(const Range& range, const ParallelLoopBody& body)
+{
+    {
+        std::lock_guard<std::mutex> lock(config_mutex);
+        unsigned n = num_threads;
+        if (active_jobs == 0 && workers.size() + 1 != std::max(n, 1u))
+            reconfigure_(std::max(n, 1u) - 1);
+        if (workers.empty())
+        {
+            // single thread mode, or workers can't be started yet because of running jobs
+            body(range);
+            return;
+        }
+        active_jobs++;
+    }
+
+    // stripes of other jobs executed by this thread replace its RNG state
+    RNG rng = theRNG();
+
+    int idx = wsThreadIndex;
+    WSJob job(body, range.size());
+    WSTask root = { &job, range };
+    pushTask(idx, root);
+
+    // help others until the job is completed
+    int spins = 0;
+    while (job.remaining > 0)
+    {
+        WSTask task;
+        if (findTask(idx, task))
+        {
+            execute(idx, task);
+            spins = 0;
+        }
+        else if (spins++ < CV_WORKSTEALING_ACTIVE_WAIT)
+        {
+            std::this_thread::yield();
+        }
+        else
+        {
+            // wake up periodically to check for new tasks (nested calls of the other threads)
+            std::unique_lock<std::mutex> lock(job.mutex);
+            job.cond_complete.wait_for(lock, std::chrono::milliseconds(1), [&]() { return job.remaining == 0; });
+        }
+    }
+    {
+        std::lock_guard<std::mutex> lock(job.mutex);  // see the comment in execute()
+    }
+    theRNG() = rng;
+
+    std::lock_guard<std::mutex> lock(config_mutex);
+    active_jobs--;
+}
+
+} // namespace
+
+void parallel_for_workstealing(const Range& range, const ParallelLoopBody& body)
+{
+    WorkStealingScheduler::instance().run(range, body);
+}
+
+size_t parallel_workstealing_get_threads_num()
+{
+    return WorkStealingScheduler::instance().getNumOfThreads();
+}
+
+void parallel_workstealing_set_threads_num(int num)
+{
+    WorkStealingScheduler::instance().setNumOfThreads(num < 0 ? 0 : (unsigned)num);
+}
+
+int parallel_workstealing_get_thread_num()
+{
+    return wsThreadIndex;
+}
+
+} // namespace cv
+
+#endif // HAVE_WORKSTEALING_PF
@@ -307,6 +307,84 @@ static inline double readReal(const uchar* p)
 #endif
 }
 
+// returns the header of the raw data referenced by the block node, see FileStorage::Impl::addBlockNode().
+// The iterators over the block node stay at the header, which starts with FS_BLOCK_NODE tag alone
+static inline const uchar* getBlockHeader(const uchar* p)
+{
+    CV_DbgAssert( (*p & FS_BLOCK_NODE) != 0 );
+    return p + ((*p & FileNode::NAMED) ? 5 : 1) + 8;
+}
+
+static inline bool isBlockHeader(const uchar* p)
+{
+    return *p == FS_BLOCK_NODE;
+}
+
+// returns the raw data of the block header
+static const uchar* getBlockData(const uchar* p, size_t& len, const char*& dt)
+{
+    CV_DbgAssert( isBlockHeader(p) );
+    const uchar* data = 0;
+    uint64 len64 = 0;
+    memcpy(&data, p + 1, sizeof(data));
+    memcpy(&len64, p + 9, sizeof(len64));
+    len = (size_t)len64;
+    dt = (const char*)(p + 17);
+    return data;
+}
+
+namespace fs
+{
+
+template<typename T> static inline T readRawValue(const uchar* data)
+{
+    T val;
+    memcpy(&val, data, sizeof(val));
+    return val;
+}
+
+int readRawElem( const uchar* data, int elem_type, int& ival, double& fval )
+{
+    switch( elem_type )
+    {
+    case CV_8U: ival = *data; return FileNode::INT;
+    case CV_8S: ival = *(const schar*)data; return FileNode::INT;
+    case CV_16U: ival = readRawValue<ushort>(data); return FileNode::INT;
+    case CV_16S: ival = readRawValue<short>(data); return FileNode::INT;
+    case CV_32S: ival = readRawValue<int>(data); return FileNode::INT;
+    case CV_32F: fval = readRawValue<float>(data); return FileNode::REAL;
+    case CV_64F: fval = readRawValue<double>(data); return FileNode::REAL;
+    case CV_16F: fval = (float)readRawValue<float16_t>(data); return FileNode::REAL;
+    default:
+        CV_Error( Error::StsUnsupportedFormat, "Unsupported type" );
+    }
+    return FileNode::NONE;
+}
+
+}
+
+// reads the element of the raw data block, returns FileNode::INT or FileNode::REAL
+static int readBlockElem(const uchar* block, const int* fmt_pairs, int fmt_pair_count,
+                         size_t esz, size_t nprims, size_t idx, int& ival, double& fval)
+{
+    const uchar* data = block + idx/nprims*esz;
+    size_t i = idx % nprims, offset = 0;
+    for( int k = 0; k < fmt_pair_count; k++ )
+    {
+        int elem_type = fmt_pairs[k*2+1];
+        size_t elem_size = CV_ELEM_SIZE(elem_type), count = fmt_pairs[k*2];
+        offset = alignSize( offset, (int)elem_size );
+        if( i >= count )
+        {
+            i -= count;
+            offset += count*elem_size;
+            continue;
+        }
+        return fs::readRawElem( data + offset + i*elem_size, elem_type, ival, fval );
+    }
+    return FileNode::NONE;
+}
+
 static inline void writeInt(uchar* p, int ival)
 {
 #if CV_UNALIGNED_LITTLE_ENDIAN_MEM_ACCESS
@@ -376,6 +454,8 @@ public:
 
         filename.clear();
         lineno = 0;
+
+        binaryStorage.reset();
     }
 
     Impl(FileStorage* _fs)
@@ -446,7 +526,7 @@ public:
         }
     }
 
-    bool open( const char* filename_or_buf, int _flags, const char* encoding )
+    bool open( const char* filename_or_buf, int _flags, const char* encoding, size_t bufsize=0 )
     {
         _flags &= ~FileStorage::BASE64;
 
@@ -479,6 +559,10 @@ public:
         if( mem_mode && append )
             CV_Error( CV_StsBadFlag, "FileStorage::APPEND and FileStorage::MEMORY are not currently compatible" );
 
+        bool binary = write_mode && (_flags & FileStorage::FORMAT_MASK) == FileStorage::FORMAT_BINARY;
+        if( binary && append )
+            CV_Error( CV_StsNotImplemented, "Appending data to binary file storage is not implemented" );
+
         flags = _flags;
 
         if( !mem_mode )
@@ -501,7 +585,7 @@ public:
 
             if( !isGZ )
             {
-                file = fopen(filename.c_str(), !write_mode ? "rt" : !append ? "wt" : "a+t" );
+                file = fopen(filename.c_str(), !write_mode ? "rt" : append ? "a+t" : binary ? "wb" : "wt" );
                 if( !file )
                     return false;
             }
@@ -649,6 +733,10 @@ public:
 
                 emitter = createYAMLEmitter(this);
             }
+            else if( fmt == FileStorage::FORMAT_BINARY )
+            {
+                emitter = createBinaryEmitter(this);
+            }
             else
             {
                 CV_Assert( fmt == FileStorage::FORMAT_JSON );
@@ -713,6 +801,8 @@ public:
                 fmt = FileStorage::FORMAT_JSON;
             else if(strncmp( bufPtr, xml_signature, strlen(xml_signature) ) == 0)
                 fmt = FileStorage::FORMAT_XML;
+            else if(isBinaryStorageSignature( buf ))
+                fmt = FileStorage::FORMAT_BINARY;
             else if(strbufsize  == bufOffset)
                 CV_Error(CV_BADARG_ERR, "Input file is invalid");
             else
@@ -740,6 +830,11 @@ public:
                     case FileStorage::FORMAT_XML: parser = createXMLParser(this); break;
                     case FileStorage::FORMAT_YAML: parser = createYAMLParser(this); break;
                     case FileStorage::FORMAT_JSON: parser = createJSONParser(this); break;
+                    case FileStorage::FORMAT_BINARY:
+                        loadBinaryStorage(bufsize);
+                        parser = createBinaryParser(this, binaryStorage->size);
+                        ptr = (char*)binaryStorage->data;
+                        break;
                     default: parser = Ptr<FileStorageParser>();
                 }
 
@@ -792,6 +887,66 @@ public:
             CV_Error( CV_StsError, "The storage is not opened" );
     }
 
+    void putBytes( const void* data, size_t len )
+    {
+        CV_Assert( write_mode );
+        const char* ptr = (const char*)data;
+        if( mem_mode )
+            std::copy(ptr, ptr + len, std::back_inserter(outbuf));
+        else if( file )
+        {
+            if( fwrite( ptr, 1, len, file ) != len )
+                CV_Error( CV_StsError, "Can't write to the file storage" );
+        }
+#if USE_ZLIB
+        else if( gzfile )
+        {
+            for( size_t ofs = 0; ofs < len; )
+            {
+                unsigned count = (unsigned)std::min(len - ofs, (size_t)INT_MAX);
+                if( gzwrite( gzfile, ptr + ofs, count ) != (int)count )
+                    CV_Error( CV_StsError, "Can't write to the file storage" );
+                ofs += count;
+            }
+        }
+#endif
+        else
+            CV_Error( CV_StsError, "The storage is not opened" );
+    }
+
+    // reads the whole binary storage; the regular files are memory-mapped
+    void loadBinaryStorage( size_t bufsize )
+    {
+        if( mem_mode )
+            binaryStorage = copyBinaryStorage(strbuf, bufsize ? bufsize : strbufsize);
+        else if( file )
+        {
+            closeFile();
+            binaryStorage = cv::loadBinaryStorage(filename);
+        }
+#if USE_ZLIB
+        else if( gzfile )
+        {
+            std::vector<char> content;
+            gzrewind( gzfile );
+            for(;;)
+            {
+                size_t ofs = content.size();
+                content.resize(ofs + (1 << 20));
+                int count = gzread( gzfile, &content[ofs], 1 << 20 );
+                if( count < 0 )
+                    CV_Error( CV_StsError, "Can't read the compressed file storage" );
+                content.resize(ofs + count);
+                if( count == 0 )
+                    break;
+            }
+            binaryStorage = copyBinaryStorage(content.data(), content.size());
+        }
+#endif
+        else
+            CV_Error( CV_StsError, "The storage is not opened" );
+    }
+
     char* getsFromFile( char* buf, int count )
     {
         if( file )
@@ -1055,6 +1210,8 @@ public:
 
         size_t elemSize = fs::calcStructSize(dt.c_str(), 0);
         CV_Assert( len % elemSize == 0 );
+        if( emitter->writeRawData(dt.c_str(), _data, len) )
+            return;
         len /= elemSize;
 
         bool explicitZero = fmt == FileStorage::FORMAT_JSON;
@@ -1443,6 +1600,95 @@ public:
         return node;
     }
 
+    // adds the sequence node, which references the raw data block instead of storing the elements.
+    // The elements can be read by readRaw() only
+    FileNode addBlockNode( FileNode& collection, const std::string& key,
+                           const char* dt, const uchar* data, size_t len )
+    {
+        FileStorage_API* fs = this;
+        int fmt_pairs[CV_FS_MAX_FMT_PAIRS*2];
+        int fmt_pair_count = fs::decodeFormat( dt, fmt_pairs, CV_FS_MAX_FMT_PAIRS );
+        size_t esz = fs::calcStructSize( dt, 0 ), nelems = 0;
+        for( int k = 0; k < fmt_pair_count; k++ )
+            nelems += fmt_pairs[k*2];
+        nelems *= len / esz;
+        if( nelems > (size_t)INT_MAX )
+            CV_PARSE_ERROR_CPP( "Too many elements in the raw data block" );
+
+        FileNode node = addNode( collection, key, FileNode::NONE, 0, -1 );
+        bool named = node.isNamed();
+        size_t dtlen = strlen(dt);
+        size_t rawSize = 4 + 1 + 8 + 8 + dtlen + 1;
+        uchar* ptr = reserveNodeSpace( node, 1 + (named ? 4 : 0) + 4 + rawSize );
+        *ptr++ = (uchar)(FileNode::SEQ | FS_BLOCK_NODE | (named ? FileNode::NAMED : 0));
+        if( named )
+            ptr += 4;
+        // raw_size, nelems and the block header: the tag, data pointer, size in bytes and the format
+        uint64 len64 = len;
+        writeInt( ptr, (int)rawSize );
+        writeInt( ptr + 4, (int)nelems );
+        ptr[8] = (uchar)FS_BLOCK_NODE;
+        memset( ptr + 9, 0, 8 );
+        memcpy( ptr + 9, &data, sizeof(data) );
+        memcpy( ptr + 17, &len64, sizeof(len64) );
+        memcpy( ptr + 25, dt, dtlen + 1 );
+        return node;
+    }
+
+    // reads the matrix from FORMAT_BINARY storage without copying the data
+    bool readBlockMat( const FileNode& node, Mat& m ) const
+    {
+        if( !binaryStorage || !node.isMap() )
+            return false;
+        FileNode data_node = node["data"];
+        const uchar* p = data_node.ptr();
+        if( !p || !(*p & FS_BLOCK_NODE) )
+            return false;
+
+        std::string dt;
+        cv::read( node["dt"], dt, std::string() );
+        if( dt.empty() )
+            return false;
+        int elem_type = fs::decodeSimpleFormat( dt.c_str() );
+
+        size_t len = 0;
+        const char* block_dt = 0;
+        const uchar* data = getBlockData( getBlockHeader(p), len, block_dt );
+        int fmt_pairs[CV_FS_MAX_FMT_PAIRS*2];
+        if( fs::decodeFormat( block_dt, fmt_pairs, CV_FS_MAX_FMT_PAIRS ) != 1 ||
+            fmt_pairs[1] != CV_MAT_DEPTH(elem_type) )
+            return false;
+
+        int sizes[CV_MAX_DIM] = {0}, dims = 2, rows = -1;
+        cv::read( node["rows"], rows, -1 );
+        if( rows >= 0 )
+        {
+            sizes[0] = rows;
+            cv::read( node["cols"], sizes[1], -1 );
+        }
+        else
+        {
+            FileNode sizes_node = node["sizes"];
+            dims = (int)sizes_node.size();
+            if( dims < 1 || dims > CV_MAX_DIM )
+                return false;
+            sizes_node.readRaw( "i", sizes, dims*sizeof(sizes[0]) );
+        }
+
+        size_t total = CV_ELEM_SIZE(elem_type);
+        for( int i = 0; i < dims; i++ )
+        {
+            if( sizes[i] < 0 )
+                return false;
+            total *= sizes[i];
+        }
+        if( total != len || total == 0 )
+            return false;
+
+        m = createBinaryStorageView( binaryStorage, data, dims, sizes, elem_type );
+        return true;
+    }
+
     void finalizeCollection( FileNode& collection )
     {
         if( !collection.isSeq() && !collection.isMap() )
@@ -1781,6 +2027,8 @@ public:
     size_t strbufsize;
     size_t strbufpos;
     int lineno;
+
+    std::shared_ptr<BinaryStorageData> binaryStorage;  //!< content of FORMAT_BINARY storage
 };
 
 FileStorage::FileStorage()
@@ -1793,7 +2041,7 @@ FileStorage::FileStorage(const String& filename, int flags, const String& encodi
     : state(0)
 {
     p = makePtr<FileStorage::Impl>(this);
-    bool ok = p->open(filename.c_str(), flags, encoding.c_str());
+    bool ok = p->open(filename.c_str(), flags, encoding.c_str(), filename.size());
     if(ok)
         state = FileStorage::NAME_EXPECTED + FileStorage::INSIDE_MAP;
 }
@@ -1825,7 +2073,7 @@ bool FileStorage::open(const String& filename, int flags, const String& encoding
 {
     try
     {
-        bool ok = p->open(filename.c_str(), flags, encoding.c_str());
+        bool ok = p->open(filename.c_str(), flags, encoding.c_str(), filename.size());
         if(ok)
             state = FileStorage::NAME_EXPECTED + FileStorage::INSIDE_MAP;
         return ok;
@@ -2249,7 +2497,13 @@ std::string FileNode::string() const
     size_t sz = (size_t)(unsigned)readInt(p);
     return std::string((const char*)(p + 4), sz - 1);
 }
-Mat FileNode::mat() const { Mat value; read(*this, value, Mat()); return value; }
+Mat FileNode::mat() const
+{
+    Mat value;
+    if( !fs || !fs->readBlockMat(*this, value) )
+        read(*this, value, Mat());
+    return value;
+}
 
 FileNodeIterator FileNode::begin() const { return FileNodeIterator(*this, false); }
 FileNodeIterator FileNode::end() const   { return FileNodeIterator(*this, true); }
@@ -2399,7 +2653,14 @@ FileNodeIterator::FileNodeIterator( const FileNode& node, bool seekEnd )
             const uchar* p0 = node.ptr(), *p = p0 + 1;
             if(*p0 & FileNode::NAMED )
                 p += 4;
-            if( !seekEnd )
+            if( *p0 & FS_BLOCK_NODE )
+            {
+                // the elements are stored in the raw data block, the iterator stays at the block header
+                ofs += (p - p0) + 8;
+                if( seekEnd )
+                    idx = nodeNElems;
+            }
+            else if( !seekEnd )
                 ofs += (p - p0) + 8;
             else
             {
@@ -2436,6 +2697,9 @@ FileNodeIterator& FileNodeIterator::operator=(const FileNodeIterator& it)
 
 FileNode FileNodeIterator::operator *() const
 {
+    if( idx < nodeNElems && isBlockHeader(fs->getNodePtr(blockIdx, ofs)) )
+        CV_Error( Error::StsNotImplemented,
+                  "The elements of the binary storage data block can be read using readRaw() or FileNode::mat() only" );
     return FileNode(idx < nodeNElems ? fs : NULL, blockIdx, ofs);
 }
 
@@ -2443,8 +2707,10 @@ FileNodeIterator& FileNodeIterator::operator ++ ()
 {
     if( idx == nodeNElems || !fs )
         return *this;
-    idx++;
     FileNode n(fs, blockIdx, ofs);
+    idx++;
+    if( isBlockHeader(n.ptr()) )
+        return *this;
     ofs += n.rawSize();
     if( ofs >= blockSize )
     {
@@ -2481,6 +2747,32 @@ FileNodeIterator& FileNodeIterator::readRaw( const String& fmt, void* _data0, si
         CV_Assert( maxsz % esz == 0 );
         maxsz /= esz;
 
+        const uchar* block = 0;
+        int block_pairs[CV_FS_MAX_FMT_PAIRS*2];
+        int block_pair_count = 0;
+        size_t block_esz = 0, block_nprims = 0;
+        bool rawBlock = isBlockHeader( fs->getNodePtr(blockIdx, ofs) );
+        if( rawBlock )
+        {
+            size_t len = 0;
+            const char* block_dt = 0;
+            block = getBlockData( fs->getNodePtr(blockIdx, ofs), len, block_dt );
+            block_pair_count = fs::decodeFormat( block_dt, block_pairs, CV_FS_MAX_FMT_PAIRS );
+            block_esz = fs::calcStructSize( block_dt, 0 );
+            for( int k = 0; k < block_pair_count; k++ )
+                block_nprims += block_pairs[k*2];
+
+            // the same layout: copy the whole structures
+            if( block_pair_count == fmt_pair_count && block_esz == esz && idx % block_nprims == 0 &&
+                memcmp(block_pairs, fmt_pairs, fmt_pair_count*2*sizeof(fmt_pairs[0])) == 0 )
+            {
+                size_t count = std::min(maxsz, (nodeNElems - idx)/block_nprims);
+                memcpy( data0, block + idx/block_nprims*esz, count*esz );
+                idx += count*block_nprims;
+                return *this;
+            }
+        }
+
         for( ; maxsz > 0; maxsz--, data0 += esz )
         {
             size_t offset = 0;
@@ -2495,10 +2787,27 @@ FileNodeIterator& FileNodeIterator::readRaw( const String& fmt, void* _data0, si
 
                 for( int i = 0; i < count; i++, ++(*this) )
                 {
-                    FileNode node = *(*this);
-                    if( node.isInt() )
+                    int ival = 0;
+                    double fval = 0;
+                    int node_type = FileNode::NONE;
+                    if( rawBlock )
+                    {
+                        if( idx < nodeNElems )
+                            node_type = readBlockElem( block, block_pairs, block_pair_count,
+                                                       block_esz, block_nprims, idx, ival, fval );
+                    }
+                    else
+                    {
+                        FileNode node = *(*this);
+                        node_type = node.type();
+                        if( node_type == FileNode::INT )
+                            ival = (int)node;
+                        else if( node_type == FileNode::REAL )
+                            fval = (double)node;
+                    }
+
+                    if( node_type == FileNode::INT )
                     {
-                        int ival = (int)node;
                         switch( elem_type )
                         {
                         case CV_8U:
@@ -2537,10 +2846,8 @@ FileNodeIterator& FileNodeIterator::readRaw( const String& fmt, void* _data0, si
                             CV_Error( Error::StsUnsupportedFormat, "Unsupported type" );
                         }
                     }
-                    else if( node.isReal() )
+                    else if( node_type == FileNode::REAL )
                     {
-                        double fval = (double)node;
-
                         switch( elem_type )
                         {
                         case CV_8U:
@@ -11,6 +11,7 @@
 #include <sstream>
 #include <string>
 #include <iterator>
+#include <memory>
 
 #define USE_ZLIB 1
 #if USE_ZLIB
@@ -94,6 +95,8 @@ int calcElemSize( const char* dt, int initial_size );
 char* encodeFormat( int elem_type, char* dt );
 int decodeFormat( const char* dt, int* fmt_pairs, int max_len );
 int decodeSimpleFormat( const char* dt );
+// reads the element of the raw data, which is not necessarily aligned; returns FileNode::INT or FileNode::REAL
+int readRawElem( const uchar* data, int elem_type, int& ival, double& fval );
 }
 
 
@@ -114,6 +117,22 @@ int decodeSimpleFormat( const char* dt );
 class FileStorageParser;
 class FileStorageEmitter;
 
+//! tag flag of the sequence node which references the raw data block of FileStorage::FORMAT_BINARY storage
+//! instead of storing the elements as the separate nodes. Only the matrix data is stored this way
+enum { FS_BLOCK_NODE = 64 };
+
+//! content of FileStorage::FORMAT_BINARY storage, memory-mapped when possible.
+//! It is shared with the matrices returned by FileNode::mat(), so they remain valid after the storage is released.
+class BinaryStorageData
+{
+public:
+    BinaryStorageData() : data(0), size(0) {}
+    virtual ~BinaryStorageData() {}
+
+    const uchar* data;
+    size_t size;
+};
+
 struct FStructData
 {
     FStructData() { indent = flags = 0; }
@@ -137,6 +156,7 @@ public:
     virtual FileStorage* getFS() = 0;
 
     virtual void puts( const char* str ) = 0;
+    virtual void putBytes( const void* data, size_t len ) = 0;
     virtual char* gets() = 0;
     virtual bool eof() = 0;
     virtual void setEof() = 0;
@@ -157,6 +177,8 @@ public:
     virtual FileNode addNode( FileNode& collection, const std::string& key,
                                int type, const void* value=0, int len=-1 ) = 0;
     virtual void finalizeCollection( FileNode& collection ) = 0;
+    virtual FileNode addBlockNode( FileNode& collection, const std::string& key,
+                                   const char* dt, const uchar* data, size_t len ) = 0;
     virtual double strtod(char* ptr, char** endptr) = 0;
 
     virtual char* parseBase64(char* ptr, int indent, FileNode& collection) = 0;
@@ -179,6 +201,8 @@ public:
     virtual void writeScalar(const char* key, const char* value) = 0;
     virtual void writeComment(const char* comment, bool eol_comment) = 0;
     virtual void startNextStream() = 0;
+    //! returns false if the raw data should be written element by element using writeScalar()
+    virtual bool writeRawData(const char* /*dt*/, const void* /*data*/, size_t /*len*/) { return false; }
 };
 
 class FileStorageParser
@@ -192,10 +216,18 @@ public:
 Ptr<FileStorageEmitter> createXMLEmitter(FileStorage_API* fs);
 Ptr<FileStorageEmitter> createYAMLEmitter(FileStorage_API* fs);
 Ptr<FileStorageEmitter> createJSONEmitter(FileStorage_API* fs);
+Ptr<FileStorageEmitter> createBinaryEmitter(FileStorage_API* fs);
 
 Ptr<FileStorageParser> createXMLParser(FileStorage_API* fs);
 Ptr<FileStorageParser> createYAMLParser(FileStorage_API* fs);
 Ptr<FileStorageParser> createJSONParser(FileStorage_API* fs);
+Ptr<FileStorageParser> createBinaryParser(FileStorage_API* fs, size_t size);
+
+bool isBinaryStorageSignature(const char* buf);
+std::shared_ptr<BinaryStorageData> loadBinaryStorage(const std::string& filename);
+std::shared_ptr<BinaryStorageData> copyBinaryStorage(const void* data, size_t size);
+Mat createBinaryStorageView(const std::shared_ptr<BinaryStorageData>& storage, const uchar* data,
+                            int dims, const int* sizes, int type);
 
 }
 
@@ -0,0 +1,530 @@
+// This file is part of OpenCV project.
+// It is subject to the license terms in the LICENSE file found in the top-level directory
+// of this distribution and at http://opencv.org/license.html
+
+#include "precomp.hpp"
+#include "persistence.hpp"
+
+#if defined(__unix__) || defined(__APPLE__)
+#  define OPENCV_FS_USE_MMAP 1
+#  include <fcntl.h>
+#  include <sys/mman.h>
+#  include <sys/stat.h>
+#  include <unistd.h>
+#endif
+
+/*
+ The binary storage (FileStorage::FORMAT_BINARY) is a signature followed by the records:
+
+   <tag:u8> [<key length:u32> <key>] <value>
+
+ The tag is FileNode::INT (int32 value), REAL (float64 value), STRING (<length:u32> <chars>),
+ SEQ or MAP (the elements follow up to the END record), END, NEXT_STREAM or RAW. The key is
+ present if the tag has FileNode::NAMED flag, i.e. for the elements of mappings. RAW record is
+ the data passed to FileStorage::writeRaw():
+
+   RAW <dt length:u8> <dt> <size:u64> [<zero padding>] <data>
+
+ The data blocks of at least BINARY_MIN_BLOCK_SIZE bytes are aligned by BINARY_BLOCK_ALIGN
+ within the file, so when the data of a matrix (the "data" sequence next to "dt" and "rows" or
+ "sizes") consists of a single block, it is not parsed element by element, but referenced from
+ the file storage node and read directly from the memory-mapped file. The other sequences are
+ parsed into the regular nodes, so their elements can be accessed by index. The numbers are stored in the native byte order of the
+ writer (the raw blocks are used in place), so the files are not portable between little-endian
+ and big-endian platforms.
+*/
+
+namespace cv
+{
+
+static const char binarySignature[] = "%OPENCV-BIN:1.0\n";
+
+enum { BINARY_SIGNATURE_SIZE = 16, BINARY_BLOCK_ALIGN = 64, BINARY_MIN_BLOCK_SIZE = 256 };
+
+// record tags besides FileNode::INT, REAL, STRING, SEQ and MAP
+enum { BINARY_END = 6, BINARY_RAW = 7, BINARY_NEXT_STREAM = 8 };
+
+bool isBinaryStorageSignature(const char* buf)
+{
+    return buf && memcmp(buf, binarySignature, BINARY_SIGNATURE_SIZE) == 0;
+}
+
+class BinaryEmitter : public FileStorageEmitter
+{
+public:
+    BinaryEmitter(FileStorage_API* _fs) : fs(_fs), pos(0)
+    {
+        // the signature is written here, so the file offsets of the data blocks are known
+        putBytes(binarySignature, BINARY_SIGNATURE_SIZE);
+    }
+    virtual ~BinaryEmitter() {}
+
+    FStructData startWriteStruct( const FStructData& parent, const char* key,
+                                  int struct_flags, const char* /*type_name*/ )
+    {
+        struct_flags = (struct_flags & (FileNode::TYPE_MASK|FileNode::FLOW)) | FileNode::EMPTY;
+        if( !FileNode::isCollection(struct_flags))
+            CV_Error( CV_StsBadArg,
+                     "Some collection type - FileNode::SEQ or FileNode::MAP, must be specified" );
+
+        putTag( parent, key, FileNode::isMap(struct_flags) ? FileNode::MAP : FileNode::SEQ );
+        return FStructData("", struct_flags, 0);
+    }
+
+    void endWriteStruct(const FStructData& current_struct)
+    {
+        CV_Assert( FileNode::isCollection(current_struct.flags) );
+        uchar tag = BINARY_END;
+        putBytes( &tag, 1 );
+    }
+
+    void write(const char* key, int value)
+    {
+        putTag( fs->getCurrentStruct(), key, FileNode::INT );
+        putBytes( &value, sizeof(value) );
+    }
+
+    void write( const char* key, double value )
+    {
+        putTag( fs->getCurrentStruct(), key, FileNode::REAL );
+        putBytes( &value, sizeof(value) );
+    }
+
+    void write(const char* key, const char* str, bool /*quote*/)
+    {
+        putTag( fs->getCurrentStruct(), key, FileNode::STRING );
+        putString( str ? str : "" );
+    }
+
+    void writeScalar(const char* key, const char* data)
+    {
+        write( key, data, false );
+    }
+
+    void writeComment(const char* /*comment*/, bool /*eol_comment*/)
+    {
+    }
+
+    void startNextStream()
+    {
+        uchar tag = BINARY_NEXT_STREAM;
+        putBytes( &tag, 1 );
+    }
+
+    bool writeRawData(const char* dt, const void* data, size_t len)
+    {
+        if( !FileNode::isSeq(fs->getCurrentStruct().flags) )
+            CV_Error( CV_StsError, "The raw data can only be written to a sequence" );
+        if( len == 0 )
+            return true;
+
+        size_t dtlen = strlen(dt);
+        CV_Assert( 0 < dtlen && dtlen < 256 );
+        uchar header[2] = { (uchar)BINARY_RAW, (uchar)dtlen };
+        uint64 size = len;
+        putBytes( header, sizeof(header) );
+        putBytes( dt, dtlen );
+        putBytes( &size, sizeof(size) );
+
+        if( len >= BINARY_MIN_BLOCK_SIZE )
+        {
+            static const uchar zeros[BINARY_BLOCK_ALIGN] = {0};
+            putBytes( zeros, alignSize(pos, BINARY_BLOCK_ALIGN) - pos );
+        }
+        putBytes( data, len );
+        fs->setNonEmpty();
+        return true;
+    }
+
+protected:
+    void putTag( const FStructData& parent, const char* key, int tag )
+    {
+        bool named = key && *key;
+        if( FileNode::isMap(parent.flags) && !named )
+            CV_Error( CV_StsError, "An attempt to add element without a key to a map" );
+        if( FileNode::isSeq(parent.flags) && named )
+            CV_Error( CV_StsError, "An attempt to add element with a key to a sequence" );
+
+        uchar t = (uchar)(tag | (named ? FileNode::NAMED : 0));
+        putBytes( &t, 1 );
+        if( named )
+            putString( key );
+        fs->setNonEmpty();
+    }
+
+    void putString( const char* str )
+    {
+        size_t len = strlen(str);
+        CV_Assert( len <= UINT_MAX );
+        unsigned len32 = (unsigned)len;
+        putBytes( &len32, sizeof(len32) );
+        putBytes( str, len );
+    }
+
+    void putBytes( const void* data, size_t len )
+    {
+        if( len == 0 )
+            return;
+        fs->putBytes( data, len );
+        pos += len;
+    }
+
+    FileStorage_API* fs;
+    size_t pos;  // the number of bytes written so far
+};
+
+
+class BinaryParser : public FileStorageParser
+{
+public:
+    BinaryParser(FileStorage_API* _fs, size_t _size) : fs(_fs), size(_size), begin(0), end(0)
+    {
+    }
+
+    virtual ~BinaryParser() {}
+
+    bool parse( char* ptr )
+    {
+        if( !ptr || size < BINARY_SIGNATURE_SIZE || !isBinaryStorageSignature(ptr) )
+            CV_PARSE_ERROR_CPP( "Invalid input" );
+
+        begin = (const uchar*)ptr;
+        end = begin + size;
+        const uchar* p = begin + BINARY_SIGNATURE_SIZE;
+
+        FileNode root_collection(fs->getFS(), 0, 0);
+        do
+        {
+            FileNode root_node = fs->addNode(root_collection, std::string(), FileNode::MAP);
+            p = parseCollection( p, root_node, true );
+        }
+        while( p < end );
+
+        return true;
+    }
+
+    bool getBase64Row(char* /*ptr*/, int /*indent*/, char* &/*beg*/, char* &/*end*/)
+    {
+        return false;
+    }
+
+protected:
+    const uchar* parseCollection( const uchar* p, FileNode& node, bool root )
+    {
+        bool ismap = node.isMap();
+        bool matHeader = false, matSizes = false;  // see cv::write(FileStorage&, const String&, const Mat&)
+        for(;;)
+        {
+            if( p >= end )
+            {
+                if( !root )
+                    CV_PARSE_ERROR_CPP( "Unexpected end of the storage" );
+                break;
+            }
+
+            int tag = *p++;
+            int type = tag & ~FileNode::NAMED;
+            if( type == BINARY_END || type == BINARY_NEXT_STREAM )
+            {
+                if( root != (type == BINARY_NEXT_STREAM) )
+                    CV_PARSE_ERROR_CPP( "Unexpected end of the collection" );
+                break;
+            }
+
+            std::string key;
+            if( tag & FileNode::NAMED )
+                p = getString( p, key );
+            if( key.empty() == ismap )
+                CV_PARSE_ERROR_CPP( ismap ? "Map element should have a name" :
+                                    "Sequence element should not have name" );
+            if( ismap )
+            {
+                matHeader = matHeader || (key == "dt" && type == FileNode::STRING);
+                matSizes = matSizes || key == "rows" || key == "sizes";
+            }
+
+            switch( type )
+            {
+            case FileNode::INT:
+            {
+                int ival = 0;
+                checkSize( p, sizeof(ival) );
+                memcpy( &ival, p, sizeof(ival) );
+                p += sizeof(ival);
+                fs->addNode( node, key, FileNode::INT, &ival );
+                break;
+            }
+            case FileNode::REAL:
+            {
+                double fval = 0;
+                checkSize( p, sizeof(fval) );
+                memcpy( &fval, p, sizeof(fval) );
+                p += sizeof(fval);
+                fs->addNode( node, key, FileNode::REAL, &fval );
+                break;
+            }
+            case FileNode::STRING:
+            {
+                std::string sval;
+                p = getString( p, sval );
+                fs->addNode( node, key, FileNode::STRING, sval.c_str(), (int)sval.size() );
+                break;
+            }
+            case FileNode::SEQ:
+            case FileNode::MAP:
+            {
+                if( type == FileNode::SEQ && matHeader && matSizes && key == "data" &&
+                    p < end && *p == BINARY_RAW )
+                {
+                    // a single large block of the matrix data is referenced by the node instead of parsing it
+                    std::string dt;
+                    const uchar* data = 0;
+                    size_t len = 0;
+                    const uchar* next = getRawData( p, dt, data, len );
+                    if( len >= BINARY_MIN_BLOCK_SIZE && next < end && *next == BINARY_END )
+                    {
+                        fs->addBlockNode( node, key, dt.c_str(), data, len );
+                        p = next + 1;
+                        break;
+                    }
+                }
+                FileNode child = fs->addNode( node, key, type );
+                p = parseCollection( p, child, false );
+                break;
+            }
+            case BINARY_RAW:
+            {
+                if( ismap )
+                    CV_PARSE_ERROR_CPP( "Map element should have a name" );
+                std::string dt;
+                const uchar* data = 0;
+                size_t len = 0;
+                p = getRawData( p - 1, dt, data, len );
+                addRawDataElements( node, dt.c_str(), data, len );
+                break;
+            }
+            default:
+                CV_PARSE_ERROR_CPP( "Unknown record type" );
+            }
+        }
+
+        fs->finalizeCollection( node );
+        return p;
+    }
+
+    // parses RAW record, returns the pointer to the next record
+    const uchar* getRawData( const uchar* p, std::string& dt, const uchar*& data, size_t& len )
+    {
+        CV_Assert( *p == BINARY_RAW );
+        p++;
+        checkSize( p, 1 );
+        size_t dtlen = *p++;
+        checkSize( p, dtlen + sizeof(uint64) );
+        dt.assign( (const char*)p, dtlen );
+        p += dtlen;
+        uint64 size64 = 0;
+        memcpy( &size64, p, sizeof(size64) );
+        p += sizeof(size64);
+
+        if( dt.empty() || size64 > (uint64)(end - p) )
+            CV_PARSE_ERROR_CPP( "Invalid raw data record" );
+        len = (size_t)size64;
+        size_t esz = (size_t)fs::calcStructSize( dt.c_str(), 0 );
+        if( len % esz != 0 )
+            CV_PARSE_ERROR_CPP( "The size of raw data does not match the format" );
+
+        if( len >= BINARY_MIN_BLOCK_SIZE )
+            p = begin + alignSize( (size_t)(p - begin), BINARY_BLOCK_ALIGN );
+        checkSize( p, len );
+        data = p;
+        return p + len;
+    }
+
+    // the data blocks, which are mixed with other elements or split, are stored in the nodes
+    void addRawDataElements( FileNode& collection, const char* dt, const uchar* data0, size_t len )
+    {
+        int fmt_pairs[CV_FS_MAX_FMT_PAIRS*2];
+        int fmt_pair_count = fs::decodeFormat( dt, fmt_pairs, CV_FS_MAX_FMT_PAIRS );
+        size_t esz = (size_t)fs::calcStructSize( dt, 0 );
+
+        for( size_t n = len / esz; n > 0; n--, data0 += esz )
+        {
+            size_t offset = 0;
+            for( int k = 0; k < fmt_pair_count; k++ )
+            {
+                int elem_type = fmt_pairs[k*2+1];
+                int elem_size = CV_ELEM_SIZE(elem_type);
+                int count = fmt_pairs[k*2];
+                offset = alignSize( offset, elem_size );
+                const uchar* data = data0 + offset;
+
+                for( int i = 0; i < count; i++, data += elem_size )
+                {
+                    int ival = 0;
+                    double fval = 0;
+                    int node_type = fs::readRawElem( data, elem_type, ival, fval );
+                    fs->addNode( collection, std::string(), node_type,
+                                 node_type == FileNode::INT ? (const void*)&ival : (const void*)&fval );
+                }
+                offset = (size_t)(data - data0);
+            }
+        }
+    }
+
+    const uchar* getString( const uchar* p, std::string& str )
+    {
+        unsigned len = 0;
+        checkSize( p, sizeof(len) );
+        memcpy( &len, p, sizeof(len) );
+        p += sizeof(len);
+        checkSize( p, len );
+        str.assign( (const char*)p, len );
+        return p + len;
+    }
+
+    void checkSize( const uchar* p, size_t len )
+    {
+        if( len > (size_t)(end - p) )
+            CV_PARSE_ERROR_CPP( "Unexpected end of the storage" );
+    }
+
+    FileStorage_API* fs;
+    size_t size;
+    const uchar* begin;
+    const uchar* end;
+};
+
+
+namespace {
+
+class BinaryStorageBuffer CV_FINAL : public BinaryStorageData
+{
+public:
+    explicit BinaryStorageBuffer(size_t _size)
+    {
+        buf = (uchar*)fastMalloc(std::max(_size, (size_t)1));
+        data = buf;
+        size = _size;
+    }
+    ~BinaryStorageBuffer() { fastFree(buf); }
+
+    uchar* buf;
+};
+
+#ifdef OPENCV_FS_USE_MMAP
+class MappedBinaryStorage CV_FINAL : public BinaryStorageData
+{
+public:
+    MappedBinaryStorage(void* _addr, size_t _size) : addr(_addr)
+    {
+        data = (const uchar*)addr;
+        size = _size;
+    }
+    ~MappedBinaryStorage() { munmap(addr, size); }
+
+    void* addr;
+};
+#endif
+
+// the matrices, which reference the content of the binary storage
+class BinaryStorageAllocator CV_FINAL : public MatAllocator
+{
+public:
+    UMatData* allocate(int /*dims*/, const int* /*sizes*/, int /*type*/, void* /*data*/, size_t* /*step*/,
+                       AccessFlag /*flags*/, UMatUsageFlags /*usageFlags*/) const CV_OVERRIDE
+    {
+        CV_Error(Error::StsNotImplemented, "");
+    }
+
+    bool allocate(UMatData* u, AccessFlag /*accessFlags*/, UMatUsageFlags /*usageFlags*/) const CV_OVERRIDE
+    {
+        return u != 0;
+    }
+
+    void deallocate(UMatData* u) const CV_OVERRIDE
+    {
+        if(!u)
+            return;
+        CV_Assert(u->urefcount == 0);
+        CV_Assert(u->refcount == 0);
+        delete u;  // releases the storage
+    }
+};
+
+static BinaryStorageAllocator* getBinaryStorageAllocator()
+{
+    CV_SINGLETON_LAZY_INIT(BinaryStorageAllocator, new BinaryStorageAllocator())
+}
+
+} // namespace
+
+std::shared_ptr<BinaryStorageData> copyBinaryStorage(const void* data, size_t size)
+{
+    std::shared_ptr<BinaryStorageBuffer> storage = std::make_shared<BinaryStorageBuffer>(size);
+    if( size > 0 )
+        memcpy( storage->buf, data, size );
+    return storage;
+}
+
+std::shared_ptr<BinaryStorageData> loadBinaryStorage(const std::string& filename)
+{
+#ifdef OPENCV_FS_USE_MMAP
+    int fd = ::open( filename.c_str(), O_RDONLY );
+    if( fd >= 0 )
+    {
+        struct stat st;
+        void* addr = MAP_FAILED;
+        size_t size = 0;
+        if( fstat(fd, &st) == 0 && st.st_size > 0 )
+        {
+            size = (size_t)st.st_size;
+            // private mapping: the matrices returned by FileNode::mat() can be modified,
+            // the file is not affected
+            addr = mmap( 0, size, PROT_READ | PROT_WRITE, MAP_PRIVATE, fd, 0 );
+        }
+        ::close( fd );
+        if( addr != MAP_FAILED )
+            return std::make_shared<MappedBinaryStorage>(addr, size);
+    }
+#endif
+    FILE* f = fopen( filename.c_str(), "rb" );
+    if( !f )
+        CV_Error_( Error::StsError, ("Can't open the file storage '%s'", filename.c_str()) );
+    fseek( f, 0, SEEK_END );
+    long size = ftell( f );
+    fseek( f, 0, SEEK_SET );
+    std::shared_ptr<BinaryStorageBuffer> storage = std::make_shared<BinaryStorageBuffer>((size_t)std::max(size, 0L));
+    size_t count = size > 0 ? fread( storage->buf, 1, (size_t)size, f ) : 0;
+    fclose( f );
+    if( count != storage->size )
+        CV_Error_( Error::StsError, ("Can't read the file storage '%s'", filename.c_str()) );
+    return storage;
+}
+
+Mat createBinaryStorageView(const std::shared_ptr<BinaryStorageData>& storage, const uchar* data,
+                            int dims, const int* sizes, int type)
+{
+    CV_Assert( storage && storage->data <= data && data < storage->data + storage->size );
+
+    Mat m( dims, sizes, type, (void*)data );
+    UMatData* u = new UMatData(getBinaryStorageAllocator());
+    u->data = u->origdata = m.data;
+    u->size = m.total()*m.elemSize();
+    u->flags |= UMatData::USER_ALLOCATED;
+    u->allocatorContext = storage;
+    u->refcount = 1;
+    m.u = u;
+    return m;
+}
+
+Ptr<FileStorageEmitter> createBinaryEmitter(FileStorage_API* fs)
+{
+    return makePtr<BinaryEmitter>(fs);
+}
+
+Ptr<FileStorageParser> createBinaryParser(FileStorage_API* fs, size_t size)
+{
+    return makePtr<BinaryParser>(fs, size);
+}
+
+}
@@ -251,6 +251,13 @@ Size getContinuousSize2D(Mat& m1, int widthScale=1);
 Size getContinuousSize2D(Mat& m1, Mat& m2, int widthScale=1);
 Size getContinuousSize2D(Mat& m1, Mat& m2, Mat& m3, int widthScale=1);
 
+// Runs the element-wise operation over the large arrays by several threads.
+// The region (as returned by getContinuousSize2D()) is split into the horizontal stripes,
+// or into the pieces of the single row for the continuous arrays; body(x, y, size) processes
+// the sub-region starting at the column x and the row y. unitSize is the size (in bytes)
+// of the width unit of the largest array. Small arrays are processed by the calling thread.
+void parallel_for_elemwise(Size sz, size_t unitSize, const std::function<void(int, int, Size)>& body);
+
 void setSize( Mat& m, int _dims, const int* _sz, const size_t* _steps, bool autoSteps=false );
 void finalizeHdr(Mat& m);
 int updateContinuityFlag(int flags, int dims, const int* size, const size_t* step);
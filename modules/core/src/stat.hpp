@@ -38,6 +38,26 @@ template <typename T> Scalar ocl_part_sum(Mat m)
 typedef int (*SumFunc)(const uchar*, const uchar* mask, uchar*, int, int);
 SumFunc getSumFunc(int depth);
 
+// Deterministic parallel reductions. The elements are split into the chunks of the fixed size,
+// which doesn't depend on the number of threads. The partial results of the chunks are combined
+// in the same order by reduceChunksTree(), so the result is bit-exact for any number of threads.
+
+// the number of the chunks; 0 if the array is too small or can't be split (the serial code is used then)
+int getReduceChunks(const Mat& src, const Mat& mask);
+
+// body(chunk, src, mask, len, startIdx) is called for the pieces of the chunks (one piece per row
+// of the chunk) in parallel; len and startIdx (the linear index of the first element) are in elements
+typedef std::function<void(int, const uchar*, const uchar*, int, size_t)> ReduceChunkBody;
+void parallel_reduce_chunks(const Mat& src, const Mat& mask, int nchunks, const ReduceChunkBody& body);
+
+// pairwise reduction; combine(i, j) merges the chunk j into the chunk i < j, the result is in the chunk 0
+template<typename Combine> inline void reduceChunksTree(int nchunks, Combine combine)
+{
+    for( int step = 1; step < nchunks; step *= 2 )
+        for( int i = 0; i + step < nchunks; i += step*2 )
+            combine(i, i + step);
+}
+
 }
 
 #endif // SRC_STAT_HPP
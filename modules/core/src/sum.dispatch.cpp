@@ -26,6 +26,40 @@ SumFunc getSumFunc(int depth)
         CV_CPU_DISPATCH_MODES_ALL);
 }
 
+#define CV_REDUCE_CHUNK_SIZE (1 << 16)
+
+int getReduceChunks(const Mat& src, const Mat& mask)
+{
+    CV_Assert( mask.empty() || mask.size == src.size );
+    if( src.dims > 2 && !(src.isContinuous() && (mask.empty() || mask.isContinuous())) )
+        return 0;
+    size_t total = src.total(), nchunks = (total + CV_REDUCE_CHUNK_SIZE - 1) / CV_REDUCE_CHUNK_SIZE;
+    return nchunks >= 2 && nchunks <= (size_t)INT_MAX ? (int)nchunks : 0;
+}
+
+void parallel_reduce_chunks(const Mat& src, const Mat& mask, int nchunks, const ReduceChunkBody& body)
+{
+    // the continuous arrays are processed as a single row, it doesn't change the partitioning
+    bool continuous = src.isContinuous() && (mask.empty() || mask.isContinuous());
+    size_t total = src.total(), cols = continuous ? total : (size_t)src.cols, esz = src.elemSize();
+
+    parallel_for_(Range(0, nchunks), [&](const Range& r)
+    {
+        for( int c = r.start; c < r.end; c++ )
+        {
+            size_t e = (size_t)c*CV_REDUCE_CHUNK_SIZE, e1 = std::min(total, e + CV_REDUCE_CHUNK_SIZE);
+            while( e < e1 )
+            {
+                int y = (int)(e / cols);
+                size_t x = e - y*cols;
+                int len = (int)std::min(cols - x, e1 - e);
+                body(c, src.ptr(y) + x*esz, mask.empty() ? 0 : mask.ptr(y) + x, len, e);
+                e += len;
+            }
+        }
+    }, nchunks);
+}
+
 #ifdef HAVE_OPENCL
 
 bool ocl_sum( InputArray _src, Scalar & res, int sum_op, InputArray _mask,
@@ -200,6 +234,32 @@ Scalar sum(InputArray _src)
     SumFunc func = getSumFunc(depth);
     CV_Assert( cn <= 4 && func != 0 );
 
+    int nchunks = getReduceChunks(src, Mat());
+    if( nchunks > 0 )
+    {
+        std::vector<Scalar> partial(nchunks);
+        int intSumBlockSize = depth <= CV_8S ? (1 << 23) : (1 << 15);
+        size_t esz = src.elemSize();
+        parallel_reduce_chunks(src, Mat(), nchunks, [&](int c, const uchar* ptr, const uchar*, int len, size_t)
+        {
+            Scalar& ps = partial[c];
+            if( depth >= CV_32S )
+            {
+                func( ptr, 0, (uchar*)&ps[0], len, cn );
+                return;
+            }
+            for( int j = 0; j < len; j += intSumBlockSize )
+            {
+                int bsz = std::min(len - j, intSumBlockSize), buf[4] = {0, 0, 0, 0};
+                func( ptr + j*esz, 0, (uchar*)buf, bsz, cn );
+                for( int i = 0; i < cn; i++ )
+                    ps[i] += buf[i];
+            }
+        });
+        reduceChunksTree(nchunks, [&](int i, int j) { partial[i] += partial[j]; });
+        return partial[0];
+    }
+
     const Mat* arrays[] = {&src, 0};
     uchar* ptrs[1] = {};
     NAryMatIterator it(arrays, ptrs);
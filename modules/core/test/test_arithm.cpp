@@ -2456,4 +2456,109 @@ TEST(Core_MinMaxIdx, rows_overflow)
 }
 
 
+TEST(Core_Arithm, parallel_large_arrays)
+{
+    // the large arrays are processed by several threads, results must be the same
+    RNG& rng = theRNG();
+    Mat a0(1200, 1601, CV_8UC3), b0(1200, 1601, CV_8UC3), f0(1200, 1601, CV_32FC3);
+    rng.fill(a0, RNG::UNIFORM, 0, 256);
+    rng.fill(b0, RNG::UNIFORM, 0, 256);
+    rng.fill(f0, RNG::UNIFORM, -1000, 1000);
+
+    for (int roi = 0; roi < 2; roi++)
+    {
+        SCOPED_TRACE(roi ? "ROI" : "continuous");
+        Rect r = roi ? Rect(1, 3, 1590, 1190) : Rect(0, 0, a0.cols, a0.rows);
+        Mat a = a0(r), b = b0(r), f = f0(r);
+
+        std::vector<Mat> results[2];
+        const int nthreads[] = { 1, 4 };
+        for (int t = 0; t < 2; t++)
+        {
+            ThreadsScope threads(nthreads[t]);
+            std::vector<Mat>& res = results[t];
+            Mat d;
+            cv::add(a, b, d); res.push_back(d.clone());
+            cv::multiply(a, b, d, 0.3); res.push_back(d.clone());
+            cv::bitwise_xor(a, b, d); res.push_back(d.clone());
+            cv::compare(a, b, d, CMP_GE); res.push_back(d.clone());
+            f.convertTo(d, CV_16S, 0.7); res.push_back(d.clone());
+            cv::convertScaleAbs(f, d, 0.2); res.push_back(d.clone());
+            cv::transpose(f, d); res.push_back(d.clone());
+            std::vector<Mat> planes;
+            cv::split(f, planes);
+            res.insert(res.end(), planes.begin(), planes.end());
+            cv::merge(planes, d); res.push_back(d.clone());
+        }
+
+        ASSERT_EQ(results[0].size(), results[1].size());
+        for (size_t i = 0; i < results[0].size(); i++)
+            EXPECT_EQ(0, cvtest::norm(results[0][i], results[1][i], NORM_INF)) << i;
+        // reference
+        EXPECT_EQ(0, cvtest::norm(results[1].back(), f, NORM_INF));
+        Mat ft;
+        cvtest::transpose(f, ft);
+        EXPECT_EQ(0, cvtest::norm(results[1][6], ft, NORM_INF));
+    }
+}
+
+
+TEST(Core_Arithm, reductions_reproducible)
+{
+    // the partitioning of the reductions doesn't depend on the number of threads,
+    // so the results must be bit-exact
+    RNG& rng = theRNG();
+    const int types[] = { CV_8UC1, CV_16SC3, CV_32SC1, CV_32FC1, CV_32FC4, CV_64FC1 };
+    for (size_t k = 0; k < sizeof(types)/sizeof(types[0]); k++)
+    {
+        int type = types[k], cn = CV_MAT_CN(type);
+        SCOPED_TRACE(cv::format("type=%d", type));
+        Mat a0(1003, 1201, type), mask(1000, 1190, CV_8U);
+        rng.fill(a0, RNG::UNIFORM, -1000, 1000);
+        rng.fill(mask, RNG::UNIFORM, 0, 2);
+        Mat a = a0(Rect(5, 2, 1190, 1000));
+
+        std::vector<double> results[2];
+        const int nthreads[] = { 1, 4 };
+        for (int t = 0; t < 2; t++)
+        {
+            ThreadsScope threads(nthreads[t]);
+            std::vector<double>& res = results[t];
+            Scalar s = cv::sum(a), m = cv::mean(a, mask), mm, sd;
+            cv::meanStdDev(a, mm, sd, mask);
+            for (int c = 0; c < cn; c++)
+            {
+                res.push_back(s[c]);
+                res.push_back(m[c]);
+                res.push_back(mm[c]);
+                res.push_back(sd[c]);
+            }
+            res.push_back(cv::norm(a, NORM_L1));
+            res.push_back(cv::norm(a, NORM_L2, mask));
+            res.push_back(cv::norm(a, NORM_INF));
+            if (cn == 1)
+            {
+                double minv = 0, maxv = 0;
+                Point minLoc, maxLoc;
+                cv::minMaxLoc(a, &minv, &maxv, &minLoc, &maxLoc, mask);
+                res.push_back(minv);
+                res.push_back(maxv);
+                res.push_back(minLoc.x + minLoc.y*a.cols);
+                res.push_back(maxLoc.x + maxLoc.y*a.cols);
+                res.push_back(cv::countNonZero(a));
+            }
+        }
+
+        ASSERT_EQ(results[0].size(), results[1].size());
+        for (size_t i = 0; i < results[0].size(); i++)
+            EXPECT_EQ(results[0][i], results[1][i]) << i;
+        // reference
+        Scalar m = cvtest::mean(a, mask);
+        for (int c = 0; c < cn; c++)
+            EXPECT_NEAR(results[1][c*4 + 1], m[c], 1e-6*(fabs(m[c]) + 1000));
+        double l1 = cvtest::norm(a, NORM_L1);
+        EXPECT_NEAR(results[1][cn*4], l1, 1e-6*l1);
+    }
+}
+
 }} // namespace
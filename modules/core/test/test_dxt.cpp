@@ -983,4 +983,68 @@ protected:
 TEST(Core_DFT, reverse) { Core_DXTReverseTest test(Core_DXTReverseTest::ModeDFT); test.safe_run(); }
 TEST(Core_DCT, reverse) { Core_DXTReverseTest test(Core_DXTReverseTest::ModeDCT); test.safe_run(); }
 
+// the large arrays are transformed by several threads
+TEST(Core_DFT, large_parallel)
+{
+    RNG& rng = theRNG();
+    for( int k = 0; k < 4; k++ )
+    {
+        bool inv = (k & 1) != 0, rows = (k & 2) != 0;
+        int flags = (inv ? DFT_INVERSE : 0) | (rows ? DFT_ROWS : 0);
+        Mat big(310, 280, CV_64FC2);
+        cvtest::randUni(rng, big, Scalar::all(-1.), Scalar::all(1.));
+        Mat src = big(Rect(5, 3, 256, 300));  // not continuous
+        Mat dst, ref;
+        cv::dft(src, dst, flags);
+        DFT_2D(src, ref, flags);
+        EXPECT_LE(cvtest::norm(dst, ref, NORM_INF), 1e-8*cvtest::norm(ref, NORM_INF)) << "flags=" << flags;
+    }
+
+    Mat src(300, 258, CV_32F), srcc, dst, ref;
+    cvtest::randUni(rng, src, Scalar::all(-1.), Scalar::all(1.));
+    Mat planes[] = { src, Mat::zeros(src.size(), CV_32F) };
+    cv::merge(planes, 2, srcc);
+    cv::dft(src, dst, DFT_COMPLEX_OUTPUT);
+    DFT_2D(srcc, ref, 0);
+    EXPECT_LE(cvtest::norm(dst, ref, NORM_INF), 1e-4*cvtest::norm(ref, NORM_INF));
+
+    Mat back;
+    cv::dft(dst, back, DFT_INVERSE | DFT_SCALE | DFT_REAL_OUTPUT);
+    EXPECT_LE(cvtest::norm(back, src, NORM_INF), 1e-4);
+}
+
+typedef testing::TestWithParam<tuple<int, int> > Core_DFTPlan;
+
+TEST_P(Core_DFTPlan, same_as_dft)
+{
+    int type = get<0>(GetParam()), flags = get<1>(GetParam());
+    Size sz(120, 98);
+    Ptr<DFTPlan> plan = DFTPlan::create(sz, type, flags);
+    RNG& rng = theRNG();
+    for( int iter = 0; iter < 3; iter++ )
+    {
+        Mat src(sz, type), dst, ref;
+        cvtest::randUni(rng, src, Scalar::all(-1.), Scalar::all(1.));
+        plan->apply(src, dst);
+        cv::dft(src, ref, flags);
+        ASSERT_EQ(ref.type(), dst.type());
+        EXPECT_EQ(0, cvtest::norm(dst, ref, NORM_INF));
+
+        if( dst.type() == src.type() )
+        {
+            Mat inplace = src.clone();
+            plan->apply(inplace, inplace);
+            EXPECT_EQ(0, cvtest::norm(inplace, ref, NORM_INF));
+        }
+    }
+
+    Mat wrong(sz.height, sz.width + 1, type), dst;
+    EXPECT_ANY_THROW(plan->apply(wrong, dst));
+}
+
+INSTANTIATE_TEST_CASE_P(/**/, Core_DFTPlan, testing::Combine(
+    testing::Values(CV_32FC1, CV_32FC2, CV_64FC1, CV_64FC2),
+    testing::Values(0, DFT_ROWS, DFT_SCALE, DFT_INVERSE | DFT_SCALE, DFT_COMPLEX_OUTPUT,
+                    DFT_INVERSE | DFT_REAL_OUTPUT)));
+
 }} // namespace
@@ -1798,6 +1798,108 @@ TEST(Core_InputOutput, FileStorage_open_empty_16823)
     EXPECT_EQ(0, remove(fname.c_str()));
 }
 
+TEST(Core_InputOutput, FileStorage_binary_format)
+{
+    RNG& rng = theRNG();
+    Mat m2d(120, 50, CV_32FC3), m3d, roi, big(64, 64, CV_64F);
+    rng.fill(m2d, RNG::UNIFORM, -100, 100);
+    int sizes[] = { 4, 5, 8 };
+    m3d.create(3, sizes, CV_16S);
+    rng.fill(m3d, RNG::UNIFORM, -1000, 1000);
+    rng.fill(big, RNG::UNIFORM, 0, 1);
+    roi = big(Rect(3, 2, 40, 50));  // not continuous
+
+    std::vector<int> ivec = { 1, -2, 3 };
+    std::vector<int> lvec(100);
+    for (size_t i = 0; i < lvec.size(); i++)
+        lvec[i] = (int)(i*i) - 50;
+    std::vector<Point2f> pts(100);
+    for (size_t i = 0; i < pts.size(); i++)
+        pts[i] = Point2f((float)i, (float)i*0.5f);
+    std::vector<KeyPoint> kpts = { KeyPoint(1.f, 2.f, 3.f, 4.f, 5.f, 6, 7) };
+
+    const std::string fname = tempfile(".bin");
+    const std::string fname_gz = tempfile(".bin.gz");
+    for (int mode = 0; mode < 3; mode++)
+    {
+        const bool mem = mode == 2;
+        const std::string& name = mode == 1 ? fname_gz : fname;
+        FileStorage fs(mem ? std::string("storage.bin") : name,
+                       FileStorage::WRITE + FileStorage::FORMAT_BINARY + (mem ? FileStorage::MEMORY : 0));
+        ASSERT_TRUE(fs.isOpened());
+        EXPECT_EQ(FileStorage::FORMAT_BINARY, fs.getFormat());
+        fs << "ival" << 42 << "fval" << 0.25 << "str" << "text";
+        fs << "map" << "{" << "a" << 1 << "b" << "[" << 2 << 3.5 << "]" << "}";
+        fs << "ivec" << ivec << "lvec" << lvec << "pts" << pts << "kpts" << kpts;
+        fs << "m2d" << m2d << "m3d" << m3d << "roi" << roi;
+        std::string content = mem ? fs.releaseAndGetString() : std::string();
+        fs.release();
+
+        ASSERT_TRUE(fs.open(mem ? content : name, FileStorage::READ + (mem ? FileStorage::MEMORY : 0)));
+        EXPECT_EQ(FileStorage::FORMAT_BINARY, fs.getFormat());
+        EXPECT_EQ(42, (int)fs["ival"]);
+        EXPECT_EQ(0.25, (double)fs["fval"]);
+        EXPECT_EQ("text", (std::string)fs["str"]);
+        FileNode map = fs["map"];
+        ASSERT_TRUE(map.isMap());
+        EXPECT_EQ(1, (int)map["a"]);
+        ASSERT_EQ(2u, map["b"].size());
+        EXPECT_EQ(2, (int)map["b"][0]);
+        EXPECT_EQ(3.5, (double)map["b"][1]);
+
+        std::vector<int> ivec_read;
+        std::vector<Point2f> pts_read;
+        std::vector<Point2d> pts_read_d;
+        std::vector<KeyPoint> kpts_read;
+        fs["ivec"] >> ivec_read;
+        fs["pts"] >> pts_read;
+        fs["pts"] >> pts_read_d;
+        fs["kpts"] >> kpts_read;
+        EXPECT_EQ(ivec, ivec_read);
+        EXPECT_EQ(pts, pts_read);
+        ASSERT_EQ(pts.size(), pts_read_d.size());
+        EXPECT_EQ(Point2d(pts.back()), pts_read_d.back());
+        ASSERT_EQ(1u, kpts_read.size());
+        EXPECT_EQ(kpts[0].pt, kpts_read[0].pt);
+        EXPECT_EQ(kpts[0].class_id, kpts_read[0].class_id);
+
+        // the large blocks of writeRaw() are accessible by index, as in the text formats
+        FileNode pts_node = fs["pts"];
+        ASSERT_EQ(pts.size()*2, pts_node.size());
+        EXPECT_EQ(pts[40].x, (float)pts_node[80]);
+        EXPECT_EQ(pts[40].y, (float)pts_node[81]);
+        size_t n = 0;
+        for (const FileNode& elem : fs["lvec"])
+        {
+            ASSERT_LT(n, lvec.size());
+            EXPECT_EQ(lvec[n++], (int)elem);
+        }
+        EXPECT_EQ(lvec.size(), n);
+
+        Mat m2d_read, m3d_read, roi_read;
+        fs["m2d"] >> m2d_read;
+        m3d_read = fs["m3d"].mat();
+        roi_read = fs["roi"].mat();
+        Mat m2d_view = fs["m2d"].mat();
+        fs.release();
+
+        // the data is not copied by FileNode::mat(), the matrix keeps the storage
+        EXPECT_EQ(0u, (size_t)m2d_view.data % 64);
+        EXPECT_EQ(0, cvtest::norm(m2d, m2d_read, NORM_INF));
+        EXPECT_EQ(0, cvtest::norm(m2d, m2d_view, NORM_INF));
+        EXPECT_EQ(0, cvtest::norm(m3d, m3d_read, NORM_INF));
+        EXPECT_EQ(0, cvtest::norm(roi, roi_read, NORM_INF));
+        m2d_view.setTo(Scalar::all(0));  // private copy of the mapped data
+    }
+
+    {
+        FileStorage fs(fname, FileStorage::READ);
+        EXPECT_EQ(0, cvtest::norm(m2d, fs["m2d"].mat(), NORM_INF));
+    }
+    EXPECT_EQ(0, remove(fname.c_str()));
+    EXPECT_EQ(0, remove(fname_gz.c_str()));
+}
+
 TEST(Core_InputOutput, FileStorage_copy_constructor_17412)
 {
     std::string fname = tempfile("test.yml");
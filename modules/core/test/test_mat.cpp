@@ -3,6 +3,8 @@
 // of this distribution and at http://opencv.org/license.html.
 #include "test_precomp.hpp"
 
+#include <thread>
+
 #ifdef HAVE_EIGEN
 #include <Eigen/Core>
 #include <Eigen/Dense>
@@ -1422,6 +1424,114 @@ TEST(Core_SparseMat, footprint)
     ASSERT_LE(dataSize1, threshold);
 }
 
+typedef testing::TestWithParam<int> Core_SparseMatCSR;
+
+TEST_P(Core_SparseMatCSR, conversions)
+{
+    const int type = GetParam();
+    RNG& rng = theRNG();
+    Mat dense(57, 43, type), mask(dense.size(), CV_8U);
+    cvtest::randUni(rng, dense, Scalar::all(-1), Scalar::all(1));
+    cvtest::randUni(rng, mask, Scalar::all(0), Scalar::all(8));
+    dense.setTo(Scalar::all(0), mask > 0);
+
+    SparseMatCSR csr(dense);
+    EXPECT_EQ(type, csr.type());
+    EXPECT_EQ(dense.size(), csr.size());
+    EXPECT_EQ((size_t)countNonZero(dense), csr.nonZeros());
+    Mat back;
+    csr.copyTo(back);
+    EXPECT_EQ(0, cvtest::norm(back, dense, NORM_INF));
+
+    SparseMat sparse(dense), sparse2;
+    SparseMatCSR csr2(sparse);
+    EXPECT_EQ(csr.rowPtr, csr2.rowPtr);
+    EXPECT_EQ(csr.colIdx, csr2.colIdx);
+    EXPECT_EQ(0, cvtest::norm(csr.values, csr2.values, NORM_INF));
+    csr2.copyTo(sparse2);
+    sparse2.copyTo(back);
+    EXPECT_EQ(0, cvtest::norm(back, dense, NORM_INF));
+
+    csr.t().copyTo(back);
+    EXPECT_EQ(0, cvtest::norm(back, dense.t(), NORM_INF));
+
+    SparseMatCSR csr3(csr.rows, csr.cols, csr.rowPtr, csr.colIdx, csr.values);
+    csr3.copyTo(back);
+    EXPECT_EQ(0, cvtest::norm(back, dense, NORM_INF));
+    std::vector<int> badIdx = csr.colIdx;
+    std::reverse(badIdx.begin(), badIdx.end());
+    EXPECT_ANY_THROW(SparseMatCSR(csr.rows, csr.cols, csr.rowPtr, badIdx, csr.values));
+}
+
+TEST_P(Core_SparseMatCSR, gemm)
+{
+    const int type = GetParam();
+    const double eps = type == CV_32F ? 1e-4 : 1e-10;
+    RNG& rng = theRNG();
+    Mat dense(300, 257, type), mask(dense.size(), CV_8U);
+    cvtest::randUni(rng, dense, Scalar::all(-1), Scalar::all(1));
+    cvtest::randUni(rng, mask, Scalar::all(0), Scalar::all(10));
+    dense.setTo(Scalar::all(0), mask > 0);
+    SparseMatCSR csr(dense);
+
+    for (int k = 1; k <= 19; k += 9)
+    {
+        for (int flags = 0; flags <= (GEMM_1_T | GEMM_2_T | GEMM_3_T); flags++)
+        {
+            SCOPED_TRACE(cv::format("k=%d flags=%d", k, flags));
+            int n = flags & GEMM_1_T ? dense.rows : dense.cols;
+            int m = flags & GEMM_1_T ? dense.cols : dense.rows;
+            Mat B = flags & GEMM_2_T ? Mat(k, n, type) : Mat(n, k, type);
+            Mat C = flags & GEMM_3_T ? Mat(k, m, type) : Mat(m, k, type);
+            cvtest::randUni(rng, B, Scalar::all(-1), Scalar::all(1));
+            cvtest::randUni(rng, C, Scalar::all(-1), Scalar::all(1));
+
+            Mat dst, ref;
+            cv::gemm(csr, B, 0.5, C, -2, dst, flags);
+            cv::gemm(dense, B, 0.5, C, -2, ref, flags);
+            EXPECT_LE(cvtest::norm(dst, ref, NORM_INF), eps);
+
+            cv::gemm(csr, B, 2, noArray(), 0, dst, flags & ~GEMM_3_T);
+            cv::gemm(dense, B, 2, noArray(), 0, ref, flags & ~GEMM_3_T);
+            EXPECT_LE(cvtest::norm(dst, ref, NORM_INF), eps);
+        }
+    }
+
+    // in-place: x = A*x
+    Mat x(dense.cols, 1, type), ref;
+    cvtest::randUni(rng, x, Scalar::all(-1), Scalar::all(1));
+    Mat dense_sq = dense.rowRange(0, dense.cols);
+    SparseMatCSR csr_sq(dense_sq);
+    cv::gemm(dense_sq, x, 1, noArray(), 0, ref);
+    cv::gemm(csr_sq, x, 1, noArray(), 0, x);
+    EXPECT_LE(cvtest::norm(x, ref, NORM_INF), eps);
+}
+
+TEST_P(Core_SparseMatCSR, no_elements)
+{
+    const int type = GetParam();
+    Mat dense = Mat::zeros(20, 10, type);
+    SparseMatCSR csr(dense);
+    EXPECT_EQ(0u, csr.nonZeros());
+    EXPECT_EQ(type, csr.type());
+    EXPECT_EQ(type, csr.t().type());
+    EXPECT_EQ(type, SparseMatCSR(SparseMat(dense)).type());
+
+    Mat back;
+    csr.copyTo(back);
+    EXPECT_EQ(type, back.type());
+    EXPECT_EQ(0, cvtest::norm(back, dense, NORM_INF));
+
+    Mat B(10, 3, type), C(20, 3, type), dst;
+    randu(B, Scalar::all(-1), Scalar::all(1));
+    randu(C, Scalar::all(-1), Scalar::all(1));
+    cv::gemm(csr, B, 1, C, 2, dst);
+    EXPECT_EQ(type, dst.type());
+    EXPECT_EQ(0, cvtest::norm(dst, C*2, NORM_INF));
+}
+
+INSTANTIATE_TEST_CASE_P(/**/, Core_SparseMatCSR, testing::Values(CV_32F, CV_64F));
+
 
 // Can't fix without dirty hacks or broken user code (PR #4159)
 TEST(Core_Mat_vector, DISABLED_OutputArray_create_getMat)
@@ -2356,4 +2466,85 @@ TEST(Mat, regression_18473)
 }
 
 
+TEST(Mat, pool_allocator)
+{
+    MatAllocator* pool = Mat::getPoolAllocator();
+    ASSERT_TRUE(pool != NULL);
+    BufferPoolController* controller = pool->getBufferPoolController();
+    size_t maxReservedSize = controller->getMaxReservedSize();
+    controller->setMaxReservedSize(16 << 20);
+
+    MatPoolAllocatorStatistics stats0 = getPoolAllocatorStatistics();
+    const uchar* data0 = NULL;
+    for (int i = 0; i < 10; i++)
+    {
+        Mat m;
+        m.allocator = pool;
+        m.create(480, 640, CV_8UC3);
+        m.setTo(Scalar::all(i));
+        if (i == 0)
+            data0 = m.data;
+        else
+            EXPECT_EQ(data0, m.data) << "buffer is not reused: " << i;
+        EXPECT_EQ(i, m.at<Vec3b>(479, 639)[2]);
+    }
+    MatPoolAllocatorStatistics stats1 = getPoolAllocatorStatistics();
+    EXPECT_EQ(9u, stats1.hits - stats0.hits);
+    EXPECT_EQ(1u, stats1.misses - stats0.misses);
+    EXPECT_GE(stats1.reservedSize, (size_t)(480*640*3));
+    EXPECT_EQ(stats1.reservedSize, controller->getReservedSize());
+
+    // a bit smaller matrix fits the same size class
+    {
+        Mat m;
+        m.allocator = pool;
+        m.create(479, 640, CV_8UC3);
+        EXPECT_EQ(data0, m.data);
+    }
+
+    // the buffers released by the other threads are reused by them
+    MatPoolAllocatorStatistics stats2 = getPoolAllocatorStatistics();
+    const uchar* threadData0 = NULL;
+    int reused = 0;
+    size_t threadReservedSize = 0;
+    std::thread t([&]()
+    {
+        for (int i = 0; i < 10; i++)
+        {
+            Mat m;
+            m.allocator = pool;
+            m.create(100, 100, CV_32FC1);
+            if (i == 0)
+                threadData0 = m.data;
+            else
+                reused += m.data == threadData0;
+        }
+        threadReservedSize = getPoolAllocatorStatistics().reservedSize;
+    });
+    t.join();
+    MatPoolAllocatorStatistics stats3 = getPoolAllocatorStatistics();
+    EXPECT_EQ(9, reused);
+    EXPECT_EQ(9u, stats3.hits - stats2.hits);
+    EXPECT_EQ(1u, stats3.misses - stats2.misses);
+    EXPECT_GE(threadReservedSize, stats2.reservedSize + 100*100*4);
+    // the cached buffers of the finished thread are freed
+    EXPECT_EQ(stats2.reservedSize, stats3.reservedSize);
+    EXPECT_EQ(stats3.reservedSize, controller->getReservedSize());
+
+    controller->freeAllReservedBuffers();
+    EXPECT_EQ(0u, controller->getReservedSize());
+
+    // high-water limit
+    controller->setMaxReservedSize(1000);
+    {
+        Mat m;
+        m.allocator = pool;
+        m.create(100, 100, CV_8UC1);
+    }
+    EXPECT_EQ(0u, getPoolAllocatorStatistics().reservedSize);
+
+    controller->setMaxReservedSize(maxReservedSize);
+}
+
+
 }} // namespace
@@ -2761,6 +2761,40 @@ TEST(Core_SolvePoly, accuracy) { Core_SolvePolyTest test; test.safe_run(); }
 TEST(Core_Phase, accuracy32f) { Core_PhaseTest test(CV_32FC1); test.safe_run(); }
 TEST(Core_Phase, accuracy64f) { Core_PhaseTest test(CV_64FC1); test.safe_run(); }
 
+typedef testing::TestWithParam<int> Core_GEMM_Large;
+
+TEST_P(Core_GEMM_Large, accuracy)
+{
+    const int type = GetParam();
+    RNG& rng = theRNG();
+    // sizes are not multiples of the blocks to check the edges
+    const int M = 131, N = 257, K = 301;
+    const int all_flags[] = { 0, GEMM_1_T, GEMM_2_T, GEMM_1_T|GEMM_2_T, GEMM_3_T, GEMM_1_T|GEMM_2_T|GEMM_3_T };
+    for (size_t f = 0; f < sizeof(all_flags)/sizeof(all_flags[0]); f++)
+    {
+        const int flags = all_flags[f];
+        SCOPED_TRACE(cv::format("flags=%d", flags));
+        Mat A = (flags & GEMM_1_T) ? Mat(K, M, type) : Mat(M, K, type);
+        Mat B = (flags & GEMM_2_T) ? Mat(N, K, type) : Mat(K, N, type);
+        Mat C = (flags & GEMM_3_T) ? Mat(N, M, type) : Mat(M, N, type);
+        rng.fill(A, RNG::UNIFORM, -1, 1);
+        rng.fill(B, RNG::UNIFORM, -1, 1);
+        rng.fill(C, RNG::UNIFORM, -1, 1);
+
+        Mat D, D_ref;
+        cv::gemm(A, B, 0.5, C, -2, D, flags);
+        cvtest::gemm(A, B, 0.5, C, -2, D_ref, flags);
+        EXPECT_LE(cvtest::norm(D, D_ref, NORM_INF), type == CV_32F ? 1e-4 : 1e-10);
+
+        // no C
+        cv::gemm(A, B, 1.5, noArray(), 0, D, flags & ~GEMM_3_T);
+        cvtest::gemm(A, B, 1.5, Mat(), 0, D_ref, flags & ~GEMM_3_T);
+        EXPECT_LE(cvtest::norm(D, D_ref, NORM_INF), type == CV_32F ? 1e-4 : 1e-10);
+    }
+}
+
+INSTANTIATE_TEST_CASE_P(/**/, Core_GEMM_Large, testing::Values(CV_32FC1, CV_64FC1));
+
 TEST(Core_SVD, flt)
 {
     float a[] = {
@@ -2977,6 +3011,85 @@ TEST(Core_KMeans, bad_input)
     }
 }
 
+TEST(Core_KMeans, mini_batch)
+{
+    const int K = 8, dims = 4, N = 20000;
+    RNG& rng = theRNG();
+    Mat centers0(K, dims, CV_32F), data(N, dims, CV_32F), labels0(N, 1, CV_32S);
+    cvtest::randUni(rng, centers0, Scalar::all(-100), Scalar::all(100));
+    cvtest::randUni(rng, data, Scalar::all(-1), Scalar::all(1));
+    double compactness0 = 0;
+    for (int i = 0; i < N; i++)
+    {
+        compactness0 += cv::norm(data.row(i), NORM_L2SQR);
+        labels0.at<int>(i) = rng.uniform(0, K);
+        data.row(i) += centers0.row(labels0.at<int>(i));
+    }
+
+    for (int flags = KMEANS_MINI_BATCH; flags <= (KMEANS_MINI_BATCH | KMEANS_PP_CENTERS); flags += KMEANS_PP_CENTERS)
+    {
+        SCOPED_TRACE(flags);
+        Mat labels, centers;
+        double compactness = cv::kmeans(data, K, labels, TermCriteria(TermCriteria::COUNT, 100, 0), 3, flags, centers);
+        ASSERT_EQ(N, labels.rows);
+        ASSERT_EQ(K, centers.rows);
+
+        double expected = 0;
+        for (int i = 0; i < N; i++)
+        {
+            int l = labels.at<int>(i);
+            ASSERT_GE(l, 0);
+            ASSERT_LT(l, K);
+            expected += cv::norm(data.row(i), centers.row(l), NORM_L2SQR);
+        }
+        EXPECT_NEAR(expected, compactness, expected * 1e-5);
+        if (flags & KMEANS_PP_CENTERS)
+        {
+            EXPECT_LT(compactness, compactness0 * 1.1);  // all the clusters are found
+        }
+    }
+}
+
+TEST(Core_KMeans, bounds_same_labels)
+{
+    // the converged labels of the Lloyd iterations with the distance bounds are the nearest centers
+    // found by the full search, including the ties of the samples on the integer grid
+    const int K = 12, dims = 3, N = 5000;
+    RNG& rng = theRNG();
+    for (int grid = 0; grid < 2; grid++)
+    {
+        SCOPED_TRACE(grid);
+        Mat data(N, dims, CV_32F);
+        cvtest::randUni(rng, data, Scalar::all(0), Scalar::all(8));
+        if (grid)
+            data.forEach<float>([](float& v, const int*) { v = std::floor(v); });
+
+        Mat labels, centers;
+        cv::kmeans(data, K, labels, TermCriteria(TermCriteria::COUNT + TermCriteria::EPS, 1000, 0), 1,
+                   KMEANS_RANDOM_CENTERS, centers);
+        ASSERT_EQ(N, labels.rows);
+        ASSERT_EQ(K, centers.rows);
+
+        int mismatches = 0;
+        for (int i = 0; i < N; i++)
+        {
+            int k_best = 0;
+            float min_dist = FLT_MAX;
+            for (int k = 0; k < K; k++)
+            {
+                float dist = cv::hal::normL2Sqr_(data.ptr<float>(i), centers.ptr<float>(k), dims);
+                if (min_dist > dist)
+                {
+                    min_dist = dist;
+                    k_best = k;
+                }
+            }
+            mismatches += labels.at<int>(i) != k_best;
+        }
+        EXPECT_EQ(0, mismatches);
+    }
+}
+
 TEST(CovariationMatrixVectorOfMat, accuracy)
 {
     unsigned int col_problem_size = 8, row_problem_size = 8, vector_size = 16;
@@ -242,6 +242,84 @@ TEST(Core_Parallel, propagate_exceptions)
     }, cv::Exception);
 }
 
+TEST(Core_Parallel, nested_calls)
+{
+    Mat dst(100, 100, CV_32SC1, Scalar::all(0));
+    parallel_for_(Range(0, dst.rows), [&](const Range& r)
+    {
+        for (int y = r.start; y < r.end; y++)
+        {
+            int* row = dst.ptr<int>(y);
+            parallel_for_(Range(0, dst.cols), [&](const Range& c)
+            {
+                for (int x = c.start; x < c.end; x++)
+                    row[x] += y * 1000 + x;
+            });
+        }
+    });
+
+    Mat ref(dst.size(), CV_32SC1);
+    for (int y = 0; y < ref.rows; y++)
+        for (int x = 0; x < ref.cols; x++)
+            ref.at<int>(y, x) = y * 1000 + x;
+    EXPECT_EQ(0, cvtest::norm(dst, ref, NORM_INF));
+
+    Mat dst2(100, 100, CV_8SC1, Scalar::all(0));
+    ASSERT_THROW({
+        parallel_for_(Range(0, 4), [&](const Range& r)
+        {
+            for (int i = r.start; i < r.end; i++)
+                parallel_for_(Range(0, dst2.rows), ThrowErrorParallelLoopBody(dst2, i == 2 ? dst2.rows / 2 : -1));
+        });
+    }, cv::Exception);
+}
+
+static std::string readTextFile(const std::string& filename)
+{
+    std::ifstream f(filename.c_str());
+    std::stringstream ss;
+    ss << f.rdbuf();
+    return ss.str();
+}
+
+TEST(Core_Parallel, statistics)
+{
+    const bool wasEnabled = utils::trace::isParallelForStatisticsEnabled();
+    utils::trace::setParallelForStatisticsEnabled(true);
+    utils::trace::resetParallelForStatistics();
+
+    Mat dst(256, 256, CV_32SC1, Scalar::all(0));
+    for (int iter = 0; iter < 3; iter++)
+    {
+        parallel_for_(Range(0, dst.rows), [&](const Range& r)
+        {
+            for (int y = r.start; y < r.end; y++)
+                dst.row(y).setTo(Scalar::all(y + iter));
+        });
+    }
+
+    const std::string csvFile = cv::tempfile(".csv");
+    const std::string jsonFile = cv::tempfile(".json");
+    EXPECT_TRUE(utils::trace::dumpParallelForStatistics(csvFile.c_str()));
+    EXPECT_TRUE(utils::trace::dumpParallelForStatistics(jsonFile.c_str()));
+    utils::trace::setParallelForStatisticsEnabled(wasEnabled);
+    utils::trace::resetParallelForStatistics();
+
+    const std::string csv = readTextFile(csvFile);
+    const std::string json = readTextFile(jsonFile);
+    remove(csvFile.c_str());
+    remove(jsonFile.c_str());
+
+    EXPECT_EQ(0u, csv.find("site,calls,stripes,"));
+    EXPECT_EQ(0u, json.find("{"));
+    EXPECT_NE(std::string::npos, json.find("\"parallel_for\""));
+    if (cv::getNumThreads() > 1 && cv::currentParallelFramework())
+    {
+        EXPECT_NE(std::string::npos, csv.find(",3,")) << csv;  // calls
+        EXPECT_NE(std::string::npos, json.find("\"calls\": 3,")) << json;
+    }
+}
+
 TEST(Core_Version, consistency)
 {
     // this test verifies that OpenCV version loaded in runtime
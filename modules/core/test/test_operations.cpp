@@ -1519,6 +1519,88 @@ TEST(Core_sortIdx, regression_8941)
         "expected=" << std::endl << expected;
 }
 
+template<typename T> static void checkSortedRows(const Mat& src, const Mat& dst, const Mat& idx, int flags, int k)
+{
+    bool sortRows = (flags & SORT_EVERY_COLUMN) == 0;
+    bool descending = (flags & SORT_DESCENDING) != 0;
+    int n = sortRows ? src.rows : src.cols, len = sortRows ? src.cols : src.rows;
+    for (int i = 0; i < n; i++)
+    {
+        std::vector<T> v(len);
+        std::vector<int> order(len);
+        for (int j = 0; j < len; j++)
+        {
+            v[j] = sortRows ? src.at<T>(i, j) : src.at<T>(j, i);
+            order[j] = j;
+        }
+        // the equal elements are ordered by their indices
+        std::stable_sort(order.begin(), order.end(), [&](int a, int b) { return descending ? v[a] > v[b] : v[a] < v[b]; });
+        for (int j = 0; j < k; j++)
+        {
+            ASSERT_EQ(v[order[j]], sortRows ? dst.at<T>(i, j) : dst.at<T>(j, i)) << "i=" << i << " j=" << j;
+            ASSERT_EQ(order[j], sortRows ? idx.at<int>(i, j) : idx.at<int>(j, i)) << "i=" << i << " j=" << j;
+        }
+    }
+}
+
+typedef testing::TestWithParam<tuple<MatDepth, SortRowCol, SortOrder> > Core_Sort_Radix;
+
+TEST_P(Core_Sort_Radix, long_rows)
+{
+    int depth = get<0>(GetParam()), flags = get<1>(GetParam()) | get<2>(GetParam());
+    bool sortRows = (flags & SORT_EVERY_COLUMN) == 0;
+    // the short rows are sorted by std::stable_sort
+    const Size sizes[] = { Size(30, 50), Size(1000, 20), Size(200000, 2) };
+    for (size_t k = 0; k < sizeof(sizes)/sizeof(sizes[0]); k++)
+    {
+        Size sz = sortRows ? sizes[k] : Size(sizes[k].height, sizes[k].width);
+        Mat src(sz, CV_MAKETYPE(depth, 1)), dst, idx, top, topIdx;
+        cvtest::randUni(theRNG(), src, Scalar::all(-100), Scalar::all(100));
+
+        cv::sort(src, dst, flags);
+        cv::sortIdx(src, idx, flags);
+        cv::topK(src, top, topIdx, 10, flags);
+        ASSERT_EQ(sortRows ? Size(10, sz.height) : Size(sz.width, 10), top.size());
+
+        int len = sortRows ? sz.width : sz.height;
+        switch (depth)
+        {
+        case CV_8U: checkSortedRows<uchar>(src, dst, idx, flags, len); checkSortedRows<uchar>(src, top, topIdx, flags, 10); break;
+        case CV_8S: checkSortedRows<schar>(src, dst, idx, flags, len); checkSortedRows<schar>(src, top, topIdx, flags, 10); break;
+        case CV_16S: checkSortedRows<short>(src, dst, idx, flags, len); checkSortedRows<short>(src, top, topIdx, flags, 10); break;
+        case CV_32S: checkSortedRows<int>(src, dst, idx, flags, len); checkSortedRows<int>(src, top, topIdx, flags, 10); break;
+        case CV_32F: checkSortedRows<float>(src, dst, idx, flags, len); checkSortedRows<float>(src, top, topIdx, flags, 10); break;
+        case CV_64F: checkSortedRows<double>(src, dst, idx, flags, len); checkSortedRows<double>(src, top, topIdx, flags, 10); break;
+        default: FAIL() << "Unsupported depth: " << depth;
+        }
+    }
+}
+
+INSTANTIATE_TEST_CASE_P(Core, Core_Sort_Radix, Combine(
+        Values(CV_8U, CV_8S, CV_16S, CV_32S, CV_32F, CV_64F),
+        Values(SORT_EVERY_COLUMN, SORT_EVERY_ROW),
+        Values(SORT_ASCENDING, SORT_DESCENDING)
+));
+
+TEST(Core_Sort, radix_float_special_values)
+{
+    float inf = std::numeric_limits<float>::infinity();
+    Mat src(1, 1000, CV_32F), dst;
+    theRNG().fill(src, RNG::UNIFORM, -1e30, 1e30);
+    src.at<float>(3) = inf;
+    src.at<float>(500) = -inf;
+    src.at<float>(7) = FLT_MIN;
+    src.at<float>(8) = -FLT_MIN;
+    src.at<float>(9) = -0.f;
+    src.at<float>(10) = 0.f;
+
+    cv::sort(src, dst, SORT_EVERY_ROW + SORT_ASCENDING);
+    EXPECT_EQ(-inf, dst.at<float>(0));
+    EXPECT_EQ(inf, dst.at<float>(999));
+    for (int j = 1; j < dst.cols; j++)
+        ASSERT_LE(dst.at<float>(j - 1), dst.at<float>(j)) << j;
+}
+
 TEST(Core_Mat, augmentation_operations_9688)
 {
     {
@@ -1551,4 +1633,76 @@ TEST(Core_MatExpr, empty_check_15760)
     EXPECT_THROW(Mat c = Mat().cross(Mat()), cv::Exception);
 }
 
+
+// chains of the element-wise operations are evaluated in a single pass,
+// the results must be the same as of the step-by-step evaluation
+TEST(Core_MatExpr, fused_elementwise)
+{
+    const int types[] = { CV_8UC1, CV_8UC3, CV_8SC1, CV_16UC1, CV_16SC1, CV_32SC1, CV_32FC1, CV_32FC3, CV_64FC1 };
+    for (size_t i = 0; i < sizeof(types)/sizeof(types[0]); i++)
+    {
+        int type = types[i];
+        SCOPED_TRACE(typeToString(type));
+        double eps = CV_MAT_DEPTH(type) >= CV_32F ? 1e-4 : 0;
+
+        RNG& rng = theRNG();
+        Mat a(67, 129, type), b(a.size(), type), c(a.size(), type);
+        rng.fill(a, RNG::UNIFORM, 1, 200);
+        rng.fill(b, RNG::UNIFORM, 1, 200);
+        rng.fill(c, RNG::UNIFORM, 1, 200);
+
+        Mat t1, t2, expected;
+        cv::multiply(a, b, t1);
+        cv::add(t1, c, expected);
+        EXPECT_LE(cvtest::norm(a.mul(b) + c, expected, NORM_INF), eps);
+
+        cv::multiply(a, b, t1, 0.5);
+        cv::multiply(b, c, t2);
+        cv::subtract(t1, t2, expected);
+        EXPECT_LE(cvtest::norm(a.mul(b)*0.5 - b.mul(c), expected, NORM_INF), eps);
+
+        cv::addWeighted(a, 0.5, b, 0.5, 0, t1);
+        cv::addWeighted(t1, 2, c, -2, 0, expected);
+        EXPECT_LE(cvtest::norm((a*0.5 + b*0.5 - c)*2, expected, NORM_INF), eps);
+
+        cv::multiply(a, b, t1);
+        cv::absdiff(t1, c, expected);
+        EXPECT_LE(cvtest::norm(abs(a.mul(b) - c), expected, NORM_INF), eps);
+
+        cv::divide(a, b, t1);
+        cv::divide(t1, c, expected, 3);
+        EXPECT_LE(cvtest::norm(a/b/c*3, expected, NORM_INF), eps);
+
+        cv::multiply(a, b, t1);
+        cv::divide(7.0, t1, expected);
+        EXPECT_LE(cvtest::norm(7.0/a.mul(b), expected, NORM_INF), eps);
+
+        cv::multiply(a, b, t1);
+        cv::subtract(Scalar(100, 50, 25), t1, expected);
+        EXPECT_LE(cvtest::norm(Scalar(100, 50, 25) - a.mul(b), expected, NORM_INF), eps);
+
+        cv::multiply(a, b, t1);
+        cv::compare(t1, c, t2, CMP_GT);
+        cv::compare(a, c, t1, CMP_LE);
+        cv::add(t1, t2, expected);
+        EXPECT_EQ(0, cvtest::norm((a.mul(b) > c) + (a <= c), expected, NORM_INF));
+
+        // ROI operands and destination
+        Rect roi(3, 5, 100, 50);
+        Mat dst(a.size(), type, Scalar::all(0)), dstRoi = dst(roi);
+        cv::multiply(a(roi), b(roi), t1);
+        cv::add(t1, c(roi), expected);
+        dstRoi = a(roi).mul(b(roi)) + c(roi);
+        EXPECT_LE(cvtest::norm(dstRoi, expected, NORM_INF), eps);
+        EXPECT_EQ(0, cvtest::norm(dst.row(0), NORM_INF));
+
+        // in-place
+        Mat x = a.clone();
+        cv::multiply(a, b, t1);
+        cv::add(t1, c, expected);
+        x = x.mul(b) + c;
+        EXPECT_LE(cvtest::norm(x, expected, NORM_INF), eps);
+    }
+}
+
 }} // namespace
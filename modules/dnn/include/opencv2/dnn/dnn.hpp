@@ -341,6 +341,15 @@ CV__DNN_INLINE_NS_BEGIN
          */
         virtual bool tryFuse(Ptr<Layer>& top);
 
+        /**
+         * @brief Tries to switch the layer to 8-bit integer computations.
+         * @param[in] inputRanges Maximal absolute values of the layer inputs observed during calibration.
+         *                        Empty vector switches the layer back to floating point computations.
+         * @returns True if the layer computes in 8-bit integers from now on.
+         * @see Net::quantize
+         */
+        virtual bool tryQuantize(const std::vector<float>& inputRanges);
+
         /**
          * @brief Returns parameters of layers with channel-wise multiplication and addition.
          * @param[out] scale Channel-wise multipliers. Total number of values should
@@ -720,11 +729,41 @@ CV__DNN_INLINE_NS_BEGIN
                                           CV_OUT std::vector<size_t>& weights,
                                           CV_OUT std::vector<size_t>& blobs) const; // FIXIT: CV_WRAP
 
+        /** @brief Returns the number of bytes allocated for the intermediate blobs of the network.
+         * @details The network is set up for the inputs passed to setInput() if it has not been yet.
+         * On the default CPU target the intermediate blobs are packed into a single buffer with respect
+         * to their lifetimes, so the returned value is the peak memory of activations during forward pass.
+         * Weights and temporary buffers of layers implementations are not counted.
+         * Set OPENCV_DNN_MEMORY_ARENA=0 to fall back to the reference counting reuse of separate blobs.
+         */
+        CV_WRAP size_t getPeakBlobsMemory();
+
         /** @brief Enables or disables layer fusion in the network.
          * @param fusion true to enable the fusion, false to disable. The fusion is enabled by default.
          */
         CV_WRAP void enableFusion(bool fusion);
 
+        /** @brief Enables or disables the Winograd algorithm for 3x3 convolutions on CPU.
+         * @param useWinograd true to enable, false to disable. It is enabled by default.
+         * @details Winograd F(6x6, 3x3) is used for non-grouped 3x3 convolutions with unit strides and
+         * dilations and enough channels. It reduces the amount of multiplications but has slightly
+         * lower numerical accuracy than the direct convolution.
+         */
+        CV_WRAP void enableWinograd(bool useWinograd);
+
+        /** @brief Switches layers of the network to 8-bit integer inference.
+         * @param calibData vector of representative input blobs (for example, produced by blobFromImage)
+         *                  which are used to estimate dynamic ranges of the layers inputs.
+         *
+         * The network is run over every calibration blob to collect maximal absolute values of
+         * the layers inputs. Then the layers which support quantization (2D convolutions and fully
+         * connected layers) get per output channel symmetrically quantized weights and compute
+         * the following forward passes with 8-bit integer dot products. Other layers keep
+         * floating point computations. Call it again with new data to recalibrate the network.
+         * @note Supported for networks with a single input by DNN_BACKEND_OPENCV on DNN_TARGET_CPU only.
+         */
+        CV_WRAP void quantize(InputArrayOfArrays calibData);
+
         /** @brief Returns overall time for inference and timings (in ticks) for layers.
          * Indexes in returned vector correspond to layers ids. Some layers can be fused with others,
          * in this case zero ticks count will be return for that skipped layers.
@@ -1152,6 +1191,21 @@ CV__DNN_INLINE_NS_BEGIN
           */
          CV_WRAP void predict(InputArray frame, OutputArrayOfArrays outs) const;
 
+         /** @brief Set batching parameters of asynchronous requests, see predictAsync().
+          *  @param[in] maxBatchSize Maximal number of frames which are processed by a single forward pass.
+          *  @param[in] maxLatency Maximal time in milliseconds a request waits for other ones to fill the batch.
+          */
+         CV_WRAP Model& setBatching(int maxBatchSize, double maxLatency = 10);
+
+         /** @brief Schedule the @p frame for processing in a background thread and return immediately.
+          *  Requests from concurrent calls are stacked into batches up to the size set by setBatching(),
+          *  so the network must support variable batch size and all its outputs must have the batch
+          *  as the first dimension. By default every request is processed separately.
+          *  @param[in]  frame  The input image.
+          *  @param[out] outs Results of the computation for this frame, one per output of the network.
+          */
+         void predictAsync(InputArray frame, CV_OUT std::vector<AsyncArray>& outs) const;
+
 
          // ============================== Net proxy methods ==============================
          // Never expose methods with network implementation details, like:
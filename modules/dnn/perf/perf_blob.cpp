@@ -0,0 +1,87 @@
+// This file is part of OpenCV project.
+// It is subject to the license terms in the LICENSE file found in the top-level directory
+// of this distribution and at http://opencv.org/license.html.
+
+#include "perf_precomp.hpp"
+#include <opencv2/imgproc.hpp>
+
+namespace opencv_test {
+
+// blobFromImages() made of the separate passes over the images, the way it was implemented before
+// the fused conversion
+static void blobFromImagesSeparatePasses(const std::vector<Mat>& images_, Mat& blob, double scalefactor,
+                                         Size size, const Scalar& mean_, bool swapRB, bool crop)
+{
+    std::vector<Mat> images(images_.size());
+    for (size_t i = 0; i < images.size(); i++)
+    {
+        Mat image = images_[i];
+        if (crop)
+        {
+            float resizeFactor = std::max(size.width / (float)image.cols, size.height / (float)image.rows);
+            resize(image, image, Size(), resizeFactor, resizeFactor, INTER_LINEAR);
+            image = image(Rect(Point(0.5 * (image.cols - size.width), 0.5 * (image.rows - size.height)), size));
+        }
+        else
+            resize(image, image, size, 0, 0, INTER_LINEAR);
+        image.convertTo(images[i], CV_32F);
+        Scalar mean = mean_;
+        if (swapRB)
+            std::swap(mean[0], mean[2]);
+        images[i] -= mean;
+        images[i] *= scalefactor;
+    }
+
+    int nch = images[0].channels();
+    int sz[] = { (int)images.size(), nch, size.height, size.width };
+    blob.create(4, sz, CV_32F);
+    for (size_t i = 0; i < images.size(); i++)
+    {
+        Mat ch[4];
+        for (int j = 0; j < nch; j++)
+            ch[j] = Mat(size, CV_32F, blob.ptr((int)i, j));
+        if (swapRB)
+            std::swap(ch[0], ch[2]);
+        split(images[i], ch);
+    }
+}
+
+typedef TestBaseWithParam<tuple<int, Size, bool, bool> > BlobFromImages;
+
+PERF_TEST_P_(BlobFromImages, preprocessing)
+{
+    int nimages = get<0>(GetParam());
+    Size srcSize = get<1>(GetParam());
+    bool crop = get<2>(GetParam());
+    bool fused = get<3>(GetParam());
+    Size size(224, 224);
+    Scalar mean(104, 117, 123);
+
+    std::vector<Mat> images(nimages);
+    for (int i = 0; i < nimages; i++)
+    {
+        images[i].create(srcSize, CV_8UC3);
+        randu(images[i], 0, 256);
+    }
+    Mat blob;
+
+    if (fused)
+    {
+        TEST_CYCLE() blobFromImages(images, blob, 1.0 / 255, size, mean, true, crop);
+    }
+    else
+    {
+        TEST_CYCLE() blobFromImagesSeparatePasses(images, blob, 1.0 / 255, size, mean, true, crop);
+    }
+
+    SANITY_CHECK_NOTHING();
+}
+
+INSTANTIATE_TEST_CASE_P(/**/, BlobFromImages, Combine(
+    Values(1, 16),
+    Values(Size(640, 480), Size(1920, 1080)),
+    testing::Bool(),
+    testing::Bool()
+));
+
+} // namespace
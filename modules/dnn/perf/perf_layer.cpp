@@ -92,4 +92,102 @@ PERF_TEST_P_(Layer_Slice, FastNeuralStyle_eccv16)
 
 INSTANTIATE_TEST_CASE_P(/**/, Layer_Slice, dnnBackendsAndTargets(false, false));
 
+typedef TestBaseWithParam<tuple<int, bool> > Layer_Int8;
+PERF_TEST_P_(Layer_Int8, conv3x3_fc)
+{
+    const int channels = get<0>(GetParam());
+    const bool useInt8 = get<1>(GetParam());
+    RNG& rng = theRNG();
+
+    Net net;
+    {
+        LayerParams lp;
+        lp.type = "Convolution";
+        lp.name = "conv";
+        lp.set("kernel_size", 3);
+        lp.set("pad", 1);
+        lp.set("num_output", channels);
+        lp.set("bias_term", false);
+        int wshape[] = {channels, channels, 3, 3};
+        Mat weights(4, wshape, CV_32F);
+        rng.fill(weights, RNG::UNIFORM, -1, 1);
+        lp.blobs.push_back(weights);
+        net.addLayerToPrev(lp.name, lp.type, lp);
+    }
+    {
+        LayerParams lp;
+        lp.type = "InnerProduct";
+        lp.name = "fc";
+        lp.set("num_output", 1000);
+        lp.set("bias_term", false);
+        Mat weights(1000, channels * 28 * 28, CV_32F);
+        rng.fill(weights, RNG::UNIFORM, -1, 1);
+        lp.blobs.push_back(weights);
+        net.addLayerToPrev(lp.name, lp.type, lp);
+    }
+    net.setPreferableBackend(DNN_BACKEND_OPENCV);
+    net.setPreferableTarget(DNN_TARGET_CPU);
+
+    int inpShape[] = {1, channels, 28, 28};
+    Mat input(4, inpShape, CV_32F);
+    randu(input, 0, 1);
+    if (useInt8)
+        net.quantize(std::vector<Mat>(1, input));
+
+    net.setInput(input);
+    net.forward();  // warmup
+
+    TEST_CYCLE()
+    {
+        Mat res = net.forward();
+    }
+
+    SANITY_CHECK_NOTHING();
+}
+
+INSTANTIATE_TEST_CASE_P(/**/, Layer_Int8, Combine(Values(64, 256), testing::Bool()));
+
+typedef TestBaseWithParam<tuple<int, bool> > Layer_Winograd;
+PERF_TEST_P_(Layer_Winograd, conv3x3)
+{
+    const int channels = get<0>(GetParam());
+    const bool useWinograd = get<1>(GetParam());
+    RNG& rng = theRNG();
+
+    Net net;
+    {
+        LayerParams lp;
+        lp.type = "Convolution";
+        lp.name = "conv";
+        lp.set("kernel_size", 3);
+        lp.set("pad", 1);
+        lp.set("num_output", channels);
+        lp.set("bias_term", false);
+        int wshape[] = {channels, channels, 3, 3};
+        Mat weights(4, wshape, CV_32F);
+        rng.fill(weights, RNG::UNIFORM, -1, 1);
+        lp.blobs.push_back(weights);
+        net.addLayerToPrev(lp.name, lp.type, lp);
+    }
+    net.setPreferableBackend(DNN_BACKEND_OPENCV);
+    net.setPreferableTarget(DNN_TARGET_CPU);
+    net.enableWinograd(useWinograd);
+
+    int inpShape[] = {1, channels, 56, 56};
+    Mat input(4, inpShape, CV_32F);
+    randu(input, 0, 1);
+
+    net.setInput(input);
+    net.forward();  // warmup
+
+    TEST_CYCLE()
+    {
+        Mat res = net.forward();
+    }
+
+    SANITY_CHECK_NOTHING();
+}
+
+INSTANTIATE_TEST_CASE_P(/**/, Layer_Winograd, Combine(Values(64, 256), testing::Bool()));
+
 } // namespace
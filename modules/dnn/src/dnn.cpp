@@ -53,6 +53,8 @@
 
 #include "halide_scheduler.hpp"
 
+#include <opencv2/core/hal/intrin.hpp>
+
 #include <set>
 #include <algorithm>
 #include <iostream>
@@ -76,6 +78,9 @@ static size_t DNN_NETWORK_DUMP = utils::getConfigurationParameterSizeT("OPENCV_D
 // this option is useful to run valgrind memory errors detection
 static bool DNN_DISABLE_MEMORY_OPTIMIZATIONS = utils::getConfigurationParameterBool("OPENCV_DNN_DISABLE_MEMORY_OPTIMIZATIONS", false);
 
+// pack intermediate blobs of networks on CPU into a single buffer (see BlobManager::allocateArena)
+static bool DNN_MEMORY_ARENA = utils::getConfigurationParameterBool("OPENCV_DNN_MEMORY_ARENA", true);
+
 #ifdef HAVE_OPENCL
 static bool DNN_OPENCL_ALLOW_ALL_DEVICES = utils::getConfigurationParameterBool("OPENCV_DNN_OPENCL_ALLOW_ALL_DEVICES", false);
 #endif
@@ -320,6 +325,78 @@ Mat blobFromImages(InputArrayOfArrays images, double scalefactor, Size size,
     return blob;
 }
 
+#if CV_SIMD
+static inline void blobStore(float* dst, const v_float32& v, const v_float32& m, const v_float32& s)
+{
+    v_store(dst, (v - m)*s);
+}
+
+static inline void blobStore(float* dst, const v_uint8& v, const v_float32& m, const v_float32& s)
+{
+    const int n = v_float32::nlanes;
+    v_uint16 w0, w1;
+    v_uint32 d0, d1, d2, d3;
+    v_expand(v, w0, w1);
+    v_expand(w0, d0, d1);
+    v_expand(w1, d2, d3);
+    blobStore(dst, v_cvt_f32(v_reinterpret_as_s32(d0)), m, s);
+    blobStore(dst + n, v_cvt_f32(v_reinterpret_as_s32(d1)), m, s);
+    blobStore(dst + n*2, v_cvt_f32(v_reinterpret_as_s32(d2)), m, s);
+    blobStore(dst + n*3, v_cvt_f32(v_reinterpret_as_s32(d3)), m, s);
+}
+
+static inline void blobStore(uchar* dst, const v_uint8& v, const v_float32&, const v_float32&)
+{
+    v_store(dst, v);
+}
+#endif
+
+// Converts the row of the image and scatters its channels to the planes of the blob:
+// dst[c][x] = (src[x*cn + c] - mean[c])*scale
+template<typename Tsrc, typename Tdst> static void
+blobFromImageRow(const Tsrc* src, Tdst* const* dst, int width, int cn, const float* mean, float scale)
+{
+    int x = 0;
+#if CV_SIMD
+    typedef decltype(vx_load(src)) VT;
+    const int n = VT::nlanes;
+    v_float32 s = vx_setall_f32(scale);
+    v_float32 m0 = vx_setall_f32(mean[0]), m1 = vx_setall_f32(mean[cn > 1 ? 1 : 0]);
+    v_float32 m2 = vx_setall_f32(mean[cn > 2 ? 2 : 0]), m3 = vx_setall_f32(mean[cn > 3 ? 3 : 0]);
+    if( cn == 1 )
+    {
+        for( ; x <= width - n; x += n )
+            blobStore(dst[0] + x, vx_load(src + x), m0, s);
+    }
+    else if( cn == 3 )
+    {
+        for( ; x <= width - n; x += n )
+        {
+            VT a, b, c;
+            v_load_deinterleave(src + x*3, a, b, c);
+            blobStore(dst[0] + x, a, m0, s);
+            blobStore(dst[1] + x, b, m1, s);
+            blobStore(dst[2] + x, c, m2, s);
+        }
+    }
+    else
+    {
+        for( ; x <= width - n; x += n )
+        {
+            VT a, b, c, d;
+            v_load_deinterleave(src + x*4, a, b, c, d);
+            blobStore(dst[0] + x, a, m0, s);
+            blobStore(dst[1] + x, b, m1, s);
+            blobStore(dst[2] + x, c, m2, s);
+            blobStore(dst[3] + x, d, m3, s);
+        }
+    }
+#endif
+    for( ; x < width; x++ )
+        for( int c = 0; c < cn; c++ )
+            dst[c][x] = saturate_cast<Tdst>((src[x*cn + c] - mean[c])*scale);
+}
+
 void blobFromImages(InputArrayOfArrays images_, OutputArray blob_, double scalefactor,
                     Size size, const Scalar& mean_, bool swapRB, bool crop, int ddepth)
 {
@@ -354,60 +431,55 @@ void blobFromImages(InputArrayOfArrays images_, OutputArray blob_, double scalef
             else
               resize(images[i], images[i], size, 0, 0, INTER_LINEAR);
         }
-        if(images[i].depth() == CV_8U && ddepth == CV_32F)
-            images[i].convertTo(images[i], CV_32F);
-        Scalar mean = mean_;
-        if (swapRB)
-            std::swap(mean[0], mean[2]);
-
-        images[i] -= mean;
-        images[i] *= scalefactor;
     }
 
     size_t nimages = images.size();
     Mat image0 = images[0];
     int nch = image0.channels();
     CV_Assert(image0.dims == 2);
-    if (nch == 3 || nch == 4)
+    CV_Assert(nch == 1 || nch == 3 || nch == 4);
+    for (size_t i = 0; i < nimages; i++)
     {
-        int sz[] = { (int)nimages, nch, image0.rows, image0.cols };
-        blob_.create(4, sz, ddepth);
-        Mat blob = blob_.getMat();
-        Mat ch[4];
+        const Mat& image = images[i];
+        CV_Assert(image.depth() == ddepth || (image.depth() == CV_8U && ddepth == CV_32F));
+        CV_Assert(image.dims == 2 && image.channels() == nch);
+        CV_Assert(image.size() == image0.size());
+    }
+
+    int sz[] = { (int)nimages, nch, image0.rows, image0.cols };
+    blob_.create(4, sz, ddepth);
+    Mat blob = blob_.getMat();
 
-        for(size_t i = 0; i < nimages; i++ )
+    Scalar mean = mean_;
+    if (swapRB)
+        std::swap(mean[0], mean[2]);
+    float fmean[4], scale = (float)scalefactor;
+    for (int c = 0; c < 4; c++)
+        fmean[c] = (float)mean[c];
+
+    // the conversion, the mean subtraction, the scaling and the split of the channels are done
+    // in one pass over the images, straight into the blob
+    int rows = image0.rows, cols = image0.cols;
+    parallel_for_(Range(0, (int)nimages*rows), [&](const Range& r)
+    {
+        for (int k = r.start; k < r.end; k++)
         {
+            int i = k / rows, y = k % rows;
             const Mat& image = images[i];
-            CV_Assert(image.depth() == blob_.depth());
-            nch = image.channels();
-            CV_Assert(image.dims == 2 && (nch == 3 || nch == 4));
-            CV_Assert(image.size() == image0.size());
-
-            for( int j = 0; j < nch; j++ )
-                ch[j] = Mat(image.rows, image.cols, ddepth, blob.ptr((int)i, j));
-            if(swapRB)
-                std::swap(ch[0], ch[2]);
-            split(image, ch);
+            uchar* planes[4];
+            for (int c = 0; c < nch; c++)
+                planes[c] = blob.ptr(i, c, y);
+            if (swapRB && nch >= 3)
+                std::swap(planes[0], planes[2]);
+
+            if (ddepth == CV_8U)
+                blobFromImageRow(image.ptr<uchar>(y), (uchar* const*)planes, cols, nch, fmean, scale);
+            else if (image.depth() == CV_8U)
+                blobFromImageRow(image.ptr<uchar>(y), (float* const*)planes, cols, nch, fmean, scale);
+            else
+                blobFromImageRow(image.ptr<float>(y), (float* const*)planes, cols, nch, fmean, scale);
         }
-    }
-    else
-    {
-       CV_Assert(nch == 1);
-       int sz[] = { (int)nimages, 1, image0.rows, image0.cols };
-       blob_.create(4, sz, ddepth);
-       Mat blob = blob_.getMat();
-
-       for(size_t i = 0; i < nimages; i++ )
-       {
-           const Mat& image = images[i];
-           CV_Assert(image.depth() == blob_.depth());
-           nch = image.channels();
-           CV_Assert(image.dims == 2 && (nch == 1));
-           CV_Assert(image.size() == image0.size());
-
-           image.copyTo(Mat(image.rows, image.cols, ddepth, blob.ptr((int)i, 0)));
-       }
-    }
+    }, (double)nimages*rows*cols*nch/(1 << 16));
 }
 
 void imagesFromBlob(const cv::Mat& blob_, OutputArrayOfArrays images_)
@@ -918,6 +990,10 @@ public:
         CV_Assert(refIt != refCounter.end());
         CV_Assert(refIt->second > 0);
         refIt->second -= 1;
+
+        std::map<LayerPin, Range>::iterator lifeIt = lifetimes.find(mapIt->second);
+        if (refIt->second == 0 && lifeIt != lifetimes.end())
+            lifeIt->second.end = step;
     }
 
     void releaseReferences(const std::vector<LayerPin>& pins)
@@ -930,6 +1006,21 @@ public:
 
     void reuseOrCreate(const MatShape& shape, const LayerPin& lp, Mat& dst, bool use_half)
     {
+        if (useArena && lp.lid != 0)
+        {
+            // the final location is assigned by allocateArena(),
+            // meanwhile the blob refers to the scratch memory
+            int targetTotal = total(shape);
+            if (scratch.total() < (size_t)targetTotal)
+                scratch.create(1, targetTotal, CV_32F);
+            dst = scratch.colRange(0, targetTotal).reshape(1, shape);
+            CV_Assert(memHosts.find(lp) == memHosts.end());
+            reuseMap[lp] = lp;
+            memHosts[lp] = dst;
+            lifetimes[lp] = Range(step, INT_MAX);
+            return;
+        }
+
         if (!DNN_DISABLE_MEMORY_OPTIMIZATIONS)
         {
             Mat bestBlob;
@@ -980,6 +1071,7 @@ public:
     {
         CV_TRACE_FUNCTION();
 
+        step++;
         pinsForInternalBlobs.clear();
 
         std::vector<Mat>& outputBlobs = ld.outputBlobs,
@@ -1054,13 +1146,119 @@ public:
     }
 
     // Clear internal state. Calls before an every reallocation.
-    void reset()
+    // In the arena mode blobs are not reused during allocation. Instead, the lifetime of every
+    // memory host is recorded in terms of allocation steps and allocateArena() packs the hosts
+    // with disjoint lifetimes into the same memory after all the layers are allocated.
+    // maxBlobTotal is the number of elements in the biggest blob which is used to preallocate
+    // the scratch memory for temporary blobs headers.
+    void reset(bool arena = false, size_t maxBlobTotal = 0)
     {
         CV_TRACE_FUNCTION();
 
         refCounter.clear();
         reuseMap.clear();
         memHosts.clear();
+        lifetimes.clear();
+        arenaBuffer.release();
+        scratch.release();
+        step = 0;
+        useArena = arena;
+        if (useArena && maxBlobTotal > 0)
+            scratch.create(1, (int)maxBlobTotal, CV_32F);
+    }
+
+    // Assigns offsets to the memory hosts so that hosts with overlapping lifetimes
+    // don't overlap in memory (greedy best-fit in the order of decreasing sizes, a common
+    // heuristic for the interval graph coloring), allocates a single buffer and rebinds
+    // all the output and internal blobs of the layers to it.
+    void allocateArena(std::map<int, LayerData>& layers)
+    {
+        CV_TRACE_FUNCTION();
+        CV_Assert(useArena);
+
+        // offsets and sizes are in elements, aligned to 64 bytes
+        const int align = 64 / sizeof(float);
+        struct HostInfo
+        {
+            LayerPin pin;
+            size_t size, offset;
+            Range life;
+        };
+        std::vector<HostInfo> hosts;
+        size_t totalWithoutReuse = 0;
+        for (std::map<LayerPin, Range>::const_iterator it = lifetimes.begin(); it != lifetimes.end(); ++it)
+        {
+            HostInfo h;
+            h.pin = it->first;
+            h.size = alignSize(memHosts[it->first].total(), align);
+            h.offset = 0;
+            h.life = it->second;
+            hosts.push_back(h);
+            totalWithoutReuse += h.size;
+        }
+        std::sort(hosts.begin(), hosts.end(), [](const HostInfo& a, const HostInfo& b) {
+            return a.size > b.size || (a.size == b.size && a.life.start < b.life.start);
+        });
+
+        size_t arenaSize = 0;
+        std::map<LayerPin, size_t> offsets;
+        std::vector<const HostInfo*> neighbours;
+        for (size_t i = 0; i < hosts.size(); i++)
+        {
+            HostInfo& h = hosts[i];
+            neighbours.clear();
+            for (size_t j = 0; j < i; j++)
+            {
+                if (hosts[j].life.start <= h.life.end && h.life.start <= hosts[j].life.end)
+                    neighbours.push_back(&hosts[j]);
+            }
+            std::sort(neighbours.begin(), neighbours.end(), [](const HostInfo* a, const HostInfo* b) {
+                return a->offset < b->offset;
+            });
+
+            size_t prevEnd = 0, bestOffset = 0, bestGap = SIZE_MAX;
+            for (size_t j = 0; j < neighbours.size(); j++)
+            {
+                size_t gap = neighbours[j]->offset > prevEnd ? neighbours[j]->offset - prevEnd : 0;
+                if (gap >= h.size && gap < bestGap)
+                {
+                    bestGap = gap;
+                    bestOffset = prevEnd;
+                }
+                prevEnd = std::max(prevEnd, neighbours[j]->offset + neighbours[j]->size);
+            }
+            h.offset = bestGap != SIZE_MAX ? bestOffset : prevEnd;
+            arenaSize = std::max(arenaSize, h.offset + h.size);
+            offsets[h.pin] = h.offset;
+            CV_LOG_VERBOSE(NULL, 1, "DNN/arena: blob " << h.pin.lid << ":" << h.pin.oid
+                         << " steps [" << h.life.start << ", " << (h.life.end == INT_MAX ? -1 : h.life.end)
+                         << "] offset=" << h.offset * sizeof(float) << " size=" << h.size * sizeof(float));
+        }
+        CV_LOG_DEBUG(NULL, "DNN: " << hosts.size() << " intermediate blobs are packed into "
+                    << arenaSize * sizeof(float) << " bytes (" << totalWithoutReuse * sizeof(float)
+                    << " bytes without memory reuse)");
+
+        arenaBuffer.create(1, (int)std::max(arenaSize, (size_t)1), CV_32F);
+        for (std::map<int, LayerData>::iterator it = layers.begin(); it != layers.end(); ++it)
+        {
+            LayerData& ld = it->second;
+            size_t noutputs = ld.outputBlobs.size();
+            for (size_t i = 0; i < noutputs + ld.internals.size(); i++)
+            {
+                std::map<LayerPin, LayerPin>::const_iterator hostIt = reuseMap.find(LayerPin(ld.id, (int)i));
+                if (hostIt == reuseMap.end())
+                    continue;
+                std::map<LayerPin, size_t>::const_iterator ofsIt = offsets.find(hostIt->second);
+                if (ofsIt == offsets.end())
+                    continue;
+                Mat& m = i < noutputs ? ld.outputBlobs[i] : ld.internals[i - noutputs];
+                CV_Assert(m.type() == CV_32F);
+                int ofs = (int)ofsIt->second;
+                m = arenaBuffer.colRange(ofs, ofs + (int)m.total()).reshape(1, shape(m));
+            }
+        }
+        memHosts.clear();
+        scratch.release();
     }
 
 private:
@@ -1077,6 +1275,12 @@ private:
     // For origin blobs key == value.
     std::map<LayerPin, LayerPin> reuseMap;
     std::map<LayerPin, Mat> memHosts;
+
+    bool useArena = false;
+    int step = 0;  // number of layers allocated so far
+    // Steps of allocation and release of memory hosts, the arena mode only.
+    std::map<LayerPin, Range> lifetimes;
+    Mat arenaBuffer, scratch;
 };
 
 static Ptr<BackendWrapper> wrapMat(int backendId, int targetId, cv::Mat& m)
@@ -1178,11 +1382,13 @@ struct Net::Impl : public detail::NetImplBase
         lastLayerId = 0;
         netWasAllocated = false;
         fusion = true;
+        useWinograd = true;
         isAsync = false;
         preferableBackend = DNN_BACKEND_DEFAULT;
         preferableTarget = DNN_TARGET_CPU;
         skipInfEngineInit = false;
         hasDynamicShapes = false;
+        int8Calibration = false;
     }
 
     Ptr<DataLayer> netInputLayer;
@@ -1202,10 +1408,15 @@ struct Net::Impl : public detail::NetImplBase
 
     bool netWasAllocated;
     bool fusion;
+    bool useWinograd;
     bool isAsync;
     std::vector<int64> layersTimings;
     Mat output_blob;
 
+    // Maximal absolute values of layers inputs, collected by Net::quantize()
+    bool int8Calibration;
+    std::map<int, std::vector<float> > int8InputRanges;
+
 #ifdef HAVE_CUDA
     struct CudaInfo_t
     {
@@ -3121,7 +3332,17 @@ struct Net::Impl : public detail::NetImplBase
         LayersShapesMap layersShapes;
         getLayersShapes(inputShapes, layersShapes);
 
-        blobManager.reset();
+        bool useArena = DNN_MEMORY_ARENA && !DNN_DISABLE_MEMORY_OPTIMIZATIONS &&
+                        preferableBackend == DNN_BACKEND_OPENCV && preferableTarget == DNN_TARGET_CPU;
+        size_t maxBlobTotal = 0;
+        for (LayersShapesMap::const_iterator shapesIt = layersShapes.begin(); shapesIt != layersShapes.end(); ++shapesIt)
+        {
+            for (size_t i = 0; i < shapesIt->second.out.size(); i++)
+                maxBlobTotal = std::max(maxBlobTotal, (size_t)total(shapesIt->second.out[i]));
+            for (size_t i = 0; i < shapesIt->second.internal.size(); i++)
+                maxBlobTotal = std::max(maxBlobTotal, (size_t)total(shapesIt->second.internal[i]));
+        }
+        blobManager.reset(useArena, maxBlobTotal);
         backendWrappers.clear();
 
         for(auto& layer : layers)
@@ -3152,10 +3373,42 @@ struct Net::Impl : public detail::NetImplBase
             allocateLayer(lid, layersShapes);
         }
 
+        if (useArena)
+            blobManager.allocateArena(layers);
+
         layersTimings.resize(lastLayerId + 1, 0);
         fuseLayers(blobsToKeep_);
     }
 
+    // Number of bytes in all distinct buffers referred by the output and internal blobs.
+    size_t getBlobsMemory() const
+    {
+        std::set<const UMatData*> buffers;
+        size_t bytes = 0;
+        for (MapIdToLayerData::const_iterator it = layers.begin(); it != layers.end(); ++it)
+        {
+            const LayerData& ld = it->second;
+            for (size_t i = 0; i < ld.outputBlobs.size() + ld.internals.size(); i++)
+            {
+                const Mat& m = i < ld.outputBlobs.size() ? ld.outputBlobs[i] : ld.internals[i - ld.outputBlobs.size()];
+                if (m.u && buffers.insert(m.u).second)
+                    bytes += m.u->size;
+            }
+        }
+        return bytes;
+    }
+
+    void updateInt8InputRanges(int lid, const std::vector<Mat>& inps)
+    {
+        std::vector<float>& ranges = int8InputRanges[lid];
+        ranges.resize(inps.size(), 0.f);
+        for (size_t i = 0; i < inps.size(); ++i)
+        {
+            if (inps[i].depth() == CV_32F)
+                ranges[i] = std::max(ranges[i], (float)norm(inps[i], NORM_INF));
+        }
+    }
+
     void forwardLayer(LayerData &ld)
     {
         CV_TRACE_FUNCTION();
@@ -3265,6 +3518,8 @@ struct Net::Impl : public detail::NetImplBase
                     {
                         inps[i] = *ld.inputBlobs[i];
                     }
+                    if (int8Calibration)
+                        updateInt8InputRanges(ld.id, inps);
                     layer->forward(inps, ld.outputBlobs, ld.internals);
 
                     if (DNN_CHECK_NAN_INF)
@@ -3995,7 +4250,9 @@ int Net::addLayer(const String &name, const String &type, LayerParams &params)
 
     int id = ++impl->lastLayerId;
     impl->layerNameToId.insert(std::make_pair(name, id));
-    impl->layers.insert(std::make_pair(id, LayerData(id, name, type, params)));
+    LayerData& ld = impl->layers.insert(std::make_pair(id, LayerData(id, name, type, params))).first->second;
+    if (type == "Convolution" && !impl->useWinograd)
+        ld.params.set("use_winograd", false);
     if (params.get<bool>("has_dynamic_shapes", false))
         impl->hasDynamicShapes = true;
 
@@ -4969,6 +5226,22 @@ void Net::getMemoryConsumption(const MatShape& netInputShape, std::vector<int>&
                          weights, blobs);
 }
 
+size_t Net::getPeakBlobsMemory()
+{
+    CV_TRACE_FUNCTION();
+    CV_Assert(!empty());
+
+    if (!impl->netWasAllocated)
+    {
+        // the same outputs as forward() without arguments
+        std::vector<String> layerNames = getLayerNames();
+        CV_Assert(!layerNames.empty());
+        std::vector<LayerPin> pins(1, impl->getPinByAlias(layerNames.back()));
+        impl->setUpNet(pins);
+    }
+    return impl->getBlobsMemory();
+}
+
 void Net::enableFusion(bool fusion)
 {
     if( impl->fusion != fusion )
@@ -4979,6 +5252,82 @@ void Net::enableFusion(bool fusion)
     }
 }
 
+void Net::enableWinograd(bool useWinograd)
+{
+    if( impl->useWinograd != useWinograd )
+    {
+        impl->useWinograd = useWinograd;
+        // the layers which are not created yet get the flag from their parameters
+        for (Impl::MapIdToLayerData::iterator it = impl->layers.begin(); it != impl->layers.end(); ++it)
+        {
+            LayerData& ld = it->second;
+            if (ld.type != "Convolution")
+                continue;
+            ld.params.set("use_winograd", useWinograd);
+            if (!ld.layerInstance.empty())
+                setConvolutionWinograd(ld.layerInstance, useWinograd);
+        }
+        impl->netWasAllocated = false;
+        impl->clear();
+    }
+}
+
+void Net::quantize(InputArrayOfArrays calibData)
+{
+    CV_TRACE_FUNCTION();
+    CV_Assert(!empty());
+
+    std::vector<Mat> samples;
+    calibData.getMatVector(samples);
+    CV_Assert(!samples.empty());
+
+    // the configuration is checked before the calibration forward passes
+    int backend = impl->preferableBackend == DNN_BACKEND_DEFAULT ? PARAM_DNN_BACKEND_DEFAULT : impl->preferableBackend;
+    if (backend != DNN_BACKEND_OPENCV || impl->preferableTarget != DNN_TARGET_CPU)
+        CV_Error(Error::StsNotImplemented, "DNN: 8-bit quantization is supported by OpenCV backend on CPU target only");
+
+    // calibration is done in floating point
+    for (Impl::MapIdToLayerData::iterator it = impl->layers.begin(); it != impl->layers.end(); ++it)
+    {
+        if (!it->second.layerInstance.empty())
+            it->second.layerInstance->tryQuantize(std::vector<float>());
+    }
+
+    std::vector<String> outNames = getUnconnectedOutLayersNames();
+    impl->int8InputRanges.clear();
+    impl->int8Calibration = true;
+    try
+    {
+        for (size_t i = 0; i < samples.size(); ++i)
+        {
+            std::vector<Mat> outs;
+            setInput(samples[i]);
+            forward(outs, outNames);
+        }
+    }
+    catch (...)
+    {
+        impl->int8Calibration = false;
+        throw;
+    }
+    impl->int8Calibration = false;
+
+    int numQuantized = 0;
+    for (Impl::MapIdToLayerData::iterator it = impl->layers.begin(); it != impl->layers.end(); ++it)
+    {
+        LayerData& ld = it->second;
+        std::map<int, std::vector<float> >::const_iterator rangesIt = impl->int8InputRanges.find(ld.id);
+        if (rangesIt != impl->int8InputRanges.end() && !ld.skip && !ld.layerInstance.empty() &&
+            ld.layerInstance->tryQuantize(rangesIt->second))
+        {
+            CV_LOG_DEBUG(NULL, "DNN: layer '" << ld.name << "' of type " << ld.type << " is quantized"
+                         << " (input range: " << rangesIt->second[0] << ")");
+            numQuantized++;
+        }
+    }
+    CV_LOG_INFO(NULL, "DNN: " << numQuantized << " layers switched to 8-bit integer inference");
+}
+
 void Net::setHalideScheduler(const String& scheduler)
 {
     CV_TRACE_FUNCTION();
@@ -5142,6 +5491,7 @@ Ptr<BackendNode> Layer::tryAttach(const Ptr<BackendNode>& node)
 
 bool Layer::setActivation(const Ptr<ActivationLayer>&) { return false; }
 bool Layer::tryFuse(Ptr<Layer>&) { return false; }
+bool Layer::tryQuantize(const std::vector<float>&) { return false; }
 void Layer::getScaleShift(Mat& scale, Mat& shift) const
 {
     scale = Mat();
@@ -13,6 +13,9 @@ CV__DNN_INLINE_NS_BEGIN
 Mutex& getInitializationMutex();
 void initializeLayerFactory();
 
+// allows or disallows the Winograd algorithm in an instantiated convolution layer, see Net::enableWinograd()
+void setConvolutionWinograd(const Ptr<Layer>& layer, bool useWinograd);
+
 namespace detail {
 
 struct NetImplBase
@@ -247,6 +247,15 @@ public:
     std::vector<float> reluslope;
     Ptr<ActivationLayer> activ;
 
+    // 8-bit quantized inference, see tryQuantize()
+    float int8InputRange;
+    Mat weightsInt8, inputInt8;
+    std::vector<float> int8Multipliers;
+
+    // weights transformed for Winograd convolution, see ParallelConvWinograd
+    Mat weightsWinograd;
+    bool useWinograd;  // see Net::enableWinograd()
+
 #ifdef HAVE_OPENCL
     Ptr<OCL4DNNConvSpatial<float> > convolutionOp;
     std::vector<UMat> umat_blobs;
@@ -268,6 +277,8 @@ public:
 
     ConvolutionLayerImpl(const LayerParams &params) : BaseConvolutionLayerImpl(params)
     {
+        int8InputRange = 0.f;
+        useWinograd = params.get<bool>("use_winograd", true);
 #ifdef HAVE_OPENCL
         newActiv = false;
         activType = OCL4DNN_CONV_FUSED_ACTIV_NONE;
@@ -415,6 +426,11 @@ public:
         }
 
         weightsMultipliers.assign(numOutput, 1.0);
+        weightsInt8.release();
+        weightsWinograd.release();
+        // the kernels are transformed once here and after the fusions, not on the forward pass
+        if (!blobs.empty() && canUseWinograd(inputs[0], inputs[0].size[1]/blobs[0].size[1]))
+            ParallelConvWinograd::transformWeights(weightsMat, blobs[0].size[1], weightsWinograd);
 
         Mat biasMat = hasBias() ? blobs[1].reshape(1, numOutput) : Mat();
         biasvec.resize(numOutput+2);
@@ -584,11 +600,32 @@ public:
         return BaseConvolutionLayerImpl::tryFuse(top);
     }
 
+    virtual bool tryQuantize(const std::vector<float>& inputRanges) CV_OVERRIDE
+    {
+        weightsInt8.release();
+        inputInt8.release();
+        int8InputRange = 0.f;
+#ifdef HAVE_TENGINE
+        // convolutions are delegated to Tengine
+        return false;
+#else
+        if (inputRanges.empty() || !(inputRanges[0] > 0.f) || blobs.empty() ||
+            kernel_size.size() != 2 || preferableTarget != DNN_TARGET_CPU)
+            return false;
+        // weights are quantized on the first forward pass when all the fusions are done
+        int8InputRange = inputRanges[0];
+        return true;
+#endif
+    }
+
     void fuseWeights(const Mat& w_, const Mat& b_) CV_OVERRIDE
     {
         // Convolution weights have OIHW data layout. Parameters fusion in case of
         // (conv(I) + b1 ) * w + b2
         // means to replace convolution's weights to [w*conv(I)] and bias to [b1 * w + b2]
+        weightsInt8.release();
+        bool winograd = !weightsWinograd.empty();
+        weightsWinograd.release();
         const int outCn = weightsMat.size[0];
         Mat w = w_.total() == 1 ? Mat(1, outCn, CV_32F, Scalar(w_.at<float>(0))) : w_;
         Mat b = b_.total() == 1 ? Mat(1, outCn, CV_32F, Scalar(b_.at<float>(0))) : b_;
@@ -617,6 +654,9 @@ public:
                 biasvec[i] += b.at<float>(i);
         }
         biasvec[outCn] = biasvec[outCn+1] = biasvec[outCn-1];
+
+        if (winograd)
+            ParallelConvWinograd::transformWeights(weightsMat, blobs[0].size[1], weightsWinograd);
     }
 
     virtual Ptr<BackendNode> initVkCom(const std::vector<Ptr<BackendWrapper> > &inputs) CV_OVERRIDE
@@ -1662,6 +1702,497 @@ public:
         }
     };
 
+    // 2D convolution over the 8-bit quantized input and weights.
+    // Accumulation is done in 32-bit integers, results are dequantized
+    // with the per-output-channel multipliers (inputScale*weightsScale[i]).
+    class ParallelConvInt8 : public cv::ParallelLoopBody
+    {
+    public:
+        enum { BLK_SIZE = 32 };
+
+        const Mat* input_;
+        const Mat* weights_;
+        Mat* output_;
+        int ngroups_, stripesPerSample_, stripeSize_;
+        int kernel_h, kernel_w, stride_h, stride_w, pad_t, pad_l, dilation_h, dilation_w;
+        const std::vector<float>* multipliers_;
+        const std::vector<float>* biasvec_;
+        const std::vector<float>* reluslope_;
+        const ActivationLayer* activ_;
+
+        ParallelConvInt8()
+            : input_(0), weights_(0), output_(0), ngroups_(0), stripesPerSample_(0), stripeSize_(0),
+              kernel_h(0), kernel_w(0), stride_h(0), stride_w(0), pad_t(0), pad_l(0),
+              dilation_h(0), dilation_w(0), multipliers_(0), biasvec_(0), reluslope_(0), activ_(0)
+        {}
+
+        static void run( const Mat& input, Mat& output, const Mat& weights,
+                         const std::vector<float>& multipliers,
+                         const std::vector<float>& biasvec,
+                         const std::vector<float>& reluslope,
+                         const std::vector<size_t>& kernel_size, const std::vector<size_t>& strides,
+                         const std::vector<size_t>& pads_begin, const std::vector<size_t>& dilations,
+                         const ActivationLayer* activ, int ngroups, int nstripes )
+        {
+            CV_Assert_N(input.dims == 4, output.dims == 4,
+                        input.size[0] == output.size[0],
+                        weights.rows == output.size[1],
+                        weights.cols % VEC_ALIGN_INT8 == 0,
+                        weights.cols >= (input.size[1]/ngroups)*(int)(kernel_size[0]*kernel_size[1]));
+            CV_Assert_N(input.type() == CV_8SC1, weights.type() == CV_8SC1,
+                        output.type() == CV_32FC1,
+                        input.isContinuous(), output.isContinuous(),
+                        multipliers.size() == (size_t)output.size[1],
+                        biasvec.size() == (size_t)output.size[1]+2);
+            ParallelConvInt8 p;
+
+            p.input_ = &input;
+            p.weights_ = &weights;
+            p.output_ = &output;
+            p.ngroups_ = ngroups;
+            p.kernel_h = (int)kernel_size[0]; p.kernel_w = (int)kernel_size[1];
+            p.stride_h = (int)strides[0]; p.stride_w = (int)strides[1];
+            p.pad_t = (int)pads_begin[0]; p.pad_l = (int)pads_begin[1];
+            p.dilation_h = (int)dilations[0]; p.dilation_w = (int)dilations[1];
+            p.multipliers_ = &multipliers;
+            p.biasvec_ = &biasvec;
+            p.reluslope_ = &reluslope;
+            p.activ_ = reluslope.empty() ? activ : 0;
+
+            int batchSize = input.size[0]*ngroups;
+            int outPlaneSize = (int)output.total(2);
+            p.stripesPerSample_ = std::max((nstripes + batchSize - 1)/batchSize, 1);
+            p.stripeSize_ = (int)alignSize((outPlaneSize + p.stripesPerSample_ - 1)/p.stripesPerSample_, BLK_SIZE);
+            p.stripesPerSample_ = (outPlaneSize + p.stripeSize_ - 1)/p.stripeSize_;
+
+            parallel_for_(Range(0, batchSize*p.stripesPerSample_), p, nstripes);
+        }
+
+        virtual void operator ()(const Range &r) const CV_OVERRIDE
+        {
+            int ngroups = ngroups_;
+            int outW = output_->size[3], outH = output_->size[2];
+            int outCn = output_->size[1]/ngroups;
+            int height = input_->size[2], width = input_->size[3];
+            int inpCn = input_->size[1]/ngroups;
+            int karea = kernel_h*kernel_w;
+            int vsz = inpCn*karea, vsz_a = weights_->cols;
+            int inpPlaneSize = height*width;
+            int outPlaneSize = outH*outW;
+
+            const schar* data_inp0_ = input_->ptr<schar>();
+            float* data_out0_ = output_->ptr<float>();
+            const float* reluptr_ = reluslope_->empty() ? 0 : &reluslope_->at(0);
+
+            // the padding part of each row (between vsz and vsz_a) is never written,
+            // so it is enough to clear the buffer once
+            AutoBuffer<schar> rowbuf_(BLK_SIZE*vsz_a);
+            schar* rowbuf0 = rowbuf_.data();
+            memset(rowbuf0, 0, BLK_SIZE*vsz_a);
+
+            for( int stripe = r.start; stripe < r.end; stripe++ )
+            {
+                int subsampleIdx = stripe/stripesPerSample_;
+                int stripeStart = (stripe - subsampleIdx*stripesPerSample_)*stripeSize_;
+                int stripeEnd = std::min(stripeStart + stripeSize_, outPlaneSize);
+                const schar* data_inp0 = data_inp0_ + (size_t)subsampleIdx*inpPlaneSize*inpCn;
+                float* data_out0 = data_out0_ + (size_t)subsampleIdx*outPlaneSize*outCn;
+                int startOutCn = (subsampleIdx % ngroups)*outCn;
+                const schar* wptr = weights_->ptr<schar>(startOutCn);
+                const float* multptr = &multipliers_->at(startOutCn);
+                const float* biasptr = &biasvec_->at(startOutCn);
+
+                for( int ofs0 = stripeStart; ofs0 < stripeEnd; ofs0 += BLK_SIZE )
+                {
+                    int ofs1 = std::min(ofs0 + (int)BLK_SIZE, stripeEnd);
+                    int bsz = ofs1 - ofs0;
+
+                    // im2row
+                    for( int ofs = ofs0; ofs < ofs1; ofs++ )
+                    {
+                        schar* rowbuf = rowbuf0 + (ofs - ofs0)*vsz_a;
+                        int out_i = ofs / outW, out_j = ofs - out_i*outW;
+                        int in_i = out_i*stride_h - pad_t, in_j = out_j*stride_w - pad_l;
+                        int i0 = std::max(0, (-in_i + dilation_h-1)/dilation_h);
+                        int i1 = std::min(kernel_h, (height - in_i + dilation_h-1)/dilation_h);
+                        int j0 = std::max(0, (-in_j + dilation_w-1)/dilation_w);
+                        int j1 = std::min(kernel_w, (width - in_j + dilation_w-1)/dilation_w);
+                        const schar* imgptr = data_inp0 + in_i*width + in_j;
+
+                        if( i0 > 0 || j0 > 0 || i1 < kernel_h || j1 < kernel_w )
+                            memset(rowbuf, 0, vsz);
+                        for( int k = 0; k < inpCn; k++, imgptr += inpPlaneSize, rowbuf += karea )
+                            for( int i = i0; i < i1; i++ )
+                                for( int j = j0; j < j1; j++ )
+                                    rowbuf[i*kernel_w + j] = imgptr[i*dilation_h*width + j*dilation_w];
+                    }
+
+                    fastConvInt8(wptr, weights_->step1(), multptr, biasptr, rowbuf0,
+                                 data_out0 + ofs0, outPlaneSize, outCn, bsz, vsz_a);
+
+                    if( reluptr_ )
+                    {
+                        for( int i = 0; i < outCn; i++ )
+                        {
+                            float slope = reluptr_[startOutCn + i];
+                            float* outptr = data_out0 + i*outPlaneSize;
+                            for( int j = ofs0; j < ofs1; j++ )
+                                outptr[j] = outptr[j] > 0.f ? outptr[j] : outptr[j]*slope;
+                        }
+                    }
+                }
+
+                if( activ_ )
+                    activ_->forwardSlice(data_out0 + stripeStart, data_out0 + stripeStart,
+                                         stripeEnd - stripeStart,
+                                         outPlaneSize, startOutCn, startOutCn + outCn);
+            }
+        }
+    };
+
+    void forwardInt8(const Mat& input, Mat& output, int ngroups)
+    {
+        if (weightsInt8.empty())
+        {
+            std::vector<float> weightsScales;
+            quantizeWeightsInt8(weightsMat, weightsInt8, weightsScales);
+            float inputScale = int8InputRange / 127.f;
+            int8Multipliers.resize(numOutput);
+            for (int i = 0; i < numOutput; i++)
+                int8Multipliers[i] = weightsScales[i] * inputScale;
+        }
+
+        CV_Assert(input.isContinuous() && input.type() == CV_32F);
+        int nstripes = std::max(getNumThreads(), 1);
+        inputInt8.create(input.dims, input.size.p, CV_8S);
+        const float* src = input.ptr<float>();
+        schar* dst = inputInt8.ptr<schar>();
+        const int total = (int)input.total();
+        const float scale = 127.f / int8InputRange;
+        parallel_for_(Range(0, nstripes), [&](const Range& r)
+        {
+            int start = (int)((int64)r.start * total / nstripes);
+            int end = (int)((int64)r.end * total / nstripes);
+            quantizeToInt8(src + start, dst + start, end - start, scale);
+        }, nstripes);
+
+        ParallelConvInt8::run(inputInt8, output, weightsInt8, int8Multipliers, biasvec, reluslope,
+                              kernel_size, strides, pads_begin, dilations, activ.get(), ngroups, nstripes);
+    }
+
+    // Winograd F(6x6, 3x3) convolution for non-grouped 3x3 layers with unit strides and dilations.
+    // Every 6x6 output tile is computed from the 8x8 input tile as Y = A^T [U .* V] A, where
+    // U = G g G^T are the pre-transformed weights and V = B^T d B is the transformed input tile.
+    // The element-wise products are accumulated over input channels as 64 independent GEMMs,
+    // so that a tile takes 64 multiplications per channels pair instead of 324 ones.
+    class ParallelConvWinograd : public cv::ParallelLoopBody
+    {
+    public:
+        enum { TILE_IN = 8, TILE_OUT = 6, TILE_AREA = TILE_IN*TILE_IN, BLK_TILES = 8 };
+
+        const Mat* input_;
+        const Mat* weights_;
+        Mat* output_;
+        int pad_t, pad_l, tilesY, tilesX, ntiles, nblocks;
+        const std::vector<float>* biasvec_;
+        const std::vector<float>* reluslope_;
+        const ActivationLayer* activ_;
+
+        ParallelConvWinograd()
+            : input_(0), weights_(0), output_(0), pad_t(0), pad_l(0), tilesY(0), tilesX(0),
+              ntiles(0), nblocks(0), biasvec_(0), reluslope_(0), activ_(0)
+        {}
+
+        // U = G g G^T for every (output channel, input channel) pair.
+        // The result is a TILE_AREA x (outCn*inpCn) matrix, i.e. row k keeps the outCn x inpCn
+        // matrix of the k-th element of the transformed kernels.
+        static void transformWeights(const Mat& weights, int inpCn, Mat& wtrans)
+        {
+            CV_Assert(weights.type() == CV_32F && weights.cols == inpCn*9);
+            int outCn = weights.rows;
+            wtrans.create(TILE_AREA, outCn*inpCn, CV_32F);
+            size_t wtstep = wtrans.step1();
+            float* wtptr = wtrans.ptr<float>();
+
+            for( int oc = 0; oc < outCn; oc++ )
+            {
+                const float* wptr = weights.ptr<float>(oc);
+                for( int ic = 0; ic < inpCn; ic++, wptr += 9 )
+                {
+                    float tmp[TILE_IN][3], u[TILE_IN];
+                    for( int j = 0; j < 3; j++ )
+                    {
+                        transformKernel1D(wptr[j], wptr[3 + j], wptr[6 + j], u);
+                        for( int i = 0; i < TILE_IN; i++ )
+                            tmp[i][j] = u[i];
+                    }
+                    for( int i = 0; i < TILE_IN; i++ )
+                    {
+                        transformKernel1D(tmp[i][0], tmp[i][1], tmp[i][2], u);
+                        for( int j = 0; j < TILE_IN; j++ )
+                            wtptr[(i*TILE_IN + j)*wtstep + oc*inpCn + ic] = u[j];
+                    }
+                }
+            }
+        }
+
+        static void run( const Mat& input, Mat& output, const Mat& wtrans,
+                         const std::vector<float>& biasvec,
+                         const std::vector<float>& reluslope,
+                         const std::vector<size_t>& pads_begin,
+                         const ActivationLayer* activ, int nstripes )
+        {
+            int inpCn = input.size[1], outCn = output.size[1];
+            CV_Assert_N(input.dims == 4, output.dims == 4,
+                        input.size[0] == output.size[0],
+                        input.type() == CV_32FC1, output.type() == CV_32FC1,
+                        input.isContinuous(), output.isContinuous(),
+                        wtrans.rows == TILE_AREA, wtrans.cols == outCn*inpCn,
+                        biasvec.size() == (size_t)outCn+2);
+            ParallelConvWinograd p;
+
+            p.input_ = &input;
+            p.weights_ = &wtrans;
+            p.output_ = &output;
+            p.pad_t = (int)pads_begin[0];
+            p.pad_l = (int)pads_begin[1];
+            p.tilesY = (output.size[2] + TILE_OUT - 1)/TILE_OUT;
+            p.tilesX = (output.size[3] + TILE_OUT - 1)/TILE_OUT;
+            p.ntiles = input.size[0]*p.tilesY*p.tilesX;
+            p.nblocks = (p.ntiles + BLK_TILES - 1)/BLK_TILES;
+            p.biasvec_ = &biasvec;
+            p.reluslope_ = &reluslope;
+            p.activ_ = reluslope.empty() ? activ : 0;
+
+            parallel_for_(Range(0, p.nblocks), p, nstripes);
+        }
+
+        static inline void transformKernel1D(float g0, float g1, float g2, float* r)
+        {
+            r[0] = g0;
+            r[1] = -2.f/9*(g0 + g1 + g2);
+            r[2] = -2.f/9*(g0 - g1 + g2);
+            r[3] = 1.f/90*g0 + 1.f/45*g1 + 2.f/45*g2;
+            r[4] = 1.f/90*g0 - 1.f/45*g1 + 2.f/45*g2;
+            r[5] = 32.f/45*g0 + 16.f/45*g1 + 8.f/45*g2;
+            r[6] = 32.f/45*g0 - 16.f/45*g1 + 8.f/45*g2;
+            r[7] = g2;
+        }
+
+        // r = B^T d, d and r are accessed with the given steps
+        static inline void transformInput1D(const float* d, int dstep, float* r, int rstep)
+        {
+            float d0 = d[0], d1 = d[dstep], d2 = d[dstep*2], d3 = d[dstep*3],
+                  d4 = d[dstep*4], d5 = d[dstep*5], d6 = d[dstep*6], d7 = d[dstep*7];
+            r[0] = d0 - d6 + (d4 - d2)*5.25f;
+            r[rstep*7] = d7 - d1 + (d3 - d5)*5.25f;
+            float t1 = d2 + d6 - d4*4.25f, t2 = d1 + d5 - d3*4.25f;
+            r[rstep] = t1 + t2;
+            r[rstep*2] = t1 - t2;
+            t1 = d6 + d2*0.25f - d4*1.25f;
+            t2 = d1*0.5f - d3*2.5f + d5*2.f;
+            r[rstep*3] = t1 + t2;
+            r[rstep*4] = t1 - t2;
+            t1 = d6 + (d2 - d4*1.25f)*4.f;
+            t2 = d1*2.f - d3*2.5f + d5*0.5f;
+            r[rstep*5] = t1 + t2;
+            r[rstep*6] = t1 - t2;
+        }
+
+        // r = A^T m, m and r are accessed with the given steps
+        static inline void transformOutput1D(const float* m, int mstep, float* r, int rstep)
+        {
+            float m0 = m[0], m1 = m[mstep], m2 = m[mstep*2], m3 = m[mstep*3],
+                  m4 = m[mstep*4], m5 = m[mstep*5], m6 = m[mstep*6], m7 = m[mstep*7];
+            float a024 = m1 + m2, a135 = m1 - m2;
+            float b024 = m3 + m4, b135 = m3 - m4;
+            float c024 = m5 + m6, c135 = m5 - m6;
+            r[0] = m0 + a024 + b024 + c024;
+            r[rstep] = a135 + b135*2.f + c135*0.5f;
+            r[rstep*2] = a024 + b024*4.f + c024*0.25f;
+            r[rstep*3] = a135 + b135*8.f + c135*0.125f;
+            r[rstep*4] = a024 + b024*16.f + c024*0.0625f;
+            r[rstep*5] = m7 + a135 + b135*32.f + c135*0.03125f;
+        }
+
+        virtual void operator ()(const Range &r) const CV_OVERRIDE
+        {
+            int inpCn = input_->size[1], outCn = output_->size[1];
+            int height = input_->size[2], width = input_->size[3];
+            int outH = output_->size[2], outW = output_->size[3];
+            size_t inpPlaneSize = (size_t)height*width, outPlaneSize = (size_t)outH*outW;
+            const float* biasptr = &biasvec_->at(0);
+            const float* reluptr = reluslope_->empty() ? 0 : &reluslope_->at(0);
+            size_t wstep = weights_->step1();
+
+            // transformed input tiles: TILE_AREA x inpCn x BLK_TILES
+            // and products accumulated over the input channels: TILE_AREA x outCn x BLK_TILES
+            AutoBuffer<float> vbuf_((size_t)TILE_AREA*inpCn*BLK_TILES), mbuf_((size_t)TILE_AREA*outCn*BLK_TILES);
+            float* vbuf = vbuf_.data();
+            float* mbuf = mbuf_.data();
+
+            for( int blk = r.start; blk < r.end; blk++ )
+            {
+                int tile0 = blk*BLK_TILES;
+                int ntiles_blk = std::min(ntiles - tile0, (int)BLK_TILES);
+
+                // input transform
+                for( int t = 0; t < BLK_TILES; t++ )
+                {
+                    if( t >= ntiles_blk )
+                    {
+                        for( int k = 0; k < TILE_AREA; k++ )
+                            for( int ic = 0; ic < inpCn; ic++ )
+                                vbuf[(k*inpCn + ic)*BLK_TILES + t] = 0.f;
+                        continue;
+                    }
+                    int tile = tile0 + t;
+                    int n = tile/(tilesY*tilesX), ty = (tile/tilesX) % tilesY, tx = tile % tilesX;
+                    int y0 = ty*TILE_OUT - pad_t, x0 = tx*TILE_OUT - pad_l;
+                    bool inside = y0 >= 0 && x0 >= 0 && y0 + TILE_IN <= height && x0 + TILE_IN <= width;
+                    const float* inptr = input_->ptr<float>(n) + y0*width + x0;
+
+                    for( int ic = 0; ic < inpCn; ic++, inptr += inpPlaneSize )
+                    {
+                        float d[TILE_AREA], tmp[TILE_AREA], v[TILE_AREA];
+                        const float* dptr = inptr;
+                        int dstep = width;
+                        if( !inside )
+                        {
+                            for( int i = 0; i < TILE_IN; i++ )
+                                for( int j = 0; j < TILE_IN; j++ )
+                                {
+                                    int y = y0 + i, x = x0 + j;
+                                    d[i*TILE_IN + j] = (unsigned)y < (unsigned)height && (unsigned)x < (unsigned)width ?
+                                                       inptr[i*width + j] : 0.f;
+                                }
+                            dptr = d;
+                            dstep = TILE_IN;
+                        }
+                        for( int i = 0; i < TILE_IN; i++ )
+                            transformInput1D(dptr + i*dstep, 1, tmp + i*TILE_IN, 1);
+                        for( int j = 0; j < TILE_IN; j++ )
+                            transformInput1D(tmp + j, TILE_IN, v + j, TILE_IN);
+                        for( int k = 0; k < TILE_AREA; k++ )
+                            vbuf[(k*inpCn + ic)*BLK_TILES + t] = v[k];
+                    }
+                }
+
+                // M_k = U_k * V_k for every element of the tile
+                for( int k = 0; k < TILE_AREA; k++ )
+                {
+                    const float* uk = weights_->ptr<float>() + k*wstep;
+                    const float* vk = vbuf + (size_t)k*inpCn*BLK_TILES;
+                    float* mk = mbuf + (size_t)k*outCn*BLK_TILES;
+                    int oc = 0;
+                #if CV_SIMD128
+                    for( ; oc <= outCn - 4; oc += 4 )
+                    {
+                        const float* u0 = uk + oc*inpCn;
+                        const float* u1 = u0 + inpCn;
+                        const float* u2 = u1 + inpCn;
+                        const float* u3 = u2 + inpCn;
+                        v_float32x4 s00 = v_setzero_f32(), s01 = v_setzero_f32(),
+                                    s10 = v_setzero_f32(), s11 = v_setzero_f32(),
+                                    s20 = v_setzero_f32(), s21 = v_setzero_f32(),
+                                    s30 = v_setzero_f32(), s31 = v_setzero_f32();
+                        for( int ic = 0; ic < inpCn; ic++ )
+                        {
+                            v_float32x4 v0 = v_load(vk + ic*BLK_TILES);
+                            v_float32x4 v1 = v_load(vk + ic*BLK_TILES + 4);
+                            v_float32x4 w = v_setall_f32(u0[ic]);
+                            s00 = v_fma(w, v0, s00); s01 = v_fma(w, v1, s01);
+                            w = v_setall_f32(u1[ic]);
+                            s10 = v_fma(w, v0, s10); s11 = v_fma(w, v1, s11);
+                            w = v_setall_f32(u2[ic]);
+                            s20 = v_fma(w, v0, s20); s21 = v_fma(w, v1, s21);
+                            w = v_setall_f32(u3[ic]);
+                            s30 = v_fma(w, v0, s30); s31 = v_fma(w, v1, s31);
+                        }
+                        float* mptr = mk + oc*BLK_TILES;
+                        v_store(mptr, s00); v_store(mptr + 4, s01);
+                        v_store(mptr + BLK_TILES, s10); v_store(mptr + BLK_TILES + 4, s11);
+                        v_store(mptr + BLK_TILES*2, s20); v_store(mptr + BLK_TILES*2 + 4, s21);
+                        v_store(mptr + BLK_TILES*3, s30); v_store(mptr + BLK_TILES*3 + 4, s31);
+                    }
+                #endif
+                    for( ; oc < outCn; oc++ )
+                    {
+                        const float* u0 = uk + oc*inpCn;
+                        float s[BLK_TILES] = {0.f};
+                        for( int ic = 0; ic < inpCn; ic++ )
+                        {
+                            float w = u0[ic];
+                            for( int t = 0; t < BLK_TILES; t++ )
+                                s[t] += w*vk[ic*BLK_TILES + t];
+                        }
+                        for( int t = 0; t < BLK_TILES; t++ )
+                            mk[oc*BLK_TILES + t] = s[t];
+                    }
+                }
+
+                // output transform
+                for( int t = 0; t < ntiles_blk; t++ )
+                {
+                    int tile = tile0 + t;
+                    int n = tile/(tilesY*tilesX), ty = (tile/tilesX) % tilesY, tx = tile % tilesX;
+                    int y0 = ty*TILE_OUT, x0 = tx*TILE_OUT;
+                    int h = std::min((int)TILE_OUT, outH - y0), w = std::min((int)TILE_OUT, outW - x0);
+                    float* outptr0 = output_->ptr<float>(n) + y0*outW + x0;
+
+                    for( int oc = 0; oc < outCn; oc++ )
+                    {
+                        float m[TILE_AREA], tmp[TILE_IN*TILE_OUT], y[TILE_OUT*TILE_OUT];
+                        for( int k = 0; k < TILE_AREA; k++ )
+                            m[k] = mbuf[((size_t)k*outCn + oc)*BLK_TILES + t];
+                        for( int i = 0; i < TILE_IN; i++ )
+                            transformOutput1D(m + i*TILE_IN, 1, tmp + i*TILE_OUT, 1);
+                        for( int j = 0; j < TILE_OUT; j++ )
+                            transformOutput1D(tmp + j, TILE_OUT, y + j, TILE_OUT);
+
+                        float bias = biasptr[oc];
+                        float slope = reluptr ? reluptr[oc] : 1.f;
+                        float* outptr = outptr0 + oc*outPlaneSize;
+                        for( int i = 0; i < h; i++ )
+                            for( int j = 0; j < w; j++ )
+                            {
+                                float val = y[i*TILE_OUT + j] + bias;
+                                if( reluptr )
+                                    val = val > 0.f ? val : val*slope;
+                                outptr[i*outW + j] = val;
+                            }
+                    }
+
+                    if( activ_ )
+                    {
+                        for( int i = 0; i < h; i++ )
+                            activ_->forwardSlice(outptr0 + i*outW, outptr0 + i*outW, w,
+                                                 outPlaneSize, 0, outCn);
+                    }
+                }
+            }
+        }
+    };
+
+    bool canUseWinograd(const Mat& input, int ngroups) const
+    {
+        // the transforms pay off only if there are enough channels to accumulate over
+        return useWinograd && !blobs.empty() && input.dims == 4 && ngroups == 1 &&
+               kernel_size[0] == 3 && kernel_size[1] == 3 &&
+               strides[0] == 1 && strides[1] == 1 &&
+               dilations[0] == 1 && dilations[1] == 1 &&
+               input.size[1] >= 16 && numOutput >= 16 &&
+               input.size[2] + pads_begin[0] + pads_end[0] >= 8 &&
+               input.size[3] + pads_begin[1] + pads_end[1] >= 8;
+    }
+
+    void forwardWinograd(const Mat& input, Mat& output)
+    {
+        int nstripes = std::max(getNumThreads(), 1);
+        ParallelConvWinograd::run(input, output, weightsWinograd, biasvec, reluslope,
+                                  pads_begin, activ.get(), nstripes);
+    }
+
 #ifdef HAVE_OPENCL
     bool forward_ocl(InputArrayOfArrays inps, OutputArrayOfArrays outs, OutputArrayOfArrays internals)
     {
@@ -1966,6 +2497,15 @@ public:
         }
         if(false == tengine_ret)
 #endif
+        if (int8InputRange > 0.f && inputs[0].dims == 4)
+        {
+            forwardInt8(inputs[0], outputs[0], ngroups);
+        }
+        else if (!weightsWinograd.empty() && canUseWinograd(inputs[0], ngroups))
+        {
+            forwardWinograd(inputs[0], outputs[0]);
+        }
+        else
         {
             int nstripes = std::max(getNumThreads(), 1);
 
@@ -2940,5 +3480,14 @@ Ptr<BaseConvolutionLayer> DeconvolutionLayer::create(const LayerParams &params)
     return Ptr<BaseConvolutionLayer>(new DeConvolutionLayerImpl(params));
 }
 
+CV__DNN_INLINE_NS_BEGIN
+void setConvolutionWinograd(const Ptr<Layer>& layer, bool useWinograd)
+{
+    Ptr<ConvolutionLayerImpl> conv = layer.dynamicCast<ConvolutionLayerImpl>();
+    if (!conv.empty())
+        conv->useWinograd = useWinograd;
+}
+CV__DNN_INLINE_NS_END
+
 }
 }
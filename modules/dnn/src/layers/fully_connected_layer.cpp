@@ -78,6 +78,7 @@ public:
     FullyConnectedLayerImpl(const LayerParams& params)
     {
         setParamsFrom(params);
+        int8InputRange = 0.f;
         bias = params.get<bool>("bias_term", true);
         axis = params.get<int>("axis", 1);
         if (!blobs.empty())
@@ -164,6 +165,24 @@ public:
             return false;
     }
 
+    virtual bool tryQuantize(const std::vector<float>& inputRanges) CV_OVERRIDE
+    {
+        weightsInt8.release();
+        int8InputRange = 0.f;
+        if (inputRanges.empty() || !(inputRanges[0] > 0.f) || blobs.empty() ||
+            preferableTarget != DNN_TARGET_CPU)
+            return false;
+
+        int8InputRange = inputRanges[0];
+        std::vector<float> weightsScales;
+        quantizeWeightsInt8(weightsMat, weightsInt8, weightsScales);
+        float inputScale = int8InputRange / 127.f;
+        int8Multipliers.resize(weightsScales.size());
+        for (size_t i = 0; i < weightsScales.size(); i++)
+            int8Multipliers[i] = weightsScales[i] * inputScale;
+        return true;
+    }
+
     class FullyConnected : public ParallelLoopBody
     {
     public:
@@ -294,6 +313,86 @@ public:
         bool useAVX512;
     };
 
+    class FullyConnectedInt8 : public ParallelLoopBody
+    {
+    public:
+        FullyConnectedInt8() : srcMat(0), weights(0), multipliers(0), biasMat(0), activ(0), dstMat(0), inputScale(0.f), nstripes(0) {}
+
+        static void run(const Mat& srcMat, const Mat& weights, const std::vector<float>& multipliers,
+                        const Mat& biasMat, Mat& dstMat, const ActivationLayer* activ,
+                        float inputScale, int nstripes)
+        {
+            CV_Assert( srcMat.dims == 2 && weights.cols >= srcMat.cols &&
+                       weights.cols % VEC_ALIGN_INT8 == 0 &&
+                       dstMat.rows == srcMat.rows && dstMat.cols == weights.rows &&
+                       srcMat.type() == CV_32F && weights.type() == CV_8S && dstMat.type() == CV_32F &&
+                       multipliers.size() == (size_t)weights.rows &&
+                       biasMat.type() == CV_32F && biasMat.isContinuous() && (int)biasMat.total() == dstMat.cols );
+
+            FullyConnectedInt8 p;
+
+            p.srcMat = &srcMat;
+            p.weights = &weights;
+            p.multipliers = &multipliers;
+            p.biasMat = &biasMat;
+            p.dstMat = &dstMat;
+            p.inputScale = inputScale;
+            p.nstripes = nstripes;
+            p.activ = activ;
+
+            parallel_for_(Range(0, nstripes), p, nstripes);
+        }
+
+        void operator()(const Range& r) const CV_OVERRIDE
+        {
+            int nsamples = srcMat->rows;
+            int nw0 = weights->rows;
+            int vecsize = srcMat->cols;
+            int vecsize_aligned = weights->cols;
+            size_t total = (size_t)nsamples*nw0;
+            size_t stripeSize = (total + nstripes - 1)/nstripes;
+            size_t stripeStart = r.start*stripeSize;
+            size_t stripeEnd = r.end == nstripes ? total : std::min(r.end*stripeSize, total);
+            size_t wstep = weights->step1();
+            AutoBuffer<schar> srcbuf(vecsize_aligned);
+            schar* sptr = srcbuf.data();
+            int lastSampleIdx = -1;
+
+            memset(sptr + vecsize, 0, vecsize_aligned - vecsize);
+
+            for( size_t ofs = stripeStart; ofs < stripeEnd; )
+            {
+                int sampleIdx = (int)(ofs / nw0);
+                int delta = (int)(ofs - (size_t)sampleIdx*nw0);
+                const schar* wptr = weights->ptr<schar>(delta);
+                float* dptr = dstMat->ptr<float>(sampleIdx) + delta;
+                const float* biasptr = biasMat->ptr<float>() + delta;
+                int nw = std::min(nw0 - delta, (int)(stripeEnd - ofs));
+
+                if( sampleIdx != lastSampleIdx )
+                {
+                    quantizeToInt8(srcMat->ptr<float>(sampleIdx), sptr, vecsize, inputScale);
+                    lastSampleIdx = sampleIdx;
+                }
+
+                fastGEMM1TInt8(sptr, wptr, wstep, &multipliers->at(delta), biasptr, dptr, nw, vecsize_aligned);
+
+                if(activ)
+                    activ->forwardSlice(dptr, dptr, 1, 1, delta, delta + nw);
+
+                ofs += nw;
+            }
+        }
+
+        const Mat *srcMat, *weights;
+        const std::vector<float>* multipliers;
+        const Mat* biasMat;
+        const ActivationLayer* activ;
+        Mat* dstMat;
+        float inputScale;
+        int nstripes;
+    };
+
 #ifdef HAVE_OPENCL
     virtual void finalize(InputArrayOfArrays, OutputArrayOfArrays) CV_OVERRIDE
     {
@@ -486,7 +585,11 @@ public:
                 Mat dstMat = output[i].reshape(1, outerSize);
 
                 const int nstripes = getNumThreads();
-                FullyConnected::run(srcMat, weightsMat, biasMat, dstMat, activ.get(), nstripes);
+                if (!weightsInt8.empty())
+                    FullyConnectedInt8::run(srcMat, weightsInt8, int8Multipliers, biasMat, dstMat,
+                                            activ.get(), 127.f / int8InputRange, nstripes);
+                else
+                    FullyConnected::run(srcMat, weightsMat, biasMat, dstMat, activ.get(), nstripes);
             }
         }
         else
@@ -625,6 +728,11 @@ public:
     bool bias;
     Mat weightsMat, biasMat;
     Ptr<ActivationLayer> activ;
+
+    // 8-bit quantized inference, see tryQuantize()
+    float int8InputRange;
+    Mat weightsInt8;
+    std::vector<float> int8Multipliers;
 };
 
 Ptr<InnerProductLayer> InnerProductLayer::create(const LayerParams& params)
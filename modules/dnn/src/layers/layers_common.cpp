@@ -250,5 +250,20 @@ void getConvPoolPaddings(const std::vector<int>& inp, const std::vector<size_t>&
     }
 }
 
+void quantizeWeightsInt8(const Mat& weights, Mat& weightsInt8, std::vector<float>& scales)
+{
+    CV_Assert(weights.dims == 2 && weights.type() == CV_32F);
+    int rows = weights.rows, cols = weights.cols;
+    weightsInt8.create(rows, (int)alignSize(cols, VEC_ALIGN_INT8), CV_8S);
+    weightsInt8.setTo(Scalar::all(0));
+    scales.resize(rows);
+    for (int i = 0; i < rows; i++)
+    {
+        double maxval = norm(weights.row(i), NORM_INF);
+        scales[i] = maxval > 0 ? (float)(maxval / 127) : 1.f;
+        weights.row(i).convertTo(weightsInt8.row(i).colRange(0, cols), CV_8S, 1. / scales[i]);
+    }
+}
+
 }
 }
@@ -73,6 +73,23 @@ void getConvPoolOutParams(const std::vector<int>& inp, const std::vector<size_t>
  void getConvPoolPaddings(const std::vector<int>& inp, const std::vector<size_t>& kernel,
                           const std::vector<size_t>& strides, const String &padMode,
                           std::vector<size_t>& pads_begin, std::vector<size_t>& pads_end);
+
+// 8-bit quantized kernels (layers_common_int8.dispatch.cpp), see Layer::tryQuantize().
+// Rows of quantized weights and of the quantized inputs are zero-padded to VEC_ALIGN_INT8 elements.
+enum { VEC_ALIGN_INT8 = 64 };
+
+void quantizeToInt8(const float* src, schar* dst, int len, float scale);
+
+void fastConvInt8(const schar* weights, size_t wstep, const float* multipliers,
+                  const float* bias, const schar* rowbuf, float* output,
+                  size_t outPlaneSize, int outCn, int blockSize, int vecsize_aligned);
+
+void fastGEMM1TInt8(const schar* vec, const schar* weights, size_t wstep,
+                    const float* multipliers, const float* bias,
+                    float* dst, int nvecs, int vecsize_aligned);
+
+// Per-row (i.e. per output channel) symmetric quantization of 2D CV_32F weights
+void quantizeWeightsInt8(const Mat& weights, Mat& weightsInt8, std::vector<float>& scales);
 }
 }
 
@@ -0,0 +1,39 @@
+// This file is part of OpenCV project.
+// It is subject to the license terms in the LICENSE file found in the top-level directory
+// of this distribution and at http://opencv.org/license.html.
+
+#include "../precomp.hpp"
+
+#include "layers_common_int8.simd.hpp"
+#include "layers/layers_common_int8.simd_declarations.hpp" // defines CV_CPU_DISPATCH_MODES_ALL=AVX2,...,BASELINE based on CMakeLists.txt content
+
+namespace cv
+{
+namespace dnn
+{
+
+void quantizeToInt8(const float* src, schar* dst, int len, float scale)
+{
+    CV_CPU_DISPATCH(quantizeToInt8, (src, dst, len, scale),
+        CV_CPU_DISPATCH_MODES_ALL);
+}
+
+void fastConvInt8(const schar* weights, size_t wstep, const float* multipliers,
+                  const float* bias, const schar* rowbuf, float* output,
+                  size_t outPlaneSize, int outCn, int blockSize, int vecsize_aligned)
+{
+    CV_CPU_DISPATCH(fastConvInt8, (weights, wstep, multipliers, bias, rowbuf, output,
+                                   outPlaneSize, outCn, blockSize, vecsize_aligned),
+        CV_CPU_DISPATCH_MODES_ALL);
+}
+
+void fastGEMM1TInt8(const schar* vec, const schar* weights, size_t wstep,
+                    const float* multipliers, const float* bias,
+                    float* dst, int nvecs, int vecsize_aligned)
+{
+    CV_CPU_DISPATCH(fastGEMM1TInt8, (vec, weights, wstep, multipliers, bias, dst, nvecs, vecsize_aligned),
+        CV_CPU_DISPATCH_MODES_ALL);
+}
+
+}
+}
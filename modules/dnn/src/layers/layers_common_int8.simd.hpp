@@ -0,0 +1,145 @@
+// This file is part of OpenCV project.
+// It is subject to the license terms in the LICENSE file found in the top-level directory
+// of this distribution and at http://opencv.org/license.html.
+
+#include "opencv2/core/hal/intrin.hpp"
+
+namespace cv {
+namespace dnn {
+CV_CPU_OPTIMIZATION_NAMESPACE_BEGIN
+
+void quantizeToInt8( const float* src, schar* dst, int len, float scale );
+void fastConvInt8( const schar* weights, size_t wstep, const float* multipliers,
+                   const float* bias, const schar* rowbuf, float* output,
+                   size_t outPlaneSize, int outCn, int blockSize, int vecsize_aligned );
+void fastGEMM1TInt8( const schar* vec, const schar* weights, size_t wstep,
+                     const float* multipliers, const float* bias,
+                     float* dst, int nvecs, int vecsize_aligned );
+
+#ifndef CV_CPU_OPTIMIZATION_DECLARATIONS_ONLY
+
+// Symmetric quantization: dst = saturate(round(src*scale)) clipped to [-127, 127],
+// so that zero point is 0 and padding with zeros stays exact.
+void quantizeToInt8( const float* src, schar* dst, int len, float scale )
+{
+    int i = 0;
+#if CV_SIMD
+    const int VECSZ = v_int8::nlanes;
+    const int FVECSZ = v_float32::nlanes;
+    v_float32 vscale = vx_setall_f32(scale);
+    v_int8 vmin = vx_setall_s8(-127);
+    for( ; i <= len - VECSZ; i += VECSZ )
+    {
+        v_int32 i0 = v_round(vx_load(src + i) * vscale);
+        v_int32 i1 = v_round(vx_load(src + i + FVECSZ) * vscale);
+        v_int32 i2 = v_round(vx_load(src + i + FVECSZ*2) * vscale);
+        v_int32 i3 = v_round(vx_load(src + i + FVECSZ*3) * vscale);
+        v_int8 b = v_pack(v_pack(i0, i1), v_pack(i2, i3));
+        v_store(dst + i, v_max(b, vmin));
+    }
+#endif
+    for( ; i < len; i++ )
+        dst[i] = std::max(saturate_cast<schar>(src[i]*scale), (schar)-127);
+}
+
+// output[i*outPlaneSize + j] = bias[i] + multipliers[i]*dot(weights[i], rowbuf[j]),
+// where both the weights rows and the im2row rows are zero-padded to vecsize_aligned,
+// which is a multiple of the widest vector register.
+void fastConvInt8( const schar* weights, size_t wstep, const float* multipliers,
+                   const float* bias, const schar* rowbuf, float* output,
+                   size_t outPlaneSize, int outCn, int blockSize, int vecsize_aligned )
+{
+    for( int i = 0; i < outCn; i++ )
+    {
+        const schar* wptr = weights + i*wstep;
+        float* outptr = output + i*outPlaneSize;
+        float b = bias[i], m = multipliers[i];
+        int j = 0;
+
+    #if CV_SIMD
+        for( ; j <= blockSize - 4; j += 4 )
+        {
+            const schar* rptr = rowbuf + j*vecsize_aligned;
+            v_int32 s0 = vx_setzero_s32(), s1 = vx_setzero_s32(),
+                    s2 = vx_setzero_s32(), s3 = vx_setzero_s32();
+            for( int k = 0; k < vecsize_aligned; k += v_int8::nlanes, rptr += v_int8::nlanes )
+            {
+                v_int8 w = vx_load(wptr + k);
+                s0 = v_dotprod_expand_fast(w, vx_load(rptr), s0);
+                s1 = v_dotprod_expand_fast(w, vx_load(rptr + vecsize_aligned), s1);
+                s2 = v_dotprod_expand_fast(w, vx_load(rptr + vecsize_aligned*2), s2);
+                s3 = v_dotprod_expand_fast(w, vx_load(rptr + vecsize_aligned*3), s3);
+            }
+            outptr[j] = b + m*v_reduce_sum(s0);
+            outptr[j+1] = b + m*v_reduce_sum(s1);
+            outptr[j+2] = b + m*v_reduce_sum(s2);
+            outptr[j+3] = b + m*v_reduce_sum(s3);
+        }
+    #endif
+
+        for( ; j < blockSize; j++ )
+        {
+            const schar* rptr = rowbuf + j*vecsize_aligned;
+            int k = 0, s = 0;
+        #if CV_SIMD
+            v_int32 vs = vx_setzero_s32();
+            for( ; k < vecsize_aligned; k += v_int8::nlanes )
+                vs = v_dotprod_expand_fast(vx_load(wptr + k), vx_load(rptr + k), vs);
+            s = v_reduce_sum(vs);
+        #endif
+            for( ; k < vecsize_aligned; k++ )
+                s += (int)wptr[k]*rptr[k];
+            outptr[j] = b + m*s;
+        }
+    }
+    vx_cleanup();
+}
+
+void fastGEMM1TInt8( const schar* vec, const schar* weights, size_t wstep,
+                     const float* multipliers, const float* bias,
+                     float* dst, int nvecs, int vecsize_aligned )
+{
+    int i = 0;
+
+#if CV_SIMD
+    for( ; i <= nvecs - 4; i += 4 )
+    {
+        const schar* wptr = weights + i*wstep;
+        v_int32 s0 = vx_setzero_s32(), s1 = vx_setzero_s32(),
+                s2 = vx_setzero_s32(), s3 = vx_setzero_s32();
+        for( int k = 0; k < vecsize_aligned; k += v_int8::nlanes )
+        {
+            v_int8 v = vx_load(vec + k);
+            s0 = v_dotprod_expand_fast(v, vx_load(wptr + k), s0);
+            s1 = v_dotprod_expand_fast(v, vx_load(wptr + wstep + k), s1);
+            s2 = v_dotprod_expand_fast(v, vx_load(wptr + wstep*2 + k), s2);
+            s3 = v_dotprod_expand_fast(v, vx_load(wptr + wstep*3 + k), s3);
+        }
+        dst[i] = bias[i] + multipliers[i]*v_reduce_sum(s0);
+        dst[i+1] = bias[i+1] + multipliers[i+1]*v_reduce_sum(s1);
+        dst[i+2] = bias[i+2] + multipliers[i+2]*v_reduce_sum(s2);
+        dst[i+3] = bias[i+3] + multipliers[i+3]*v_reduce_sum(s3);
+    }
+#endif
+
+    for( ; i < nvecs; i++ )
+    {
+        const schar* wptr = weights + i*wstep;
+        int k = 0, s = 0;
+    #if CV_SIMD
+        v_int32 vs = vx_setzero_s32();
+        for( ; k < vecsize_aligned; k += v_int8::nlanes )
+            vs = v_dotprod_expand_fast(vx_load(vec + k), vx_load(wptr + k), vs);
+        s = v_reduce_sum(vs);
+    #endif
+        for( ; k < vecsize_aligned; k++ )
+            s += (int)vec[k]*wptr[k];
+        dst[i] = bias[i] + multipliers[i]*s;
+    }
+    vx_cleanup();
+}
+
+#endif // CV_CPU_OPTIMIZATION_DECLARATIONS_ONLY
+
+CV_CPU_OPTIMIZATION_NAMESPACE_END
+}} // namespace
@@ -8,6 +8,16 @@
 #include <iterator>
 
 #include <opencv2/imgproc.hpp>
+#include <opencv2/dnn/shape_utils.hpp>
+
+#ifdef CV_CXX11
+#include <chrono>
+#include <condition_variable>
+#include <deque>
+#include <mutex>
+#include <thread>
+#include <opencv2/core/detail/async_promise.hpp>
+#endif
 
 namespace cv {
 namespace dnn {
@@ -22,11 +32,41 @@ struct Model::Impl
     double  scale = 1.0;
     bool   swapRB = false;
     bool   crop = false;
-    Mat    blob;
     std::vector<String> outNames;
 
+#ifdef CV_CXX11
+    // Queue of asynchronous requests, see Model::predictAsync()
+    struct Request
+    {
+        Mat blob;
+        std::vector<AsyncPromise> outs;
+        std::chrono::steady_clock::time_point arrival;
+    };
+    std::mutex netMutex;  // the network is used by both predict() and the batching thread
+    std::mutex queueMutex;
+    std::condition_variable queueCond;
+    std::deque<Request> queue;
+    std::thread worker;
+    bool stopWorker = false;
+    int maxBatchSize = 1;
+    double maxLatency = 10;  // ms
+#endif
+
 public:
-    virtual ~Impl() {}
+    virtual ~Impl()
+    {
+#ifdef CV_CXX11
+        if (worker.joinable())
+        {
+            {
+                std::lock_guard<std::mutex> lock(queueMutex);
+                stopWorker = true;
+            }
+            queueCond.notify_all();
+            worker.join();  // pending requests are processed before the exit
+        }
+#endif
+    }
     Impl() {}
     Impl(const Impl&) = delete;
     Impl(Impl&&) = delete;
@@ -95,8 +135,22 @@ public:
         if (size.empty())
             CV_Error(Error::StsBadSize, "Input size not specified");
 
-        blob = blobFromImage(frame, scale, size, mean, swapRB, crop);
-        net.setInput(blob);
+        Mat blob = blobFromImage(frame, scale, size, mean, swapRB, crop);
+        std::vector<Mat>& outputs = *(std::vector<Mat>*)outs.getObj();  // see Net::forward()
+#ifdef CV_CXX11
+        std::lock_guard<std::mutex> lock(netMutex);
+#endif
+        forwardBlob(blob, outputs);
+#ifdef CV_CXX11
+        // the outputs reference the blobs of the network, which are overwritten by the batching thread
+        for (size_t i = 0; i < outputs.size(); i++)
+            outputs[i] = outputs[i].clone();
+#endif
+    }
+
+    void forwardBlob(const Mat& inp, std::vector<Mat>& outs)
+    {
+        net.setInput(inp);
 
         // Faster-RCNN or R-FCN
         if (net.getLayer(0)->outputNameToIndex("im_info") != -1)
@@ -107,6 +161,141 @@ public:
 
         net.forward(outs, outNames);
     }
+
+#ifdef CV_CXX11
+    void setBatching(int maxBatchSize_, double maxLatency_)
+    {
+        CV_CheckGE(maxLatency_, 0.0, "");
+        {
+            std::lock_guard<std::mutex> lock(queueMutex);
+            maxBatchSize = std::max(maxBatchSize_, 1);
+            maxLatency = maxLatency_;
+        }
+        queueCond.notify_all();
+    }
+
+    void processFrameAsync(InputArray frame, std::vector<AsyncArray>& outs)
+    {
+        CV_TRACE_FUNCTION();
+        if (size.empty())
+            CV_Error(Error::StsBadSize, "Input size not specified");
+
+        Request req;
+        req.blob = blobFromImage(frame, scale, size, mean, swapRB, crop);
+        req.outs.resize(outNames.size());
+        outs.resize(outNames.size());
+        for (size_t i = 0; i < outNames.size(); i++)
+            outs[i] = req.outs[i].getArrayResult();
+        req.arrival = std::chrono::steady_clock::now();
+        {
+            std::lock_guard<std::mutex> lock(queueMutex);
+            if (!worker.joinable())
+                worker = std::thread(&Impl::batchingLoop, this);
+            queue.push_back(std::move(req));
+        }
+        queueCond.notify_all();
+    }
+
+    void batchingLoop()
+    {
+        std::unique_lock<std::mutex> lock(queueMutex);
+        for (;;)
+        {
+            queueCond.wait(lock, [&]() { return stopWorker || !queue.empty(); });
+            if (queue.empty())
+                break;
+
+            // wait for more requests until the batch is full or the oldest request is out of time
+            std::chrono::steady_clock::time_point deadline = queue.front().arrival +
+                std::chrono::duration_cast<std::chrono::steady_clock::duration>(
+                    std::chrono::duration<double, std::milli>(maxLatency));
+            while (!stopWorker && (int)queue.size() < maxBatchSize)
+            {
+                if (queueCond.wait_until(lock, deadline) == std::cv_status::timeout)
+                    break;
+            }
+
+            // frames of a batch must have the same shape (input parameters may change in between)
+            std::vector<Request> batch;
+            MatShape batchShape = shape(queue.front().blob);
+            while (!queue.empty() && (int)batch.size() < maxBatchSize &&
+                   shape(queue.front().blob) == batchShape)
+            {
+                batch.push_back(std::move(queue.front()));
+                queue.pop_front();
+            }
+
+            lock.unlock();
+            processBatch(batch);
+            lock.lock();
+        }
+    }
+
+    void processBatch(std::vector<Request>& batch)
+    {
+        CV_TRACE_FUNCTION();
+        const int n = (int)batch.size();
+        std::vector<std::vector<Mat> > results(n);
+        try
+        {
+            Mat inp;
+            if (n == 1)
+                inp = batch[0].blob;
+            else
+            {
+                MatShape inpShape = shape(batch[0].blob);
+                inpShape[0] = n;
+                inp.create(inpShape, CV_32F);
+                for (int i = 0; i < n; i++)
+                {
+                    const Mat& b = batch[i].blob;
+                    b.reshape(1, 1).copyTo(Mat(1, (int)b.total(), CV_32F, inp.ptr<float>(i)));
+                }
+            }
+
+            std::lock_guard<std::mutex> lock(netMutex);
+            std::vector<Mat> outs;
+            forwardBlob(inp, outs);
+
+            for (size_t k = 0; k < outs.size(); k++)
+            {
+                const Mat& out = outs[k];
+                if (n == 1)
+                {
+                    results[0].push_back(out.clone());
+                    continue;
+                }
+                if (out.dims < 2 || out.size[0] != n)
+                    CV_Error(Error::StsNotImplemented, format("Output \"%s\" of shape %s can't be split into "
+                             "%d batch samples", outNames[k].c_str(), toString(shape(out)).c_str(), n));
+                std::vector<Range> ranges(out.dims, Range::all());
+                for (int i = 0; i < n; i++)
+                {
+                    ranges[0] = Range(i, i + 1);
+                    results[i].push_back(out(&ranges[0]).clone());
+                }
+            }
+        }
+        catch (const cv::Exception& e)
+        {
+            for (int i = 0; i < n; i++)
+                for (size_t k = 0; k < batch[i].outs.size(); k++)
+                    batch[i].outs[k].setException(e);
+            return;
+        }
+        catch (...)
+        {
+            for (int i = 0; i < n; i++)
+                for (size_t k = 0; k < batch[i].outs.size(); k++)
+                    batch[i].outs[k].setException(std::current_exception());
+            return;
+        }
+
+        for (int i = 0; i < n; i++)
+            for (size_t k = 0; k < batch[i].outs.size(); k++)
+                batch[i].outs[k].setValue(results[i][k]);
+    }
+#endif  // CV_CXX11
 };
 
 Model::Model()
@@ -194,6 +383,29 @@ void Model::predict(InputArray frame, OutputArrayOfArrays outs) const
     impl->processFrame(frame, outs);
 }
 
+Model& Model::setBatching(int maxBatchSize, double maxLatency)
+{
+    CV_DbgAssert(impl);
+#ifdef CV_CXX11
+    impl->setBatching(maxBatchSize, maxLatency);
+#else
+    CV_UNUSED(maxBatchSize); CV_UNUSED(maxLatency);
+    CV_Error(Error::StsNotImplemented, "DNN: Asynchronous prediction requires build with enabled C++11");
+#endif
+    return *this;
+}
+
+void Model::predictAsync(InputArray frame, std::vector<AsyncArray>& outs) const
+{
+    CV_DbgAssert(impl);
+#ifdef CV_CXX11
+    impl->processFrameAsync(frame, outs);
+#else
+    CV_UNUSED(frame); CV_UNUSED(outs);
+    CV_Error(Error::StsNotImplemented, "DNN: Asynchronous prediction requires build with enabled C++11");
+#endif
+}
+
 
 ClassificationModel::ClassificationModel(const String& model, const String& config)
     : Model(model, config)
@@ -403,15 +615,21 @@ void DetectionModel::detect(InputArray frame, CV_OUT std::vector<int>& classIds,
 
     int frameWidth  = frame.cols();
     int frameHeight = frame.rows();
-    if (getNetwork_().getLayer(0)->outputNameToIndex("im_info") != -1)
+    Ptr<Layer> lastLayer;
     {
-        frameWidth = impl->size.width;
-        frameHeight = impl->size.height;
-    }
+#ifdef CV_CXX11
+        std::lock_guard<std::mutex> lock(impl->netMutex);  // see Model::predictAsync()
+#endif
+        if (getNetwork_().getLayer(0)->outputNameToIndex("im_info") != -1)
+        {
+            frameWidth = impl->size.width;
+            frameHeight = impl->size.height;
+        }
 
-    std::vector<String> layerNames = getNetwork_().getLayerNames();
-    int lastLayerId = getNetwork_().getLayerId(layerNames.back());
-    Ptr<Layer> lastLayer = getNetwork_().getLayer(lastLayerId);
+        std::vector<String> layerNames = getNetwork_().getLayerNames();
+        int lastLayerId = getNetwork_().getLayerId(layerNames.back());
+        lastLayer = getNetwork_().getLayer(lastLayerId);
+    }
 
     if (lastLayer->type == "DetectionOutput")
     {
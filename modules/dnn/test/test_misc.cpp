@@ -39,6 +39,64 @@ TEST(blobFromImage, allocated)
     ASSERT_EQ(blobData, blob.data);
 }
 
+TEST(blobFromImages, fused_preprocessing)
+{
+    RNG& rng = theRNG();
+    const int cns[] = { 1, 3, 4 };
+    for (int iter = 0; iter < 24; iter++)
+    {
+        int cn = cns[iter % 3], depth = iter % 2 ? CV_32F : CV_8U;
+        bool swapRB = (iter / 2) % 2 != 0, crop = (iter / 4) % 2 != 0;
+        Size size(rng.uniform(16, 80), rng.uniform(16, 80));
+        Scalar mean(10, 20, 30, 40);
+        double scale = 0.5;
+        SCOPED_TRACE(cv::format("cn=%d depth=%d swapRB=%d crop=%d", cn, depth, swapRB, crop));
+
+        std::vector<Mat> images(2);
+        for (size_t i = 0; i < images.size(); i++)
+        {
+            images[i].create(rng.uniform(16, 100), rng.uniform(16, 100), CV_MAKETYPE(depth, cn));
+            cvtest::randUni(rng, images[i], Scalar::all(0), Scalar::all(255));
+        }
+        std::vector<Mat> inputs;
+        for (size_t i = 0; i < images.size(); i++)
+            inputs.push_back(images[i].clone());
+
+        Mat blob = dnn::blobFromImages(images, scale, size, mean, swapRB, crop);
+        ASSERT_EQ(4, blob.dims);
+
+        for (size_t i = 0; i < images.size(); i++)
+        {
+            // the source images stay untouched
+            EXPECT_EQ(0, cvtest::norm(inputs[i], images[i], NORM_INF));
+
+            Mat resized;
+            if (crop)
+            {
+                float factor = std::max(size.width / (float)images[i].cols, size.height / (float)images[i].rows);
+                cv::resize(images[i], resized, Size(), factor, factor, INTER_LINEAR);
+                resized = resized(Rect(Point(0.5 * (resized.cols - size.width), 0.5 * (resized.rows - size.height)), size));
+            }
+            else
+                cv::resize(images[i], resized, size, 0, 0, INTER_LINEAR);
+
+            std::vector<Mat> channels;
+            cv::split(resized, channels);
+            for (int c = 0; c < cn; c++)
+            {
+                // the mean values are swapped even for the single channel images, the planes are not
+                int m = swapRB && c != 1 && c != 3 ? 2 - c : c;
+                int p = cn >= 3 ? m : c;
+                Mat expected;
+                channels[c].convertTo(expected, CV_32F);
+                expected = (expected - mean[m]) * scale;
+                Mat plane(size, CV_32F, blob.ptr((int)i, p));
+                EXPECT_LE(cvtest::norm(expected, plane, NORM_INF), 1e-4) << "image " << i << " channel " << c;
+            }
+        }
+    }
+}
+
 TEST(imagesFromBlob, Regression)
 {
     int nbOfImages = 8;
@@ -832,4 +890,207 @@ INSTANTIATE_TEST_CASE_P(/**/, Test_Model_Optimizer,
 
 #endif  // HAVE_INF_ENGINE
 
+static Net createQuantizationTestNet(int ngroups)
+{
+    Net net;
+    RNG& rng = theRNG();
+    {
+        LayerParams lp;
+        lp.type = "Convolution";
+        lp.name = "conv";
+        lp.set("kernel_size", 3);
+        lp.set("pad", 1);
+        lp.set("num_output", 32);
+        lp.set("group", ngroups);
+        lp.set("bias_term", true);
+        int wshape[] = {32, 16 / ngroups, 3, 3};
+        Mat weights(4, wshape, CV_32F), bias(1, 32, CV_32F);
+        rng.fill(weights, RNG::UNIFORM, -1, 1);
+        rng.fill(bias, RNG::UNIFORM, -1, 1);
+        lp.blobs.push_back(weights);
+        lp.blobs.push_back(bias);
+        net.addLayerToPrev(lp.name, lp.type, lp);
+    }
+    {
+        LayerParams lp;
+        lp.type = "ReLU";
+        lp.name = "relu";
+        net.addLayerToPrev(lp.name, lp.type, lp);
+    }
+    {
+        LayerParams lp;
+        lp.type = "Pooling";
+        lp.name = "pool";
+        lp.set("pool", "max");
+        lp.set("kernel_size", 2);
+        lp.set("stride", 2);
+        net.addLayerToPrev(lp.name, lp.type, lp);
+    }
+    {
+        LayerParams lp;
+        lp.type = "InnerProduct";
+        lp.name = "fc";
+        lp.set("num_output", 10);
+        lp.set("bias_term", true);
+        Mat weights(10, 32 * 8 * 8, CV_32F), bias(1, 10, CV_32F);
+        rng.fill(weights, RNG::UNIFORM, -1, 1);
+        rng.fill(bias, RNG::UNIFORM, -1, 1);
+        lp.blobs.push_back(weights);
+        lp.blobs.push_back(bias);
+        net.addLayerToPrev(lp.name, lp.type, lp);
+    }
+    net.setPreferableBackend(DNN_BACKEND_OPENCV);
+    net.setPreferableTarget(DNN_TARGET_CPU);
+    return net;
+}
+
+typedef testing::TestWithParam<int> Test_Int8_Quantize;
+TEST_P(Test_Int8_Quantize, accuracy)
+{
+    const int ngroups = GetParam();
+    Net net = createQuantizationTestNet(ngroups);
+
+    int inpShape[] = {2, 16, 16, 16};
+    std::vector<Mat> calibData(4);
+    for (size_t i = 0; i < calibData.size(); i++)
+    {
+        calibData[i].create(4, inpShape, CV_32F);
+        randu(calibData[i], 0, 1);
+    }
+    Mat input(4, inpShape, CV_32F);
+    randu(input, 0, 1);
+
+    net.setInput(input);
+    Mat ref = net.forward().clone();
+
+    net.quantize(calibData);
+    net.setInput(input);
+    Mat out = net.forward().clone();
+
+    ASSERT_EQ(ref.size, out.size);
+    double refMax = cvtest::norm(ref, NORM_INF);
+    EXPECT_LE(cvtest::norm(ref, out, NORM_INF), 0.02 * refMax);
+    EXPECT_GT(cvtest::norm(ref, out, NORM_INF), 0);  // int8 path is actually taken
+
+    // recalibration starts from floating point computations
+    net.quantize(calibData);
+    net.setInput(input);
+    normAssert(out, net.forward(), "recalibration", 0, 0);
+}
+
+INSTANTIATE_TEST_CASE_P(/**/, Test_Int8_Quantize, Values(1, 4));
+
+TEST(Net, peak_blobs_memory)
+{
+    RNG& rng = theRNG();
+    Net net;
+    int prevId = 0;
+    for (int i = 0; i < 6; i++)
+    {
+        LayerParams lp;
+        lp.type = "Convolution";
+        lp.name = format("conv%d", i);
+        lp.set("kernel_size", 3);
+        lp.set("pad", 1);
+        lp.set("num_output", 8);
+        lp.set("bias_term", false);
+        int wshape[] = {8, i == 0 ? 3 : 8, 3, 3};
+        Mat weights(4, wshape, CV_32F);
+        rng.fill(weights, RNG::UNIFORM, -0.5, 0.5);
+        lp.blobs.push_back(weights);
+        int id = net.addLayer(lp.name, lp.type, lp);
+        net.connect(prevId, 0, id, 0);
+
+        // residual connections make some of the blobs live longer
+        if (i % 2 == 1)
+        {
+            LayerParams lpSum;
+            lpSum.type = "Eltwise";
+            lpSum.name = format("sum%d", i);
+            int sumId = net.addLayer(lpSum.name, lpSum.type, lpSum);
+            net.connect(prevId, 0, sumId, 0);
+            net.connect(id, 0, sumId, 1);
+            id = sumId;
+        }
+        prevId = id;
+    }
+    net.setPreferableBackend(DNN_BACKEND_OPENCV);
+    net.setPreferableTarget(DNN_TARGET_CPU);
+
+    Mat input({1, 3, 32, 32}, CV_32F);
+    randu(input, -1, 1);
+    net.setInput(input);
+    Mat ref = net.forward().clone();
+    size_t peakMemory = net.getPeakBlobsMemory();
+    EXPECT_GE(peakMemory, 2 * 8 * 32 * 32 * sizeof(float));
+
+    // intermediate results might be overwritten if they are not requested explicitly
+    std::vector<String> names = net.getLayerNames();
+    std::vector<Mat> outs;
+    net.forward(outs, names);
+    EXPECT_LT(peakMemory, net.getPeakBlobsMemory());
+    normAssert(ref, outs.back());
+
+    net.setInput(input);
+    normAssert(ref, net.forward(), "reallocation");
+    EXPECT_EQ(peakMemory, net.getPeakBlobsMemory());
+}
+
+typedef testing::TestWithParam<tuple<Size, int, std::string> > Test_Winograd;
+TEST_P(Test_Winograd, accuracy)
+{
+    const Size inpSize = get<0>(GetParam());
+    const int pad = get<1>(GetParam());
+    const std::string activType = get<2>(GetParam());
+    const int inpCn = 24, outCn = 37;
+    RNG& rng = theRNG();
+
+    Net net;
+    {
+        LayerParams lp;
+        lp.type = "Convolution";
+        lp.name = "conv";
+        lp.set("kernel_size", 3);
+        lp.set("pad", pad);
+        lp.set("num_output", outCn);
+        lp.set("bias_term", true);
+        int wshape[] = {outCn, inpCn, 3, 3};
+        Mat weights(4, wshape, CV_32F), bias(1, outCn, CV_32F);
+        rng.fill(weights, RNG::UNIFORM, -1, 1);
+        rng.fill(bias, RNG::UNIFORM, -1, 1);
+        lp.blobs.push_back(weights);
+        lp.blobs.push_back(bias);
+        net.addLayerToPrev(lp.name, lp.type, lp);
+    }
+    if (!activType.empty())
+    {
+        LayerParams lp;
+        lp.type = activType;
+        lp.name = "activ";
+        net.addLayerToPrev(lp.name, lp.type, lp);
+    }
+    net.setPreferableBackend(DNN_BACKEND_OPENCV);
+    net.setPreferableTarget(DNN_TARGET_CPU);
+
+    int inpShape[] = {2, inpCn, inpSize.height, inpSize.width};
+    Mat input(4, inpShape, CV_32F);
+    randu(input, -1, 1);
+
+    net.enableWinograd(false);
+    net.setInput(input);
+    Mat ref = net.forward().clone();
+
+    net.enableWinograd(true);
+    net.setInput(input);
+    Mat out = net.forward();
+
+    normAssert(ref, out, "", 1e-4, 1e-3);
+}
+
+INSTANTIATE_TEST_CASE_P(/**/, Test_Winograd, Combine(
+    Values(Size(8, 8), Size(17, 13), Size(32, 30)),
+    Values(0, 1),
+    Values("", "ReLU", "ReLU6")
+));
+
 }} // namespace
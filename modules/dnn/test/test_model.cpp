@@ -679,4 +679,102 @@ TEST_P(Test_Model, TextDetectionByEAST)
 
 INSTANTIATE_TEST_CASE_P(/**/, Test_Model, dnnBackendsAndTargets());
 
+static Net makeConvReLUNet()
+{
+    Net net;
+    {
+        LayerParams lp;
+        lp.type = "Convolution";
+        lp.name = "conv";
+        lp.set("kernel_size", 3);
+        lp.set("num_output", 4);
+        lp.set("bias_term", false);
+        int wshape[] = {4, 3, 3, 3};
+        Mat weights(4, wshape, CV_32F);
+        randu(weights, -1, 1);
+        lp.blobs.push_back(weights);
+        net.addLayerToPrev(lp.name, lp.type, lp);
+    }
+    {
+        LayerParams lp;
+        lp.type = "ReLU";
+        lp.name = "relu";
+        net.addLayerToPrev(lp.name, lp.type, lp);
+    }
+    return net;
+}
+
+TEST(Model, predictAsync_batching)
+{
+    Model model(makeConvReLUNet());
+    model.setInputParams(1.0 / 255, Size(16, 12));
+    model.setPreferableBackend(DNN_BACKEND_OPENCV);
+
+    std::vector<Mat> frames(5);
+    std::vector<Mat> refs(frames.size());
+    for (size_t i = 0; i < frames.size(); i++)
+    {
+        frames[i].create(24, 32, CV_8UC3);
+        randu(frames[i], 0, 255);
+        std::vector<Mat> outs;
+        model.predict(frames[i], outs);
+        ASSERT_EQ(1u, outs.size());
+        refs[i] = outs[0].clone();
+    }
+
+    // the first 4 frames are processed by a single forward pass, the last one is alone
+    model.setBatching(4, 200);
+    std::vector<std::vector<AsyncArray> > futures(frames.size());
+    for (size_t i = 0; i < frames.size(); i++)
+        model.predictAsync(frames[i], futures[i]);
+
+    for (size_t i = 0; i < frames.size(); i++)
+    {
+        ASSERT_EQ(1u, futures[i].size());
+        Mat out;
+        futures[i][0].get(out);
+        normAssert(refs[i], out, format("frame %d", (int)i).c_str());
+    }
+}
+
+TEST(Model, predict_with_predictAsync)
+{
+    Model model(makeConvReLUNet());
+    model.setInputParams(1.0 / 255, Size(16, 12));
+    model.setPreferableBackend(DNN_BACKEND_OPENCV);
+
+    const int n = 8;
+    std::vector<Mat> frames(n);
+    std::vector<Mat> refs(n);
+    for (int i = 0; i < n; i++)
+    {
+        frames[i].create(24, 32, CV_8UC3);
+        randu(frames[i], 0, 255);
+        std::vector<Mat> outs;
+        model.predict(frames[i], outs);
+        ASSERT_EQ(1u, outs.size());
+        refs[i] = outs[0].clone();
+    }
+
+    // the batches have the same shape as the input of predict(), so the network reuses its blobs
+    model.setBatching(1, 0);
+    std::vector<std::vector<AsyncArray> > futures(n);
+    std::vector<std::vector<Mat> > outs(n);
+    for (int i = 0; i < n; i++)
+    {
+        model.predictAsync(frames[i], futures[i]);
+        model.predict(frames[(i + 1) % n], outs[i]);
+    }
+
+    for (int i = 0; i < n; i++)
+    {
+        ASSERT_EQ(1u, futures[i].size());
+        Mat out;
+        futures[i][0].get(out);
+        normAssert(refs[i], out, format("async frame %d", i).c_str());
+        ASSERT_EQ(1u, outs[i].size());
+        normAssert(refs[(i + 1) % n], outs[i][0], format("frame %d", (i + 1) % n).c_str());
+    }
+}
+
 }} // namespace
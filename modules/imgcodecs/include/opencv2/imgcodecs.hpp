@@ -191,6 +191,25 @@ Currently, the following file formats are supported:
 */
 CV_EXPORTS_W Mat imread( const String& filename, int flags = IMREAD_COLOR );
 
+/** @overload
+@brief Loads an image from a file into the given destination.
+
+The file is memory-mapped and decoded straight from the mapping without copying it into an
+intermediate buffer. The image is decoded into dst: the existing buffer is reused
+when it already has the required size and type, so no allocation happens when images of the
+same size are read one after another (e.g. into slots of a preallocated batch). A Mat header
+over a user buffer can be passed as well, in this case the decoded image must fit it exactly.
+
+With IMREAD_REDUCED_* modes JPEG images are downscaled during decoding (in the DCT domain),
+which is much faster than decoding the full image.
+
+@param filename Name of file to be loaded.
+@param dst Destination image.
+@param flags Flag that can take values of cv::ImreadModes
+@returns true if the image has been decoded
+*/
+CV_EXPORTS bool imread( const String& filename, OutputArray dst, int flags = IMREAD_COLOR );
+
 /** @brief Loads a multi-page image from a file.
 
 The function imreadmulti loads a multi-page image from the specified file into a vector of Mat objects.
@@ -201,6 +220,24 @@ The function imreadmulti loads a multi-page image from the specified file into a
 */
 CV_EXPORTS_W bool imreadmulti(const String& filename, CV_OUT std::vector<Mat>& mats, int flags = IMREAD_ANYCOLOR);
 
+/** @brief Loads a batch of images from files.
+
+The images are decoded in parallel (see cv::parallel_for_), decoder instances are reused by
+worker threads for the files of the same format. The files are memory-mapped and decoded
+into the elements of mats, which are reused if they already have the required size and type.
+The elements are empty for files which can't be read.
+
+@param filenames Names of files to be loaded.
+@param mats Decoded images, one per file.
+@param status Optional output vector (CV_8U), an element is set to 1 if the image has been
+decoded, otherwise it is set to 0.
+@param flags Flag that can take values of cv::ImreadModes
+@returns true if all images have been decoded
+@sa cv::imread
+*/
+CV_EXPORTS_W bool imreadBatch(const std::vector<String>& filenames, CV_OUT std::vector<Mat>& mats,
+                              OutputArray status = noArray(), int flags = IMREAD_COLOR);
+
 /** @brief Saves an image to a specified file.
 
 The function imwrite saves the image to the specified file. The image format is chosen based on the
@@ -260,6 +297,20 @@ reallocations when the function is called repeatedly for images of the same size
 */
 CV_EXPORTS Mat imdecode( InputArray buf, int flags, Mat* dst);
 
+/** @brief Reads a batch of images from buffers in memory.
+
+The same as cv::imreadBatch, but the images are decoded from the memory buffers.
+
+@param bufs Vector of input arrays or vectors of bytes.
+@param mats Decoded images, one per buffer.
+@param status Optional output vector (CV_8U), an element is set to 1 if the image has been
+decoded, otherwise it is set to 0.
+@param flags The same flags as in cv::imread, see cv::ImreadModes.
+@returns true if all images have been decoded
+*/
+CV_EXPORTS_W bool imdecodeBatch(InputArrayOfArrays bufs, CV_OUT std::vector<Mat>& mats,
+                                OutputArray status = noArray(), int flags = IMREAD_COLOR);
+
 /** @brief Encodes an image into a memory buffer.
 
 The function imencode compresses the image and stores it in the memory buffer that is resized to fit the
@@ -52,6 +52,7 @@ BaseImageDecoder::BaseImageDecoder()
     m_width = m_height = 0;
     m_type = -1;
     m_buf_supported = false;
+    m_reusable = false;
     m_scale_denom = 1;
 }
 
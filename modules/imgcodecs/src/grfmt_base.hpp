@@ -74,6 +74,9 @@ public:
     /// Called after readData to advance to the next page, if any.
     virtual bool nextPage() { return false; }
 
+    /// True if the instance can decode several images one after another (readHeader() resets its state).
+    bool isReusable() const { return m_reusable; }
+
     virtual size_t signatureLength() const;
     virtual bool checkSignature( const String& signature ) const;
     virtual ImageDecoder newDecoder() const;
@@ -87,6 +90,7 @@ protected:
     String m_signature;
     Mat m_buf;
     bool m_buf_supported;
+    bool m_reusable;
 };
 
 
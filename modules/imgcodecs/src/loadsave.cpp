@@ -54,6 +54,17 @@
 #include <cerrno>
 #include <opencv2/core/utils/logger.hpp>
 #include <opencv2/core/utils/configuration.private.hpp>
+#include <opencv2/core/utils/tls.hpp>
+
+#if defined _WIN32
+#include <windows.h>
+#elif defined __unix__ || defined __APPLE__
+#include <fcntl.h>
+#include <sys/mman.h>
+#include <sys/stat.h>
+#include <unistd.h>
+#define HAVE_MMAP_ 1
+#endif
 
 
 /****************************************************************************************\
@@ -282,6 +293,52 @@ static ImageDecoder findDecoder( const Mat& buf )
     return ImageDecoder();
 }
 
+/**
+ * Decoders of a worker thread, reused for the images of the same format (see BaseImageDecoder::isReusable())
+ */
+struct DecoderCache
+{
+    std::vector<ImageDecoder> decoders;  // indexed as ImageCodecInitializer::decoders
+};
+
+static ImageDecoder findDecoder( const Mat& buf, DecoderCache& cache )
+{
+    size_t i, maxlen = 0;
+
+    if( buf.rows*buf.cols < 1 || !buf.isContinuous() )
+        return ImageDecoder();
+
+    ImageCodecInitializer& codecs = getCodecs();
+    for( i = 0; i < codecs.decoders.size(); i++ )
+    {
+        size_t len = codecs.decoders[i]->signatureLength();
+        maxlen = std::max(maxlen, len);
+    }
+
+    String signature(maxlen, ' ');
+    size_t bufSize = buf.rows*buf.cols*buf.elemSize();
+    maxlen = std::min(maxlen, bufSize);
+    memcpy( (void*)signature.c_str(), buf.data, maxlen );
+
+    cache.decoders.resize(codecs.decoders.size());
+    for( i = 0; i < codecs.decoders.size(); i++ )
+    {
+        if( codecs.decoders[i]->checkSignature(signature) )
+        {
+            if( !cache.decoders[i] )
+            {
+                ImageDecoder decoder = codecs.decoders[i]->newDecoder();
+                if( !decoder || !decoder->isReusable() )
+                    return decoder;
+                cache.decoders[i] = decoder;
+            }
+            return cache.decoders[i];
+        }
+    }
+
+    return ImageDecoder();
+}
+
 static ImageEncoder findEncoder( const String& _ext )
 {
     if( _ext.size() <= 1 )
@@ -404,6 +461,80 @@ static void ApplyExifOrientation(const Mat& buf, Mat& img)
     ExifTransform(orientation, img);
 }
 
+/**
+ * The steps of the decoding shared by imread_() and decodeInto_()
+ *
+ * The failures are reported with the caller, e.g. "imread_('file.png'): can't read header: ..."
+*/
+static int
+getScaleDenom_( int flags )
+{
+    if( flags > IMREAD_LOAD_GDAL )
+    {
+        if( flags & IMREAD_REDUCED_GRAYSCALE_2 )
+            return 2;
+        if( flags & IMREAD_REDUCED_GRAYSCALE_4 )
+            return 4;
+        if( flags & IMREAD_REDUCED_GRAYSCALE_8 )
+            return 8;
+    }
+    return 1;
+}
+
+static int
+getDecodedType_( int type, int flags )
+{
+    if( (flags & IMREAD_LOAD_GDAL) != IMREAD_LOAD_GDAL && flags != IMREAD_UNCHANGED )
+    {
+        if( (flags & IMREAD_ANYDEPTH) == 0 )
+            type = CV_MAKETYPE(CV_8U, CV_MAT_CN(type));
+
+        if( (flags & IMREAD_COLOR) != 0 ||
+           ((flags & IMREAD_ANYCOLOR) != 0 && CV_MAT_CN(type) > 1) )
+            type = CV_MAKETYPE(CV_MAT_DEPTH(type), 3);
+        else
+            type = CV_MAKETYPE(CV_MAT_DEPTH(type), 1);
+    }
+    return type;
+}
+
+static bool
+readHeader_( const ImageDecoder& decoder, const char* caller, const String& filename )
+{
+    try
+    {
+        // read the header to make sure it succeeds
+        return decoder->readHeader();
+    }
+    catch (const cv::Exception& e)
+    {
+        std::cerr << caller << "('" << filename << "'): can't read header: " << e.what() << std::endl << std::flush;
+    }
+    catch (...)
+    {
+        std::cerr << caller << "('" << filename << "'): can't read header: unknown exception" << std::endl << std::flush;
+    }
+    return false;
+}
+
+static bool
+readData_( const ImageDecoder& decoder, Mat& mat, const char* caller, const String& filename )
+{
+    try
+    {
+        return decoder->readData(mat);
+    }
+    catch (const cv::Exception& e)
+    {
+        std::cerr << caller << "('" << filename << "'): can't read data: " << e.what() << std::endl << std::flush;
+    }
+    catch (...)
+    {
+        std::cerr << caller << "('" << filename << "'): can't read data: unknown exception" << std::endl << std::flush;
+    }
+    return false;
+}
+
 /**
  * Read an image into memory and return the information
  *
@@ -437,16 +568,7 @@ imread_( const String& filename, int flags, Mat& mat )
         return 0;
     }
 
-    int scale_denom = 1;
-    if( flags > IMREAD_LOAD_GDAL )
-    {
-        if( flags & IMREAD_REDUCED_GRAYSCALE_2 )
-            scale_denom = 2;
-        else if( flags & IMREAD_REDUCED_GRAYSCALE_4 )
-            scale_denom = 4;
-        else if( flags & IMREAD_REDUCED_GRAYSCALE_8 )
-            scale_denom = 8;
-    }
+    int scale_denom = getScaleDenom_( flags );
 
     /// set the scale_denom in the driver
     decoder->setScale( scale_denom );
@@ -454,59 +576,19 @@ imread_( const String& filename, int flags, Mat& mat )
     /// set the filename in the driver
     decoder->setSource( filename );
 
-    try
-    {
-        // read the header to make sure it succeeds
-        if( !decoder->readHeader() )
-            return 0;
-    }
-    catch (const cv::Exception& e)
-    {
-        std::cerr << "imread_('" << filename << "'): can't read header: " << e.what() << std::endl << std::flush;
+    if( !readHeader_( decoder, "imread_", filename ) )
         return 0;
-    }
-    catch (...)
-    {
-        std::cerr << "imread_('" << filename << "'): can't read header: unknown exception" << std::endl << std::flush;
-        return 0;
-    }
-
 
     // established the required input image size
     Size size = validateInputImageSize(Size(decoder->width(), decoder->height()));
 
     // grab the decoded type
-    int type = decoder->type();
-    if( (flags & IMREAD_LOAD_GDAL) != IMREAD_LOAD_GDAL && flags != IMREAD_UNCHANGED )
-    {
-        if( (flags & IMREAD_ANYDEPTH) == 0 )
-            type = CV_MAKETYPE(CV_8U, CV_MAT_CN(type));
-
-        if( (flags & IMREAD_COLOR) != 0 ||
-           ((flags & IMREAD_ANYCOLOR) != 0 && CV_MAT_CN(type) > 1) )
-            type = CV_MAKETYPE(CV_MAT_DEPTH(type), 3);
-        else
-            type = CV_MAKETYPE(CV_MAT_DEPTH(type), 1);
-    }
+    int type = getDecodedType_( decoder->type(), flags );
 
     mat.create( size.height, size.width, type );
 
     // read the image data
-    bool success = false;
-    try
-    {
-        if (decoder->readData(mat))
-            success = true;
-    }
-    catch (const cv::Exception& e)
-    {
-        std::cerr << "imread_('" << filename << "'): can't read data: " << e.what() << std::endl << std::flush;
-    }
-    catch (...)
-    {
-        std::cerr << "imread_('" << filename << "'): can't read data: unknown exception" << std::endl << std::flush;
-    }
-    if (!success)
+    if( !readData_( decoder, mat, "imread_", filename ) )
     {
         mat.release();
         return false;
@@ -654,6 +736,325 @@ Mat imread( const String& filename, int flags )
     return img;
 }
 
+/**
+ * Read-only view of the whole file content.
+ * The file is memory-mapped if the platform allows that, otherwise it is read into memory.
+ */
+class MappedFile
+{
+public:
+    MappedFile() : data_(NULL), size_(0)
+#if defined _WIN32
+        , hFile(INVALID_HANDLE_VALUE), hMapping(NULL)
+#endif
+    {}
+    ~MappedFile() { close(); }
+
+    bool open(const String& filename)
+    {
+        close();
+#if defined _WIN32
+        hFile = CreateFileA(filename.c_str(), GENERIC_READ, FILE_SHARE_READ, NULL, OPEN_EXISTING, FILE_FLAG_SEQUENTIAL_SCAN, NULL);
+        if (hFile == INVALID_HANDLE_VALUE)
+            return false;
+        LARGE_INTEGER fileSize;
+        if (!GetFileSizeEx(hFile, &fileSize) || fileSize.QuadPart <= 0 || (uint64)fileSize.QuadPart > (uint64)(size_t)-1)
+            return readFile(filename);
+        hMapping = CreateFileMappingA(hFile, NULL, PAGE_READONLY, 0, 0, NULL);
+        if (hMapping)
+            data_ = (const uchar*)MapViewOfFile(hMapping, FILE_MAP_READ, 0, 0, 0);
+        if (!data_)
+            return readFile(filename);
+        size_ = (size_t)fileSize.QuadPart;
+        return true;
+#elif defined HAVE_MMAP_
+        int fd = ::open(filename.c_str(), O_RDONLY);
+        if (fd < 0)
+            return false;
+        struct stat st;
+        if (fstat(fd, &st) != 0 || st.st_size <= 0)
+        {
+            ::close(fd);
+            return readFile(filename);  // special files (pipes, etc)
+        }
+        void* ptr = mmap(NULL, (size_t)st.st_size, PROT_READ, MAP_PRIVATE, fd, 0);
+        ::close(fd);
+        if (ptr == MAP_FAILED)
+            return readFile(filename);
+        data_ = (const uchar*)ptr;
+        size_ = (size_t)st.st_size;
+        return true;
+#else
+        return readFile(filename);
+#endif
+    }
+
+    void close()
+    {
+#if defined _WIN32
+        if (data_ && content.empty())
+            UnmapViewOfFile(data_);
+        if (hMapping)
+            CloseHandle(hMapping);
+        if (hFile != INVALID_HANDLE_VALUE)
+            CloseHandle(hFile);
+        hMapping = NULL;
+        hFile = INVALID_HANDLE_VALUE;
+#elif defined HAVE_MMAP_
+        if (data_ && content.empty())
+            munmap((void*)data_, size_);
+#endif
+        data_ = NULL;
+        size_ = 0;
+        content.clear();
+    }
+
+    const uchar* data() const { return data_; }
+    size_t size() const { return size_; }
+
+private:
+    bool readFile(const String& filename)
+    {
+        std::ifstream f(filename.c_str(), std::ios::in | std::ios::binary);
+        if (!f.is_open())
+            return false;
+        content.assign(std::istreambuf_iterator<char>(f), std::istreambuf_iterator<char>());
+        data_ = content.empty() ? NULL : &content[0];
+        size_ = content.size();
+        return !f.bad();
+    }
+
+    const uchar* data_;
+    size_t size_;
+    std::vector<uchar> content;  // fallback storage, used if the file can't be mapped
+#if defined _WIN32
+    HANDLE hFile;
+    HANDLE hMapping;
+#endif
+
+    MappedFile(const MappedFile&); // disabled
+    MappedFile& operator=(const MappedFile&); // disabled
+};
+
+/**
+ * Decode an image from the memory buffer into the destination array
+ *
+ * @param[in] buf Encoded image (single row of bytes)
+ * @param[in] decoder Decoder found by the buffer signature
+ * @param[in] filename Source file, used if the decoder can't read from memory (may be empty)
+ * @param[in] flags Flags
+ * @param[out] dst Destination, reused if it has the required size and type
+ * @param[in] caller Name of the calling function for the error messages
+ *
+*/
+static bool
+decodeInto_( const Mat& buf, const ImageDecoder& decoder, const String& filename, int flags, OutputArray dst,
+             const char* caller )
+{
+    int scale_denom = getScaleDenom_( flags );
+
+    /// set the scale_denom in the driver
+    decoder->setScale( scale_denom );
+
+    /// decode from the memory if the decoder supports that
+    if( !decoder->setSource(buf) )
+    {
+        if( filename.empty() )
+        {
+            // fallback to the temporary file
+            Mat img = imdecode(buf, flags);
+            if( img.empty() )
+                return false;
+            img.copyTo(dst);
+            return true;
+        }
+        decoder->setSource(filename);
+    }
+
+    if( !readHeader_( decoder, caller, filename ) )
+        return false;
+
+    // established the required input image size
+    Size size = validateInputImageSize(Size(decoder->width(), decoder->height()));
+
+    // grab the decoded type, GDAL is not used here
+    int type = getDecodedType_( decoder->type(), flags );
+
+    // JpegDecoder applies the scale while reading the header and resets it to 1,
+    // other decoders produce the full size image which is resized below
+    const int resize_denom = decoder->setScale( scale_denom );
+
+    Mat mat;
+    if( resize_denom > 1 )
+    {
+        mat.create( size.height, size.width, type );
+    }
+    else
+    {
+        dst.create( size.height, size.width, type );
+        mat = dst.getMat();
+    }
+
+    // read the image data
+    if( !readData_( decoder, mat, caller, filename ) )
+        return false;
+
+    if( resize_denom > 1 )
+    {
+        resize( mat, dst, Size( size.width / resize_denom, size.height / resize_denom ), 0, 0, INTER_LINEAR_EXACT);
+    }
+
+    /// optionally rotate the data if EXIF' orientation flag says so
+    if( (flags & IMREAD_IGNORE_ORIENTATION) == 0 && flags != IMREAD_UNCHANGED )
+    {
+        Mat img = dst.getMat();
+        const uchar* data = img.data;
+        ApplyExifOrientation(buf, img);
+        if( img.data != data )  // transposed
+            img.copyTo(dst);
+    }
+
+    return true;
+}
+
+/**
+ * Read an image from a memory-mapped file into the destination array
+ *
+ * @param[in] filename File to load
+ * @param[in] flags Flags
+ * @param[out] dst Destination, reused if it has the required size and type
+ *
+*/
+static bool
+imreadMapped_( const String& filename, int flags, OutputArray dst )
+{
+    MappedFile file;
+    if( !file.open(filename) || file.size() == 0 || file.size() > (size_t)INT_MAX )
+        return false;
+    Mat buf(1, (int)file.size(), CV_8UC1, (void*)file.data());
+
+    ImageDecoder decoder = findDecoder(buf);
+    if( !decoder )
+        return false;
+
+    return decodeInto_( buf, decoder, filename, flags, dst, "imread" );
+}
+
+bool imread( const String& filename, OutputArray dst, int flags )
+{
+    CV_TRACE_FUNCTION();
+
+    if( (flags & IMREAD_LOAD_GDAL) == IMREAD_LOAD_GDAL && flags != IMREAD_UNCHANGED )
+    {
+        Mat img = imread(filename, flags);
+        if( img.empty() )
+            return false;
+        img.copyTo(dst);
+        return true;
+    }
+
+    return imreadMapped_( filename, flags, dst );
+}
+
+class ImreadBatchInvoker : public ParallelLoopBody
+{
+public:
+    ImreadBatchInvoker(const std::vector<String>* filenames_, const std::vector<Mat>* bufs_,
+                       std::vector<Mat>& mats_, uchar* status_, int flags_) :
+        filenames(filenames_), bufs(bufs_), mats(&mats_), status(status_), flags(flags_)
+    {}
+
+    void operator()(const Range& range) const CV_OVERRIDE
+    {
+        DecoderCache& cache = decoders.getRef();
+        for( int i = range.start; i < range.end; i++ )
+        {
+            const char* name = filenames ? (*filenames)[i].c_str() : "";
+            bool success = false;
+            try
+            {
+                success = filenames ? readFile(i, cache) : decodeBuffer(i, cache);
+            }
+            catch (const cv::Exception& e)
+            {
+                std::cerr << "imreadBatch('" << name << "'): can't read image: " << e.what() << std::endl << std::flush;
+            }
+            catch (...)
+            {
+                std::cerr << "imreadBatch('" << name << "'): can't read image: unknown exception" << std::endl << std::flush;
+            }
+            if( !success )
+                (*mats)[i].release();
+            status[i] = success ? 1 : 0;
+        }
+    }
+
+private:
+    bool readFile(int i, DecoderCache& cache) const
+    {
+        const String& filename = (*filenames)[i];
+        if( (flags & IMREAD_LOAD_GDAL) == IMREAD_LOAD_GDAL && flags != IMREAD_UNCHANGED )
+            return imread(filename, (*mats)[i], flags);
+
+        MappedFile file;
+        if( !file.open(filename) || file.size() == 0 || file.size() > (size_t)INT_MAX )
+            return false;
+        Mat buf(1, (int)file.size(), CV_8UC1, (void*)file.data());
+
+        ImageDecoder decoder = findDecoder(buf, cache);
+        return decoder && decodeInto_(buf, decoder, filename, flags, (*mats)[i], "imreadBatch");
+    }
+
+    bool decodeBuffer(int i, DecoderCache& cache) const
+    {
+        const Mat& buf = (*bufs)[i];
+        if( buf.empty() || !buf.isContinuous() || buf.checkVector(1, CV_8U) <= 0 )
+            return false;
+        Mat buf_row = buf.reshape(1, 1);  // decoders expects single row
+
+        ImageDecoder decoder = findDecoder(buf_row, cache);
+        return decoder && decodeInto_(buf_row, decoder, String(), flags, (*mats)[i], "imdecodeBatch");
+    }
+
+    const std::vector<String>* filenames;
+    const std::vector<Mat>* bufs;
+    std::vector<Mat>* mats;
+    uchar* status;
+    int flags;
+    TLSData<DecoderCache> decoders;
+};
+
+static bool
+imreadBatch_( const std::vector<String>* filenames, const std::vector<Mat>* bufs, int n,
+              std::vector<Mat>& mats, OutputArray _status, int flags )
+{
+    mats.resize(n);  // keeps the existing buffers for reuse
+    std::vector<uchar> status(n, (uchar)0);
+    if( n > 0 )
+        parallel_for_(Range(0, n), ImreadBatchInvoker(filenames, bufs, mats, &status[0], flags));
+
+    if( _status.needed() )
+        Mat(status, false).copyTo(_status);
+    return std::find(status.begin(), status.end(), (uchar)0) == status.end();
+}
+
+bool imreadBatch( const std::vector<String>& filenames, std::vector<Mat>& mats, OutputArray status, int flags )
+{
+    CV_TRACE_FUNCTION();
+
+    return imreadBatch_( &filenames, NULL, (int)filenames.size(), mats, status, flags );
+}
+
+bool imdecodeBatch( InputArrayOfArrays _bufs, std::vector<Mat>& mats, OutputArray status, int flags )
+{
+    CV_TRACE_FUNCTION();
+
+    std::vector<Mat> bufs;
+    if( !_bufs.empty() )
+        _bufs.getMatVector(bufs);
+    return imreadBatch_( NULL, &bufs, (int)bufs.size(), mats, status, flags );
+}
+
 /**
 * Read a multi-page image
 *
@@ -87,6 +87,103 @@ TEST_P(Imgcodecs_Resize, imdecode_reduce_flags)
 
 //==================================================================================================
 
+TEST_P(Imgcodecs_Resize, imread_into_dst_reduce_flags)
+{
+    const string file_name = findDataFile(get<0>(get<0>(GetParam())));
+    const int imread_flag = get<0>(get<1>(GetParam()));
+
+    const Mat ref = imread(file_name, imread_flag);
+    ASSERT_FALSE(ref.empty());
+
+    Mat img;
+    ASSERT_TRUE(imread(file_name, img, imread_flag));
+    EXPECT_EQ(0, cvtest::norm(ref, img, NORM_INF));
+
+    // no reallocation if the destination has the proper size and type
+    const uchar* data = img.data;
+    img.setTo(Scalar::all(0));
+    ASSERT_TRUE(imread(file_name, img, imread_flag));
+    EXPECT_EQ(data, img.data);
+    EXPECT_EQ(0, cvtest::norm(ref, img, NORM_INF));
+
+    // user buffer
+    std::vector<uchar> buffer(ref.total() * ref.elemSize() + 1, 0);
+    Mat user(ref.size(), ref.type(), &buffer[1]);
+    ASSERT_TRUE(imread(file_name, user, imread_flag));
+    EXPECT_EQ(&buffer[1], user.data);
+    EXPECT_EQ(0, cvtest::norm(ref, user, NORM_INF));
+}
+
+TEST(Imgcodecs_Image, imread_into_dst_invalid)
+{
+    Mat img;
+    EXPECT_FALSE(imread(cv::tempfile(".jpg"), img, IMREAD_COLOR));  // file doesn't exist
+    EXPECT_TRUE(img.empty());
+}
+
+TEST(Imgcodecs_Image, imreadBatch)
+{
+    const int N = 9;
+    std::vector<Mat> refs(N);
+    std::vector<std::vector<uchar> > bufs(N);
+    std::vector<String> filenames(N);
+    RNG& rng = theRNG();
+    for (int i = 0; i < N; i++)
+    {
+        refs[i].create(16 + i * 3, 24 + i * 5, CV_8UC3);
+        rng.fill(refs[i], RNG::UNIFORM, 0, 256);
+#ifdef HAVE_PNG
+        const String ext = (i % 2) ? ".png" : ".bmp";
+#else
+        const String ext = ".bmp";
+#endif
+        ASSERT_TRUE(imencode(ext, refs[i], bufs[i]));
+        filenames[i] = cv::tempfile(ext.c_str());
+        std::ofstream f(filenames[i].c_str(), std::ios::binary);
+        f.write((const char*)&bufs[i][0], bufs[i].size());
+    }
+    // broken image
+    bufs[N / 2].assign(100, (uchar)'x');
+    remove(filenames[N / 2].c_str());
+    refs[N / 2].release();
+
+    std::vector<Mat> mats;
+    std::vector<uchar> status;
+    EXPECT_FALSE(imreadBatch(filenames, mats, status, IMREAD_COLOR));
+    ASSERT_EQ((size_t)N, mats.size());
+    ASSERT_EQ((size_t)N, status.size());
+    for (int i = 0; i < N; i++)
+    {
+        EXPECT_EQ(!refs[i].empty(), status[i] != 0) << i;
+        EXPECT_EQ(refs[i].empty(), mats[i].empty()) << i;
+        if (!refs[i].empty())
+        {
+            EXPECT_EQ(0, cvtest::norm(refs[i], mats[i], NORM_INF)) << i;
+        }
+    }
+
+    // the output buffers are reused
+    std::vector<const uchar*> data(N);
+    for (int i = 0; i < N; i++)
+        data[i] = mats[i].data;
+    EXPECT_FALSE(imdecodeBatch(bufs, mats, status, IMREAD_COLOR));
+    ASSERT_EQ((size_t)N, mats.size());
+    for (int i = 0; i < N; i++)
+    {
+        EXPECT_EQ(!refs[i].empty(), status[i] != 0) << i;
+        if (!refs[i].empty())
+        {
+            EXPECT_EQ(data[i], mats[i].data) << i;
+            EXPECT_EQ(0, cvtest::norm(refs[i], mats[i], NORM_INF)) << i;
+        }
+    }
+
+    for (int i = 0; i < N; i++)
+        remove(filenames[i].c_str());
+}
+
+//==================================================================================================
+
 INSTANTIATE_TEST_CASE_P(/*nothing*/, Imgcodecs_Resize,
         testing::Combine(
             testing::ValuesIn(images),
@@ -1452,12 +1452,36 @@ possible future modifications of all this semantics, it is recommended to specif
 sigmaX, and sigmaY.
 @param borderType pixel extrapolation method, see #BorderTypes. #BORDER_WRAP is not supported.
 
-@sa  sepFilter2D, filter2D, blur, boxFilter, bilateralFilter, medianBlur
+@note When ksize is zero and both sigmas are 20 or larger, the function calls #recursiveGaussianBlur.
+The threshold is set by the OPENCV_GAUSSIANBLUR_RECURSIVE_MIN_SIGMA environment variable, 0 disables
+the recursive filter.
+
+@sa  sepFilter2D, filter2D, blur, boxFilter, bilateralFilter, medianBlur, recursiveGaussianBlur
  */
 CV_EXPORTS_W void GaussianBlur( InputArray src, OutputArray dst, Size ksize,
                                 double sigmaX, double sigmaY = 0,
                                 int borderType = BORDER_DEFAULT );
 
+/** @brief Blurs an image using the recursive approximation of the Gaussian filter.
+
+The function approximates the Gaussian filter by the 3rd order recursive filter of Young and van Vliet,
+applied forward and backward in each direction. The cost per pixel doesn't depend on sigma, so for
+large sigmas the function is much faster than #GaussianBlur with the exact kernel. The approximation
+error is a few percent of the kernel peak, it gets larger for sigma below 5. In-place filtering is
+supported.
+
+@param src input image with 1 to 4 channels; the depth should be CV_8U, CV_16U, CV_16S, CV_32F or CV_64F.
+@param dst output image of the same size and type as src.
+@param sigmaX Gaussian standard deviation in X direction.
+@param sigmaY Gaussian standard deviation in Y direction; if sigmaY is zero, it is set to be equal
+to sigmaX.
+@param borderType pixel extrapolation method, see #BorderTypes.
+
+@sa  GaussianBlur
+ */
+CV_EXPORTS_W void recursiveGaussianBlur( InputArray src, OutputArray dst, double sigmaX,
+                                         double sigmaY = 0, int borderType = BORDER_DEFAULT );
+
 /** @brief Applies the bilateral filter to an image.
 
 The function applies bilateral filtering to the input image, as described in
@@ -230,6 +230,69 @@ PERF_TEST_P(Size_MatType_BorderType, blur5x5,
     SANITY_CHECK(dst, 1);
 }
 
+///////////// GaussianBlur with large sigma ////////////////////////
+
+typedef tuple<Size, MatType, double> Size_MatType_Sigma_t;
+typedef perf::TestBaseWithParam<Size_MatType_Sigma_t> Size_MatType_Sigma;
+
+static Size getExactGaussianKsize(int type, double sigma)
+{
+    int ksize = cvRound(sigma*(CV_MAT_DEPTH(type) == CV_8U ? 3 : 4)*2 + 1)|1;
+    return Size(ksize, ksize);
+}
+
+PERF_TEST_P(Size_MatType_Sigma, gaussianBlur_largeSigma,
+            testing::Combine(
+                testing::Values(szVGA, sz1080p),
+                testing::Values(CV_8UC1, CV_8UC3, CV_32FC1),
+                testing::Values(20., 50.)
+                )
+            )
+{
+    Size size = get<0>(GetParam());
+    int type = get<1>(GetParam());
+    double sigma = get<2>(GetParam());
+
+    Mat src(size, type);
+    Mat dst(size, type);
+
+    declare.in(src, WARMUP_RNG).out(dst).time(60);
+
+    TEST_CYCLE() GaussianBlur(src, dst, getExactGaussianKsize(type, sigma), sigma);
+
+    SANITY_CHECK_NOTHING();
+}
+
+PERF_TEST_P(Size_MatType_Sigma, recursiveGaussianBlur,
+            testing::Combine(
+                testing::Values(szVGA, sz1080p),
+                testing::Values(CV_8UC1, CV_8UC3, CV_32FC1),
+                testing::Values(20., 50.)
+                )
+            )
+{
+    Size size = get<0>(GetParam());
+    int type = get<1>(GetParam());
+    double sigma = get<2>(GetParam());
+
+    Mat src(size, type);
+    Mat dst(size, type);
+
+    declare.in(src, WARMUP_RNG).out(dst);
+
+    TEST_CYCLE() recursiveGaussianBlur(src, dst, sigma);
+
+    // the accuracy against the exact kernel, see gaussianBlur_largeSigma
+    Mat exact;
+    GaussianBlur(src, exact, getExactGaussianKsize(type, sigma), sigma);
+    // the max error stays within 1% of the range, the kernel of the 8-bit images is cut at 3 sigma
+    double minVal = 0, maxVal = 0;
+    minMaxLoc(src.reshape(1), &minVal, &maxVal);
+    EXPECT_LE(cvtest::norm(exact, dst, NORM_INF), (maxVal - minVal)*0.01 + 1);
+
+    SANITY_CHECK_NOTHING();
+}
+
 ///////////// BlendLinear ////////////////////////
 PERF_TEST_P(Size_MatType, BlendLinear,
             testing::Combine(
@@ -47,6 +47,40 @@ PERF_TEST_P(TestFindContours, findContours,
     SANITY_CHECK_NOTHING();
 }
 
+typedef TestBaseWithParam< tuple<Size, RetrMode, int> > TestFindContoursLargeMask;
+
+// the large masks are scanned in parallel bands
+PERF_TEST_P(TestFindContoursLargeMask, findContours,
+            Combine(
+               Values( sz1080p, Size(3840, 2160) ), // image size
+               RetrMode::all(), // retrieval mode
+               Values( 64, 1024 ) // blob count
+            )
+           )
+{
+    Size img_size = get<0>(GetParam());
+    int retr_mode = get<1>(GetParam());
+    int blob_count = get<2>(GetParam());
+
+    RNG rng;
+    Mat img = Mat::zeros(img_size, CV_8UC1);
+    int max_axis = img_size.width / 16;
+    for(int i = 0; i < blob_count; i++ )
+    {
+        Point center(rng.uniform(0, img.cols), rng.uniform(0, img.rows));
+        Size axes(rng.uniform(2, max_axis), rng.uniform(2, max_axis));
+        double angle = rng.uniform(0, 180);
+        int brightness = i % 4 == 3 ? 0 : 255;
+        ellipse( img, center, axes, angle, 0., 360., Scalar(brightness), -1);
+    }
+    vector< vector<Point> > contours;
+    vector< Vec4i > hierarchy;
+
+    TEST_CYCLE() findContours( img, contours, hierarchy, retr_mode, CHAIN_APPROX_SIMPLE );
+
+    SANITY_CHECK_NOTHING();
+}
+
 typedef TestBaseWithParam< tuple<Size, ApproxMode, int> > TestFindContoursFF;
 
 PERF_TEST_P(TestFindContoursFF, findContours,
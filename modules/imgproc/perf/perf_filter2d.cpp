@@ -97,4 +97,43 @@ PERF_TEST_P( Image_KernelSize, GaborFilter2d,
     SANITY_CHECK(filteredImage, 1e-6, ERROR_RELATIVE);
 }
 
+enum { FILTER_FILTER2D, FILTER_SEPFILTER2D, FILTER_BOX, FILTER_GAUSSIAN_32F, FILTER_ERODE, FILTER_DILATE };
+CV_ENUM(FilterEngineOp, FILTER_FILTER2D, FILTER_SEPFILTER2D, FILTER_BOX, FILTER_GAUSSIAN_32F, FILTER_ERODE, FILTER_DILATE)
+
+typedef TestBaseWithParam< tuple<FilterEngineOp, int> > FilterEngine_12MP;
+
+PERF_TEST_P( FilterEngine_12MP, parallel_bands,
+             Combine(
+                FilterEngineOp::all(),
+                Values( 3, 7 )
+             )
+)
+{
+    int op = get<0>(GetParam()), kSize = get<1>(GetParam());
+    Size sz(4000, 3000);
+
+    Mat src(sz, op == FILTER_GAUSSIAN_32F || op == FILTER_SEPFILTER2D ? CV_32FC1 : CV_8UC1), dst;
+    Mat kernel(kSize, kSize, CV_32FC1), kx(1, kSize, CV_32FC1);
+    randu(kernel, -1, 1);
+    randu(kx, -1, 1);
+    Mat se = getStructuringElement(MORPH_RECT, Size(kSize, kSize));
+
+    declare.in(src, WARMUP_RNG);
+
+    TEST_CYCLE()
+    {
+        switch (op)
+        {
+        case FILTER_FILTER2D: cv::filter2D(src, dst, -1, kernel); break;
+        case FILTER_SEPFILTER2D: cv::sepFilter2D(src, dst, -1, kx, kx); break;
+        case FILTER_BOX: cv::boxFilter(src, dst, -1, Size(kSize, kSize)); break;
+        case FILTER_GAUSSIAN_32F: cv::GaussianBlur(src, dst, Size(kSize, kSize), 0); break;
+        case FILTER_ERODE: cv::erode(src, dst, se); break;
+        case FILTER_DILATE: cv::dilate(src, dst, se); break;
+        }
+    }
+
+    SANITY_CHECK_NOTHING();
+}
+
 } // namespace
@@ -39,4 +39,30 @@ PERF_TEST_P(Size_MatType, dilate, TYPICAL_MATS_MORPH)
     SANITY_CHECK(dst);
 }
 
+typedef tuple<Size, MatType, int> Size_MatType_kSize_t;
+typedef perf::TestBaseWithParam<Size_MatType_kSize_t> Size_MatType_kSize;
+
+PERF_TEST_P(Size_MatType_kSize, erode_rect,
+            testing::Combine(
+                testing::Values(sz1080p, sz2160p),
+                testing::Values(CV_8UC1, CV_32FC1),
+                testing::Values(5, 15, 31, 61, 101)
+                )
+            )
+{
+    Size sz = get<0>(GetParam());
+    int type = get<1>(GetParam());
+    int ksize = get<2>(GetParam());
+
+    Mat src(sz, type);
+    Mat dst(sz, type);
+    Mat kernel = getStructuringElement(MORPH_RECT, Size(ksize, ksize));
+
+    declare.in(src, WARMUP_RNG).out(dst);
+
+    TEST_CYCLE() erode(src, dst, kernel);
+
+    SANITY_CHECK_NOTHING();
+}
+
 } // namespace
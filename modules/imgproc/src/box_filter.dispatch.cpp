@@ -482,10 +482,13 @@ void boxFilter(InputArray _src, OutputArray _dst, int ddepth,
 
     borderType = (borderType&~BORDER_ISOLATED);
 
-    Ptr<FilterEngine> f = createBoxFilter( src.type(), dst.type(),
-                        ksize, anchor, normalize, borderType );
+    auto createEngine = [&]()
+    {
+        return createBoxFilter( src.type(), dst.type(),
+                                ksize, anchor, normalize, borderType );
+    };
 
-    f->apply( src, dst, wsz, ofs );
+    parallelFilterApply( createEngine(), createEngine, src, dst, wsz, ofs );
 }
 
 
@@ -544,18 +547,21 @@ void sqrBoxFilter(InputArray _src, OutputArray _dst, int ddepth,
     _dst.create( size, dstType );
     Mat dst = _dst.getMat();
 
-    Ptr<BaseRowFilter> rowFilter = getSqrRowSumFilter(srcType, sumType, ksize.width, anchor.x );
-    Ptr<BaseColumnFilter> columnFilter = getColumnSumFilter(sumType,
-                                                            dstType, ksize.height, anchor.y,
-                                                            normalize ? 1./(ksize.width*ksize.height) : 1);
-
-    Ptr<FilterEngine> f = makePtr<FilterEngine>(Ptr<BaseFilter>(), rowFilter, columnFilter,
-                                                srcType, dstType, sumType, borderType );
+    auto createEngine = [&]()
+    {
+        Ptr<BaseRowFilter> rowFilter = getSqrRowSumFilter(srcType, sumType, ksize.width, anchor.x );
+        Ptr<BaseColumnFilter> columnFilter = getColumnSumFilter(sumType,
+                                                                dstType, ksize.height, anchor.y,
+                                                                normalize ? 1./(ksize.width*ksize.height) : 1);
+
+        return makePtr<FilterEngine>(Ptr<BaseFilter>(), rowFilter, columnFilter,
+                                     srcType, dstType, sumType, borderType );
+    };
     Point ofs;
     Size wsz(src.cols, src.rows);
     src.locateROI( wsz, ofs );
 
-    f->apply( src, dst, wsz, ofs );
+    parallelFilterApply( createEngine(), createEngine, src, dst, wsz, ofs );
 }
 
 } // namespace
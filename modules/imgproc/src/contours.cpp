@@ -40,6 +40,7 @@
 //M*/
 #include "precomp.hpp"
 #include "opencv2/core/hal/intrin.hpp"
+#include "opencv2/core/utils/configuration.private.hpp"
 
 using namespace cv;
 
@@ -1790,6 +1791,362 @@ cvFindContours( void*  img,  CvMemStorage*  storage,
     return cvFindContours_Impl(img, storage, firstContour, cntHeaderSize, mode, method, offset, 1);
 }
 
+/*
+   Parallel version of findContours() for the large images.
+
+   The borders found by the raster scan above are determined by the connected components
+   of the image: every 8-connected component of ones has the outer border starting at its
+   first pixel in the raster order, and every 4-connected component of zeros, except the
+   background, is a hole whose border starts at the pixel to the left of its first pixel.
+   The parent of a border is the border of the component to the left of its first pixel.
+
+   So the image is split into the horizontal bands, which are labeled concurrently by
+   the union-find over the runs of the equal pixels. The runs crossing the seams of the bands
+   are stitched afterwards. The borders are traced independently, without the marks in
+   the image, and the contour tree is built in the same order as cvFindNextContour()
+   discovers the borders, so the output is identical to the serial one.
+*/
+namespace cv
+{
+
+// union-find keeps the smallest index as the root, so the root is the first run of a component
+static inline int findContourRunRoot( int* parent, int i )
+{
+    while( parent[i] != i )
+    {
+        parent[i] = parent[parent[i]];
+        i = parent[i];
+    }
+    return i;
+}
+
+static inline void uniteContourRuns( int* parent, int i, int j )
+{
+    i = findContourRunRoot( parent, i );
+    j = findContourRunRoot( parent, j );
+    if( i < j )
+        parent[j] = i;
+    else
+        parent[i] = j;
+}
+
+// Connects the runs of the row with the runs of the previous row. Each row starts with
+// the run of zeros (the border), so the odd runs are the runs of ones.
+static void connectContourRuns( const Vec2i* prev, int nprev, int prevBase,
+                                const Vec2i* cur, int ncur, int curBase, int* parent )
+{
+    for( int i = 0, j = 0; i < ncur; i++ )
+    {
+        // ones are 8-connected, zeros are 4-connected
+        int ext = i & 1;
+        while( j < nprev - 1 && prev[j][1] + ext <= cur[i][0] )
+            j++;
+        for( int k = j; k < nprev && prev[k][0] < cur[i][1] + ext; k++ )
+            if( ((i ^ k) & 1) == 0 )
+                uniteContourRuns( parent, curBase + i, prevBase + k );
+    }
+}
+
+struct ContourRunsBand
+{
+    std::vector<Vec2i> runs;
+    std::vector<int> rowOfs;
+    std::vector<int> parent;
+    int ncomponents;  // the connected components of the runs within the band
+};
+
+// Follows the border the same way icvFetchContour() does, but doesn't mark the image
+static void traceContourBorder( const uchar* ptr, int step, Point pt, bool isHole,
+                                bool simple, std::vector<Point>& contour )
+{
+    int deltas[MAX_SIZE];
+    const uchar *i0 = ptr, *i1, *i3, *i4 = 0;
+    int prev_s = -1, s, s_end;
+
+    CV_INIT_3X3_DELTAS( deltas, step, 1 );
+    memcpy( deltas + 8, deltas, 8 * sizeof( deltas[0] ));
+
+    s_end = s = isHole ? 0 : 4;
+
+    do
+    {
+        s = (s - 1) & 7;
+        i1 = i0 + deltas[s];
+    }
+    while( *i1 == 0 && s != s_end );
+
+    if( s == s_end )            /* single pixel domain */
+    {
+        contour.push_back( pt );
+        return;
+    }
+
+    i3 = i0;
+    prev_s = s ^ 4;
+
+    for( ;; )
+    {
+        s = std::min(s, MAX_SIZE - 1);
+        while( s < MAX_SIZE - 1 )
+        {
+            i4 = i3 + deltas[++s];
+            if( *i4 != 0 )
+                break;
+        }
+        s &= 7;
+
+        if( s != prev_s || !simple )
+        {
+            contour.push_back( pt );
+            prev_s = s;
+        }
+
+        pt.x += icvCodeDeltas[s].x;
+        pt.y += icvCodeDeltas[s].y;
+
+        if( i4 == i0 && i3 == i1 )
+            break;
+
+        i3 = i4;
+        s = (s + 4) & 7;
+    }
+}
+
+static bool findContoursParallel( const Mat& image0, OutputArrayOfArrays _contours,
+                                  OutputArray _hierarchy, int mode, int method, Point offset )
+{
+    static size_t param_find_contours_parallel_min_pixels =
+        utils::getConfigurationParameterSizeT("OPENCV_FINDCONTOURS_PARALLEL_MIN_PIXELS", 1 << 19);
+
+    if( image0.type() != CV_8UC1 || mode < RETR_EXTERNAL || mode > RETR_TREE ||
+        (method != CHAIN_APPROX_NONE && method != CHAIN_APPROX_SIMPLE) ||
+        param_find_contours_parallel_min_pixels == 0 ||
+        image0.total() < param_find_contours_parallel_min_pixels || getNumThreads() <= 1 )
+        return false;
+
+    CV_INSTRUMENT_REGION();
+
+    // the image with the zero border, as in the serial version
+    int rows = image0.rows + 2, width = image0.cols + 2;
+    Mat image(rows, width, CV_8UC1);
+    int nbands = std::max(std::min(getNumThreads()*4, rows / 64), 1);
+    std::vector<ContourRunsBand> bands(nbands);
+
+    parallel_for_(Range(0, nbands), [&](const Range& range)
+    {
+        CvSize rowSize = cvSize(width, 1);
+        for( int b = range.start; b < range.end; b++ )
+        {
+            ContourRunsBand& band = bands[b];
+            int y0 = b*rows/nbands, y1 = (b + 1)*rows/nbands;
+            band.rowOfs.resize(y1 - y0 + 1);
+            band.rowOfs[0] = 0;
+            for( int y = y0; y < y1; y++ )
+            {
+                uchar* row = image.ptr(y);
+                if( y == 0 || y == rows - 1 )
+                    memset( row, 0, width );
+                else
+                {
+                    row[0] = row[width - 1] = 0;
+                    memcpy( row + 1, image0.ptr(y - 1), width - 2 );
+                }
+
+                for( int x = 0; x < width; )
+                {
+                    int x1 = findStartContourPoint( row, rowSize, x );
+                    band.runs.push_back(Vec2i(x, x1));
+                    if( x1 >= width )
+                        break;
+                    x = findEndContourPoint( row, rowSize, x1 );
+                    band.runs.push_back(Vec2i(x1, x));
+                }
+                band.rowOfs[y - y0 + 1] = (int)band.runs.size();
+            }
+
+            int nruns = (int)band.runs.size();
+            band.parent.resize(nruns);
+            for( int i = 0; i < nruns; i++ )
+                band.parent[i] = i;
+            for( int y = 1; y < y1 - y0; y++ )
+            {
+                const int* ofs = &band.rowOfs[y - 1];
+                connectContourRuns( &band.runs[ofs[0]], ofs[1] - ofs[0], ofs[0],
+                                    &band.runs[ofs[1]], ofs[2] - ofs[1], ofs[1], &band.parent[0] );
+            }
+            band.ncomponents = 0;
+            for( int i = 0; i < nruns; i++ )
+                band.ncomponents += band.parent[i] == i;
+        }
+    });
+
+    // the serial scan labels the borders by 7 bits, the labels are reused after 126 borders
+    // and then the parent of an outer border in the tree may be resolved to the other border
+    // passing through the same pixel. Such images are left to the serial scan for the same output.
+    // Every component is a border, except the background one. Stitching the bands merges
+    // at most one component per run of the two rows at the seam, so the lower bound of
+    // the number of the borders is known before the stitching and the tracing.
+    const int maxTreeContours = 126;
+    if( mode == RETR_TREE )
+    {
+        int minTotal = -1;
+        for( int b = 0; b < nbands; b++ )
+        {
+            const ContourRunsBand& band = bands[b];
+            minTotal += band.ncomponents;
+            if( b > 0 )
+                minTotal -= band.rowOfs[1] + (int)bands[b - 1].runs.size() - bands[b - 1].rowOfs.end()[-2];
+        }
+        if( minTotal > maxTreeContours )
+            return false;
+    }
+
+    // gather the bands and stitch the runs across the seams
+    std::vector<int> bandBase(nbands + 1, 0);
+    for( int b = 0; b < nbands; b++ )
+        bandBase[b + 1] = bandBase[b] + (int)bands[b].runs.size();
+    int nruns = bandBase[nbands];
+    std::vector<Vec2i> runs(nruns);
+    std::vector<int> parent(nruns), rowOfs(rows + 1);
+    rowOfs[rows] = nruns;
+    parallel_for_(Range(0, nbands), [&](const Range& range)
+    {
+        for( int b = range.start; b < range.end; b++ )
+        {
+            const ContourRunsBand& band = bands[b];
+            int base = bandBase[b], y0 = b*rows/nbands, nbandRows = (int)band.rowOfs.size() - 1;
+            std::copy(band.runs.begin(), band.runs.end(), runs.begin() + base);
+            for( size_t i = 0; i < band.parent.size(); i++ )
+                parent[base + i] = band.parent[i] + base;
+            for( int y = 0; y < nbandRows; y++ )
+                rowOfs[y0 + y] = band.rowOfs[y] + base;
+        }
+    });
+    bands.clear();
+
+    int* parentPtr = &parent[0];
+    for( int b = 1; b < nbands; b++ )
+    {
+        int y = b*rows/nbands;
+        connectContourRuns( &runs[rowOfs[y - 1]], rowOfs[y] - rowOfs[y - 1], rowOfs[y - 1],
+                            &runs[rowOfs[y]], rowOfs[y + 1] - rowOfs[y], rowOfs[y], parentPtr );
+    }
+
+    // the first runs of the components are the starting points of the borders, the run #0
+    // is the background. The borders are listed in the order of the raster scan.
+    std::vector<Point> origins;
+    std::vector<int> contourParent, contourOfRun(nruns, -1);
+    std::vector<uchar> isHole;
+    for( int y = 1; y < rows - 1; y++ )
+    {
+        for( int i = rowOfs[y] + 1; i < rowOfs[y + 1]; i++ )
+        {
+            if( parent[i] != i )
+                continue;
+            bool hole = ((i - rowOfs[y]) & 1) == 0;
+            int leftRoot = findContourRunRoot( parentPtr, i - 1 );
+            int par = -1;
+            if( hole )
+            {
+                if( mode == RETR_EXTERNAL )
+                    continue;
+                if( mode != RETR_LIST )
+                    par = contourOfRun[leftRoot];
+            }
+            else if( leftRoot != 0 )
+            {
+                // the component is inside the hole
+                if( mode == RETR_EXTERNAL )
+                    continue;
+                if( mode == RETR_TREE )
+                    par = contourOfRun[leftRoot];
+            }
+            contourOfRun[i] = (int)origins.size();
+            origins.push_back(Point(runs[i][0] - (hole ? 1 : 0), y));
+            contourParent.push_back(par);
+            isHole.push_back((uchar)hole);
+        }
+    }
+
+    int total = (int)origins.size();
+    if( mode == RETR_TREE && total > maxTreeContours )
+        return false;
+
+    std::vector<std::vector<Point> > contours(total);
+    Point ofs = offset - Point(1, 1);
+    parallel_for_(Range(0, total), [&](const Range& range)
+    {
+        for( int i = range.start; i < range.end; i++ )
+            traceContourBorder( image.ptr(origins[i].y) + origins[i].x, (int)image.step,
+                                origins[i] + ofs, isHole[i] != 0,
+                                method == CHAIN_APPROX_SIMPLE, contours[i] );
+    });
+
+    if( _hierarchy.needed() )
+        _hierarchy.clear();
+    if( total == 0 )
+    {
+        _contours.clear();
+        return true;
+    }
+
+    // cvInsertNodeIntoTree() puts the new contour in front of its siblings
+    // and cvTreeToNodeSeq() lists the tree in the depth-first order
+    std::vector<int> firstChild(total + 1, -1), nextSibling(total, -1), prevSibling(total, -1);
+    for( int i = 0; i < total; i++ )
+    {
+        int& first = firstChild[contourParent[i] + 1];
+        nextSibling[i] = first;
+        if( first >= 0 )
+            prevSibling[first] = i;
+        first = i;
+    }
+
+    std::vector<int> order, position(total);
+    order.reserve(total);
+    for( int i = firstChild[0]; i >= 0; )
+    {
+        position[i] = (int)order.size();
+        order.push_back(i);
+        if( firstChild[i + 1] >= 0 )
+        {
+            i = firstChild[i + 1];
+            continue;
+        }
+        while( i >= 0 && nextSibling[i] < 0 )
+            i = contourParent[i];
+        if( i >= 0 )
+            i = nextSibling[i];
+    }
+
+    _contours.create(total, 1, 0, -1, true);
+    for( int i = 0; i < total; i++ )
+    {
+        const std::vector<Point>& c = contours[order[i]];
+        _contours.create((int)c.size(), 1, CV_32SC2, i, true);
+        Mat ci = _contours.getMat(i);
+        CV_Assert( ci.isContinuous() );
+        memcpy( ci.ptr(), &c[0], c.size()*sizeof(c[0]) );
+    }
+
+    if( _hierarchy.needed() )
+    {
+        _hierarchy.create(1, total, CV_32SC4, -1, true);
+        Vec4i* hierarchy = _hierarchy.getMat().ptr<Vec4i>();
+        for( int i = 0; i < total; i++ )
+        {
+            int c = order[i], v_next = firstChild[c + 1];
+            hierarchy[i] = Vec4i(nextSibling[c] >= 0 ? position[nextSibling[c]] : -1,
+                                 prevSibling[c] >= 0 ? position[prevSibling[c]] : -1,
+                                 v_next >= 0 ? position[v_next] : -1,
+                                 contourParent[c] >= 0 ? position[contourParent[c]] : -1);
+        }
+    }
+    return true;
+}
+
+} // namespace cv
+
 void cv::findContours( InputArray _image, OutputArrayOfArrays _contours,
                    OutputArray _hierarchy, int mode, int method, Point offset )
 {
@@ -1802,6 +2159,9 @@ void cv::findContours( InputArray _image, OutputArrayOfArrays _contours,
     CV_Assert(_contours.empty() || (_contours.channels() == 2 && _contours.depth() == CV_32S));
 
     Mat image0 = _image.getMat(), image;
+    if( findContoursParallel(image0, _contours, _hierarchy, mode, method, offset) )
+        return;
+
     Point offset0(0, 0);
     if(method != CV_LINK_RUNS)
     {
@@ -220,6 +220,52 @@ void FilterEngine::apply(const Mat& src, Mat& dst, const Size& wsz, const Point&
         CV_CPU_DISPATCH_MODES_ALL);
 }
 
+// the number of pixels in a band. It doesn't depend on the number of threads, so the results
+// of the floating-point box filters, which depend on the band boundaries, are reproducible
+#define CV_FILTER_PARALLEL_BAND_SIZE (1 << 17)
+
+void parallelFilterApply(const Ptr<FilterEngine>& f, const std::function<Ptr<FilterEngine>()>& createEngine,
+                         const Mat& _src, Mat& dst, const Size& wsz, const Point& ofs)
+{
+    CV_INSTRUMENT_REGION();
+
+    int rows = dst.rows, kheight = f->ksize.height;
+    // a band costs kheight-1 extra rows of the row filter
+    int bandRows = std::max(std::max(kheight*8, 16), CV_FILTER_PARALLEL_BAND_SIZE / std::max(dst.cols, 1));
+    int nbands = rows / bandRows;
+    if( nbands <= 1 )
+    {
+        f->apply(_src, dst, wsz, ofs);
+        return;
+    }
+
+    // the source rows read by the filter: the whole width of the image is used by the border tables
+    Mat src = _src, buf;
+    size_t esz = src.elemSize();
+    int y0 = std::max(ofs.y - f->anchor.y, 0);
+    int y1 = std::min(ofs.y + src.rows + kheight - f->anchor.y - 1, wsz.height);
+    const uchar* sstart = src.ptr() + (ptrdiff_t)(y0 - ofs.y)*(ptrdiff_t)src.step - ofs.x*esz;
+    const uchar* send = src.ptr() + (ptrdiff_t)(y1 - 1 - ofs.y)*(ptrdiff_t)src.step + (wsz.width - ofs.x)*esz;
+    const uchar* dend = dst.ptr(rows - 1) + dst.cols*dst.elemSize();
+    if( sstart < dend && dst.ptr() < send )
+    {
+        // the bands would read the rows written by the other bands
+        Mat(y1 - y0, wsz.width, src.type(), (void*)sstart, src.step).copyTo(buf);
+        src = Mat(src.size(), src.type(), buf.ptr(ofs.y - y0) + ofs.x*esz, buf.step);
+    }
+
+    parallel_for_(Range(0, nbands), [&](const Range& range)
+    {
+        Ptr<FilterEngine> e = range.start == 0 ? f : createEngine();
+        for( int b = range.start; b < range.end; b++ )
+        {
+            int b0 = (int)((int64)rows*b/nbands), b1 = (int)((int64)rows*(b + 1)/nbands);
+            Mat dstBand = dst.rowRange(b0, b1);
+            e->apply(src.rowRange(b0, b1), dstBand, wsz, ofs + Point(0, b0));
+        }
+    }, nbands);
+}
+
 /****************************************************************************************\
 *                                 Separable linear filter                                *
 \****************************************************************************************/
@@ -1355,11 +1401,14 @@ static void ocvFilter2D(int stype, int dtype, int kernel_type,
 {
     int borderTypeValue = borderType & ~BORDER_ISOLATED;
     Mat kernel = Mat(Size(kernel_width, kernel_height), kernel_type, kernel_data, kernel_step);
-    Ptr<FilterEngine> f = createLinearFilter(stype, dtype, kernel, Point(anchor_x, anchor_y), delta,
-                                             borderTypeValue);
+    auto createEngine = [&]()
+    {
+        return createLinearFilter(stype, dtype, kernel, Point(anchor_x, anchor_y), delta,
+                                  borderTypeValue);
+    };
     Mat src(Size(width, height), stype, src_data, src_step);
     Mat dst(Size(width, height), dtype, dst_data, dst_step);
-    f->apply(src, dst, Size(full_width, full_height), Point(offset_x, offset_y));
+    parallelFilterApply(createEngine(), createEngine, src, dst, Size(full_width, full_height), Point(offset_x, offset_y));
 }
 
 static bool replacementSepFilter(int stype, int dtype, int ktype,
@@ -1395,12 +1444,15 @@ static void ocvSepFilter(int stype, int dtype, int ktype,
 {
     Mat kernelX(Size(kernelx_len, 1), ktype, kernelx_data);
     Mat kernelY(Size(kernely_len, 1), ktype, kernely_data);
-    Ptr<FilterEngine> f = createSeparableLinearFilter(stype, dtype, kernelX, kernelY,
-                                                      Point(anchor_x, anchor_y),
-                                                      delta, borderType & ~BORDER_ISOLATED);
+    auto createEngine = [&]()
+    {
+        return createSeparableLinearFilter(stype, dtype, kernelX, kernelY,
+                                           Point(anchor_x, anchor_y),
+                                           delta, borderType & ~BORDER_ISOLATED);
+    };
     Mat src(Size(width, height), stype, src_data, src_step);
     Mat dst(Size(width, height), dtype, dst_data, dst_step);
-    f->apply(src, dst, Size(full_width, full_height), Point(offset_x, offset_y));
+    parallelFilterApply(createEngine(), createEngine, src, dst, Size(full_width, full_height), Point(offset_x, offset_y));
 };
 
 //===================================================================
@@ -358,6 +358,18 @@ CV_EXPORTS Ptr<FilterEngine> createMorphologyFilter(int op, int type, InputArray
                                                     int columnBorderType = -1,
                                                     const Scalar& borderValue = morphologyDefaultBorderValue());
 
+/** applies the filter to the horizontal bands of the image in parallel.
+ The bands are processed by the separate engines (the primitive filters keep the state between the rows),
+ the first one is f, the others are made by createEngine. Each band reads the rows around it from src,
+ so the result is the same as of f->apply(src, dst, wsz, ofs), including the in-place filtering.
+ The exception is the floating-point box filters (boxFilter, sqrBoxFilter of CV_32F/CV_64F sums): their
+ column filters keep the running sums, which each band starts anew, so the results may differ from the
+ serial pass by the rounding errors of the sums. The bands depend on the image size and the kernel only,
+ so the results don't depend on the number of threads.
+*/
+void parallelFilterApply(const Ptr<FilterEngine>& f, const std::function<Ptr<FilterEngine>()>& createEngine,
+                         const Mat& src, Mat& dst, const Size& wsz, const Point& ofs);
+
 static inline Point normalizeAnchor( Point anchor, Size ksize )
 {
    if( anchor.x == -1 )
@@ -87,6 +87,22 @@ Ptr<BaseFilter> getMorphologyFilter(int op, int type, InputArray _kernel, Point
 }
 
 
+// the border value that doesn't change the result of the operation
+static Scalar getMorphologyDefaultBorderValue(int op, int depth)
+{
+    CV_Assert( depth == CV_8U || depth == CV_16U || depth == CV_16S ||
+               depth == CV_32F || depth == CV_64F );
+    if( op == MORPH_ERODE )
+        return Scalar::all( depth == CV_8U ? (double)UCHAR_MAX :
+                            depth == CV_16U ? (double)USHRT_MAX :
+                            depth == CV_16S ? (double)SHRT_MAX :
+                            depth == CV_32F ? (double)FLT_MAX : DBL_MAX);
+    return Scalar::all( depth == CV_8U || depth == CV_16U ?
+                            0. :
+                        depth == CV_16S ? (double)SHRT_MIN :
+                        depth == CV_32F ? (double)-FLT_MAX : -DBL_MAX);
+}
+
 Ptr<FilterEngine> createMorphologyFilter(
         int op, int type, InputArray _kernel,
         Point anchor, int _rowBorderType, int _columnBorderType,
@@ -111,21 +127,7 @@ Ptr<FilterEngine> createMorphologyFilter(
     Scalar borderValue = _borderValue;
     if( (_rowBorderType == BORDER_CONSTANT || _columnBorderType == BORDER_CONSTANT) &&
             borderValue == morphologyDefaultBorderValue() )
-    {
-        int depth = CV_MAT_DEPTH(type);
-        CV_Assert( depth == CV_8U || depth == CV_16U || depth == CV_16S ||
-                   depth == CV_32F || depth == CV_64F );
-        if( op == MORPH_ERODE )
-            borderValue = Scalar::all( depth == CV_8U ? (double)UCHAR_MAX :
-                                       depth == CV_16U ? (double)USHRT_MAX :
-                                       depth == CV_16S ? (double)SHRT_MAX :
-                                       depth == CV_32F ? (double)FLT_MAX : DBL_MAX);
-        else
-            borderValue = Scalar::all( depth == CV_8U || depth == CV_16U ?
-                                           0. :
-                                       depth == CV_16S ? (double)SHRT_MIN :
-                                       depth == CV_32F ? (double)-FLT_MAX : -DBL_MAX);
-    }
+        borderValue = getMorphologyDefaultBorderValue(op, CV_MAT_DEPTH(type));
 
     return makePtr<FilterEngine>(filter2D, rowFilter, columnFilter,
                                  type, type, type, _rowBorderType, _columnBorderType, borderValue );
@@ -431,6 +433,64 @@ static bool ippMorph(int op, int src_type, int dst_type,
 
 // ===== 3. Fallback implementation
 
+// rectangular structuring elements of this size or larger in one of the directions are processed
+// separably: the columns by the van Herk/Gil-Werman algorithm, 3 comparisons per pixel for any kernel
+// height, the rows by the doubling windows, log2(ksize.width) + 1 vectorized comparisons per pixel
+#define CV_MORPH_VAN_HERK_MIN_KSIZE 15
+
+static void morphColumnsVanHerk(int op, int depth, const Mat& src, Mat& dst, int ksize, const Range& range)
+{
+    CV_CPU_DISPATCH(morphColumnsVanHerk, (op, depth, src, dst, ksize, range),
+        CV_CPU_DISPATCH_MODES_ALL);
+}
+
+static void morphRowsDoubling(int op, int depth, Mat& src, Mat& dst, int ksize, const Range& range)
+{
+    CV_CPU_DISPATCH(morphRowsDoubling, (op, depth, src, dst, ksize, range),
+        CV_CPU_DISPATCH_MODES_ALL);
+}
+
+// Erosion/dilation by the ksize rectangle. The columns of the padded source are filtered by
+// van Herk/Gil-Werman (O(1) per pixel), then the rows are filtered in place by the doubling windows
+// (O(log ksize.width) per pixel, but all the passes are vectorized and the rows stay in the cache).
+static void morphRectVanHerk(int op, const Mat& src, Mat& dst, Size ksize, Point anchor,
+                             int borderType, const Scalar& borderValue)
+{
+    int type = src.type(), depth = CV_MAT_DEPTH(type);
+    Mat padded, tmp;
+    copyMakeBorder(src, padded, anchor.y, ksize.height - anchor.y - 1,
+                   anchor.x, ksize.width - anchor.x - 1, borderType, borderValue);
+
+    if( ksize.height > 1 )
+    {
+        // the single column kernel is done by this pass, it goes to dst directly
+        if( ksize.width == 1 )
+            tmp = dst;
+        else
+            tmp.create(src.rows, padded.cols, type);
+        Mat src1 = padded.reshape(1), dst1 = tmp.reshape(1);
+        int nblocks = (src.rows + ksize.height - 1)/ksize.height;
+        parallel_for_(Range(0, nblocks), [&](const Range& r)
+        {
+            morphColumnsVanHerk(op, depth, src1, dst1, ksize.height, r);
+        });
+    }
+    else
+        tmp = padded;
+
+    if( ksize.width == 1 )
+    {
+        if( tmp.data != dst.data )
+            tmp.copyTo(dst);
+        return;
+    }
+
+    parallel_for_(Range(0, src.rows), [&](const Range& r)
+    {
+        morphRowsDoubling(op, depth, tmp, dst, ksize.width, r);
+    });
+}
+
 static void ocvMorph(int op, int src_type, int dst_type,
                      uchar * src_data, size_t src_step,
                      uchar * dst_data, size_t dst_step,
@@ -444,19 +504,44 @@ static void ocvMorph(int op, int src_type, int dst_type,
     Mat kernel(Size(kernel_width, kernel_height), kernel_type, kernel_data, kernel_step);
     Point anchor(anchor_x, anchor_y);
     Vec<double, 4> borderVal(borderValue);
-    Ptr<FilterEngine> f = createMorphologyFilter(op, src_type, kernel, anchor, borderType, borderType, borderVal);
+
+    if( std::max(kernel_width, kernel_height) >= CV_MORPH_VAN_HERK_MIN_KSIZE &&
+        CV_MAT_CN(src_type) <= 4 && src_type == dst_type &&
+        countNonZero(kernel) == kernel_width*kernel_height )
+    {
+        Scalar bval = borderVal;
+        if( borderType == BORDER_CONSTANT && bval == morphologyDefaultBorderValue() )
+            bval = getMorphologyDefaultBorderValue(op, CV_MAT_DEPTH(src_type));
+        // the images are restored within the whole ones, so copyMakeBorder() takes the pixels
+        // outside of the ROIs from there, like FilterEngine does
+        size_t esz = CV_ELEM_SIZE(src_type);
+        Mat src = Mat(Size(roi_width, roi_height), src_type, src_data - roi_y*src_step - roi_x*esz, src_step)
+                      (Rect(roi_x, roi_y, width, height));
+        Mat dst = Mat(Size(roi_width2, roi_height2), dst_type, dst_data - roi_y2*dst_step - roi_x2*esz, dst_step)
+                      (Rect(roi_x2, roi_y2, width, height));
+        morphRectVanHerk(op, src, dst, kernel.size(), anchor, borderType, bval);
+        for( int i = 1; i < iterations; i++ )
+            morphRectVanHerk(op, dst, dst, kernel.size(), anchor, borderType, bval);
+        return;
+    }
+
+    auto createEngine = [&]()
+    {
+        return createMorphologyFilter(op, src_type, kernel, anchor, borderType, borderType, borderVal);
+    };
+    Ptr<FilterEngine> f = createEngine();
     Mat src(Size(width, height), src_type, src_data, src_step);
     Mat dst(Size(width, height), dst_type, dst_data, dst_step);
     {
         Point ofs(roi_x, roi_y);
         Size wsz(roi_width, roi_height);
-        f->apply( src, dst, wsz, ofs );
+        parallelFilterApply( f, createEngine, src, dst, wsz, ofs );
     }
     {
         Point ofs(roi_x2, roi_y2);
         Size wsz(roi_width2, roi_height2);
         for( int i = 1; i < iterations; i++ )
-            f->apply( dst, dst, wsz, ofs );
+            parallelFilterApply( f, createEngine, dst, dst, wsz, ofs );
     }
 }
 
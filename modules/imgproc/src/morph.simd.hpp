@@ -54,6 +54,8 @@ CV_CPU_OPTIMIZATION_NAMESPACE_BEGIN
 Ptr<BaseRowFilter> getMorphologyRowFilter(int op, int type, int ksize, int anchor);
 Ptr<BaseColumnFilter> getMorphologyColumnFilter(int op, int type, int ksize, int anchor);
 Ptr<BaseFilter> getMorphologyFilter(int op, int type, const Mat& kernel, Point anchor);
+void morphColumnsVanHerk(int op, int depth, const Mat& src, Mat& dst, int ksize, const Range& range);
+void morphRowsDoubling(int op, int depth, Mat& src, Mat& dst, int ksize, const Range& range);
 
 #ifndef CV_CPU_OPTIMIZATION_DECLARATIONS_ONLY
 
@@ -106,6 +108,11 @@ struct MorphNoVec
     int operator()(uchar**, int, uchar*, int) const { return 0; }
 };
 
+struct MorphUpdateNoVec
+{
+    int operator()(const uchar*, const uchar*, uchar*, int) const { return 0; }
+};
+
 #if CV_SIMD
 
 template<class VecUpdate> struct MorphRowVec
@@ -406,6 +413,28 @@ template<class VecUpdate> struct MorphVec
     }
 };
 
+template<class VecUpdate> struct MorphUpdateVec
+{
+    typedef typename VecUpdate::vtype vtype;
+    typedef typename vtype::lane_type stype;
+    int operator()(const uchar* _a, const uchar* _b, uchar* _dst, int width) const
+    {
+        const stype* a = (const stype*)_a;
+        const stype* b = (const stype*)_b;
+        stype* dst = (stype*)_dst;
+        VecUpdate updateOp;
+        int i = 0;
+        for( ; i <= width - 2*vtype::nlanes; i += 2*vtype::nlanes )
+        {
+            v_store(dst + i, updateOp(vx_load(a + i), vx_load(b + i)));
+            v_store(dst + i + vtype::nlanes, updateOp(vx_load(a + i + vtype::nlanes), vx_load(b + i + vtype::nlanes)));
+        }
+        for( ; i <= width - vtype::nlanes; i += vtype::nlanes )
+            v_store(dst + i, updateOp(vx_load(a + i), vx_load(b + i)));
+        return i;
+    }
+};
+
 template <typename T> struct VMin
 {
     typedef T vtype;
@@ -444,6 +473,15 @@ typedef MorphVec<VMax<v_int16> > DilateVec16s;
 typedef MorphVec<VMin<v_float32> > ErodeVec32f;
 typedef MorphVec<VMax<v_float32> > DilateVec32f;
 
+typedef MorphUpdateVec<VMin<v_uint8> > ErodeUpdateVec8u;
+typedef MorphUpdateVec<VMax<v_uint8> > DilateUpdateVec8u;
+typedef MorphUpdateVec<VMin<v_uint16> > ErodeUpdateVec16u;
+typedef MorphUpdateVec<VMax<v_uint16> > DilateUpdateVec16u;
+typedef MorphUpdateVec<VMin<v_int16> > ErodeUpdateVec16s;
+typedef MorphUpdateVec<VMax<v_int16> > DilateUpdateVec16s;
+typedef MorphUpdateVec<VMin<v_float32> > ErodeUpdateVec32f;
+typedef MorphUpdateVec<VMax<v_float32> > DilateUpdateVec32f;
+
 #else
 
 typedef MorphRowNoVec ErodeRowVec8u;
@@ -475,6 +513,15 @@ typedef MorphNoVec DilateVec16s;
 typedef MorphNoVec ErodeVec32f;
 typedef MorphNoVec DilateVec32f;
 
+typedef MorphUpdateNoVec ErodeUpdateVec8u;
+typedef MorphUpdateNoVec DilateUpdateVec8u;
+typedef MorphUpdateNoVec ErodeUpdateVec16u;
+typedef MorphUpdateNoVec DilateUpdateVec16u;
+typedef MorphUpdateNoVec ErodeUpdateVec16s;
+typedef MorphUpdateNoVec DilateUpdateVec16s;
+typedef MorphUpdateNoVec ErodeUpdateVec32f;
+typedef MorphUpdateNoVec DilateUpdateVec32f;
+
 #endif
 
 typedef MorphRowNoVec ErodeRowVec64f;
@@ -483,6 +530,8 @@ typedef MorphColumnNoVec ErodeColumnVec64f;
 typedef MorphColumnNoVec DilateColumnVec64f;
 typedef MorphNoVec ErodeVec64f;
 typedef MorphNoVec DilateVec64f;
+typedef MorphUpdateNoVec ErodeUpdateVec64f;
+typedef MorphUpdateNoVec DilateUpdateVec64f;
 
 
 template<class Op, class VecOp> struct MorphRowFilter : public BaseRowFilter
@@ -704,6 +753,122 @@ template<class Op, class VecOp> struct MorphFilter : BaseFilter
     VecOp vecOp;
 };
 
+
+// the columns are processed by the strips of this many bytes, so every row of a strip
+// is read sequentially
+#define CV_MORPH_VAN_HERK_STRIP 4096
+
+/*
+ * van Herk/Gil-Werman running min/max over the columns: dst(i, j) = op(src(i..i+ksize-1, j)).
+ * The rows are split into the blocks of ksize rows; h is the running extremum to the end of
+ * the block and g is the running extremum from the start of the next block, so every window
+ * is op(h(i), g(i+ksize-1)) and the cost doesn't depend on ksize. The range is the blocks
+ * of the destination rows.
+ */
+template<class Op, class VecOp> static void
+morphColumnsVanHerk_(const Mat& src, Mat& dst, int ksize, const Range& range)
+{
+    typedef typename Op::rtype T;
+    Op op;
+    VecOp vecOp;
+    int n = src.rows, m = dst.rows, width = dst.cols;
+    const int strip = CV_MORPH_VAN_HERK_STRIP/(int)sizeof(T);
+    CV_Assert( m == n - ksize + 1 && src.cols == width );
+
+    AutoBuffer<T> _buf((size_t)ksize*strip);
+    T* gbuf = _buf.data();
+    T* h = gbuf + (size_t)(ksize - 1)*strip;
+
+    for( int j0 = 0; j0 < width; j0 += strip )
+    {
+        int i, k, len = std::min(width - j0, strip);
+
+        for( int b = range.start; b < range.end; b++ )
+        {
+            int i0 = b*ksize, i1 = std::min(i0 + ksize, m);
+            // the rows of the next block covered by the windows of this one
+            int g0 = i0 + ksize, g1 = std::min(i1 + ksize - 1, n);
+            for( i = g0; i < g1; i++ )
+            {
+                const T* S = src.ptr<T>(i) + j0;
+                T* g = gbuf + (size_t)(i - g0)*strip;
+                if( i == g0 )
+                {
+                    memcpy(g, S, len*sizeof(T));
+                    continue;
+                }
+                const T* g1_ = g - strip;
+                k = vecOp((const uchar*)g1_, (const uchar*)S, (uchar*)g, len);
+                for( ; k < len; k++ )
+                    g[k] = op(g1_[k], S[k]);
+            }
+
+            int h1 = std::min(g0, n);
+            for( i = h1 - 1; i >= i0; i-- )
+            {
+                const T* S = src.ptr<T>(i) + j0;
+                if( i == h1 - 1 )
+                    memcpy(h, S, len*sizeof(T));
+                else
+                {
+                    k = vecOp((const uchar*)h, (const uchar*)S, (uchar*)h, len);
+                    for( ; k < len; k++ )
+                        h[k] = op(h[k], S[k]);
+                }
+                if( i >= i1 )
+                    continue;
+
+                T* D = dst.ptr<T>(i) + j0;
+                if( i + ksize - 1 < g0 )
+                    memcpy(D, h, len*sizeof(T));
+                else
+                {
+                    const T* g = gbuf + (size_t)(i + ksize - 1 - g0)*strip;
+                    k = vecOp((const uchar*)h, (const uchar*)g, (uchar*)D, len);
+                    for( ; k < len; k++ )
+                        D[k] = op(h[k], g[k]);
+                }
+            }
+        }
+    }
+}
+
+/*
+ * Running min/max over the rows of ksize pixels: after the pass with the shift p every element
+ * is the extremum of 2p pixels starting from it, so the window is op(S(j), S(j+ksize-p)) for
+ * the largest p <= ksize. It costs floor(log2(ksize)) + 1 comparisons per pixel, i.e. O(log ksize)
+ * rather than O(1) of van Herk/Gil-Werman, whose prefix/suffix scans along the rows don't vectorize.
+ * The rows stay in the cache for all the passes. The source rows are overwritten.
+ */
+template<class Op, class VecOp> static void
+morphRowsDoubling_(Mat& src, Mat& dst, int ksize, const Range& range)
+{
+    typedef typename Op::rtype T;
+    Op op;
+    VecOp vecOp;
+    int cn = src.channels(), len = src.cols*cn, width = dst.cols*cn;
+    CV_Assert( dst.cols == src.cols - ksize + 1 );
+
+    for( int i = range.start; i < range.end; i++ )
+    {
+        T* S = src.ptr<T>(i);
+        T* D = dst.ptr<T>(i);
+        int p = 1, n = len, k;
+        for( ; p*2 <= ksize; p *= 2 )
+        {
+            // the updated elements are only read at the larger offsets, so it works in place
+            n -= p*cn;
+            k = vecOp((const uchar*)S, (const uchar*)(S + p*cn), (uchar*)S, n);
+            for( ; k < n; k++ )
+                S[k] = op(S[k], S[k + p*cn]);
+        }
+        const T* S1 = S + (ksize - p)*cn;
+        k = vecOp((const uchar*)S, (const uchar*)S1, (uchar*)D, width);
+        for( ; k < width; k++ )
+            D[k] = op(S[k], S1[k]);
+    }
+}
+
 } // namespace anon
 
 /////////////////////////////////// External Interface /////////////////////////////////////
@@ -841,6 +1006,76 @@ Ptr<BaseFilter> getMorphologyFilter(int op, int type, const Mat& kernel, Point a
     CV_Error_( CV_StsNotImplemented, ("Unsupported data type (=%d)", type));
 }
 
+void morphColumnsVanHerk(int op, int depth, const Mat& src, Mat& dst, int ksize, const Range& range)
+{
+    CV_INSTRUMENT_REGION();
+
+    CV_Assert( op == MORPH_ERODE || op == MORPH_DILATE );
+    if( op == MORPH_ERODE )
+    {
+        if( depth == CV_8U )
+            return morphColumnsVanHerk_<MinOp<uchar>, ErodeUpdateVec8u>(src, dst, ksize, range);
+        if( depth == CV_16U )
+            return morphColumnsVanHerk_<MinOp<ushort>, ErodeUpdateVec16u>(src, dst, ksize, range);
+        if( depth == CV_16S )
+            return morphColumnsVanHerk_<MinOp<short>, ErodeUpdateVec16s>(src, dst, ksize, range);
+        if( depth == CV_32F )
+            return morphColumnsVanHerk_<MinOp<float>, ErodeUpdateVec32f>(src, dst, ksize, range);
+        if( depth == CV_64F )
+            return morphColumnsVanHerk_<MinOp<double>, ErodeUpdateVec64f>(src, dst, ksize, range);
+    }
+    else
+    {
+        if( depth == CV_8U )
+            return morphColumnsVanHerk_<MaxOp<uchar>, DilateUpdateVec8u>(src, dst, ksize, range);
+        if( depth == CV_16U )
+            return morphColumnsVanHerk_<MaxOp<ushort>, DilateUpdateVec16u>(src, dst, ksize, range);
+        if( depth == CV_16S )
+            return morphColumnsVanHerk_<MaxOp<short>, DilateUpdateVec16s>(src, dst, ksize, range);
+        if( depth == CV_32F )
+            return morphColumnsVanHerk_<MaxOp<float>, DilateUpdateVec32f>(src, dst, ksize, range);
+        if( depth == CV_64F )
+            return morphColumnsVanHerk_<MaxOp<double>, DilateUpdateVec64f>(src, dst, ksize, range);
+    }
+
+    CV_Error_( CV_StsNotImplemented, ("Unsupported data type (=%d)", depth));
+}
+
+void morphRowsDoubling(int op, int depth, Mat& src, Mat& dst, int ksize, const Range& range)
+{
+    CV_INSTRUMENT_REGION();
+
+    CV_Assert( op == MORPH_ERODE || op == MORPH_DILATE );
+    if( op == MORPH_ERODE )
+    {
+        if( depth == CV_8U )
+            return morphRowsDoubling_<MinOp<uchar>, ErodeUpdateVec8u>(src, dst, ksize, range);
+        if( depth == CV_16U )
+            return morphRowsDoubling_<MinOp<ushort>, ErodeUpdateVec16u>(src, dst, ksize, range);
+        if( depth == CV_16S )
+            return morphRowsDoubling_<MinOp<short>, ErodeUpdateVec16s>(src, dst, ksize, range);
+        if( depth == CV_32F )
+            return morphRowsDoubling_<MinOp<float>, ErodeUpdateVec32f>(src, dst, ksize, range);
+        if( depth == CV_64F )
+            return morphRowsDoubling_<MinOp<double>, ErodeUpdateVec64f>(src, dst, ksize, range);
+    }
+    else
+    {
+        if( depth == CV_8U )
+            return morphRowsDoubling_<MaxOp<uchar>, DilateUpdateVec8u>(src, dst, ksize, range);
+        if( depth == CV_16U )
+            return morphRowsDoubling_<MaxOp<ushort>, DilateUpdateVec16u>(src, dst, ksize, range);
+        if( depth == CV_16S )
+            return morphRowsDoubling_<MaxOp<short>, DilateUpdateVec16s>(src, dst, ksize, range);
+        if( depth == CV_32F )
+            return morphRowsDoubling_<MaxOp<float>, DilateUpdateVec32f>(src, dst, ksize, range);
+        if( depth == CV_64F )
+            return morphRowsDoubling_<MaxOp<double>, DilateUpdateVec64f>(src, dst, ksize, range);
+    }
+
+    CV_Error_( CV_StsNotImplemented, ("Unsupported data type (=%d)", depth));
+}
+
 #endif
 CV_CPU_OPTIMIZATION_NAMESPACE_END
 } // namespace
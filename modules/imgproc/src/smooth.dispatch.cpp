@@ -635,13 +635,25 @@ void GaussianBlur(InputArray _src, OutputArray _dst, Size ksize,
         return;
     }
 
+    int sdepth = CV_MAT_DEPTH(type), cn = CV_MAT_CN(type);
+
+    // the cost of the recursive filter doesn't depend on sigma, for the large sigma it is
+    // faster than the exact kernels by orders of magnitude
+    static size_t param_gaussian_blur_recursive_min_sigma = utils::getConfigurationParameterSizeT("OPENCV_GAUSSIANBLUR_RECURSIVE_MIN_SIGMA", 20);
+    if( ksize.width <= 0 && ksize.height <= 0 && param_gaussian_blur_recursive_min_sigma > 0 &&
+        std::min(sigma1, sigma2 > 0 ? sigma2 : sigma1) >= (double)param_gaussian_blur_recursive_min_sigma &&
+        _src.dims() <= 2 && cn <= 4 && sdepth != CV_8S && sdepth != CV_32S && sdepth != CV_16F )
+    {
+        CV_LOG_INFO(NULL, "GaussianBlur: running recursive version: sigma=" << Size2d(sigma1, sigma2));
+        recursiveGaussianBlur(_src, _dst, sigma1, sigma2, borderType);
+        return;
+    }
+
     bool useOpenCL = ocl::isOpenCLActivated() && _dst.isUMat() && _src.dims() <= 2 &&
                _src.rows() >= ksize.height && _src.cols() >= ksize.width &&
                ksize.width > 1 && ksize.height > 1;
     CV_UNUSED(useOpenCL);
 
-    int sdepth = CV_MAT_DEPTH(type), cn = CV_MAT_CN(type);
-
     Mat kx, ky;
     createGaussianKernels(kx, ky, type, ksize, sigma1, sigma2);
 
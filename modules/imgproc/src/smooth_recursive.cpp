@@ -0,0 +1,157 @@
+// This file is part of OpenCV project.
+// It is subject to the license terms in the LICENSE file found in the top-level directory
+// of this distribution and at http://opencv.org/license.html.
+
+#include "precomp.hpp"
+#include "opencv2/core/hal/intrin.hpp"
+
+/*
+ * Recursive approximation of the Gaussian filter, see
+ *   I.T. Young, L.J. van Vliet, "Recursive implementation of the Gaussian filter",
+ *   Signal Processing 44 (1995) 139-151.
+ *
+ * Every direction is filtered by the causal 3rd order filter
+ *   w[i] = B*x[i] + a1*w[i-1] + a2*w[i-2] + a3*w[i-3]
+ * followed by the same anti-causal filter, so the cost per pixel doesn't depend on sigma.
+ */
+
+namespace cv {
+
+// columns of the buffer processed by one task of the vertical pass
+#define CV_RECURSIVE_GAUSSIAN_COL_BLOCK 128
+// rows of the image processed by one task of the horizontal pass
+#define CV_RECURSIVE_GAUSSIAN_ROW_BLOCK 16
+
+static void getRecursiveGaussianCoeffs(double sigma, double* c)
+{
+    double q = sigma >= 2.5 ? 0.98711*sigma - 0.96330 : 3.97156 - 4.14554*std::sqrt(1 - 0.26891*sigma);
+    double q2 = q*q, q3 = q2*q;
+    double b0 = 1.57825 + 2.44413*q + 1.4281*q2 + 0.422205*q3;
+    c[1] = (2.44413*q + 2.85619*q2 + 1.26661*q3)/b0;
+    c[2] = -(1.4281*q2 + 1.26661*q3)/b0;
+    c[3] = 0.422205*q3/b0;
+    c[0] = 1 - (c[1] + c[2] + c[3]);
+}
+
+// y = c0*x + c1*y1 + c2*y2 + c3*y3, y may be the same as x
+static inline void recursiveRow(float* y, const float* x, const float* y1, const float* y2,
+                                const float* y3, const float* c, int n)
+{
+    int j = 0;
+#if CV_SIMD
+    v_float32 c0 = vx_setall_f32(c[0]), c1 = vx_setall_f32(c[1]);
+    v_float32 c2 = vx_setall_f32(c[2]), c3 = vx_setall_f32(c[3]);
+    for( ; j <= n - v_float32::nlanes; j += v_float32::nlanes )
+        v_store(y + j, v_fma(c0, vx_load(x + j), v_fma(c1, vx_load(y1 + j),
+                       v_fma(c2, vx_load(y2 + j), c3*vx_load(y3 + j)))));
+#endif
+    for( ; j < n; j++ )
+        y[j] = c[0]*x[j] + c[1]*y1[j] + c[2]*y2[j] + c[3]*y3[j];
+}
+
+static inline void recursiveRow(double* y, const double* x, const double* y1, const double* y2,
+                                const double* y3, const double* c, int n)
+{
+    int j = 0;
+#if CV_SIMD_64F
+    v_float64 c0 = vx_setall_f64(c[0]), c1 = vx_setall_f64(c[1]);
+    v_float64 c2 = vx_setall_f64(c[2]), c3 = vx_setall_f64(c[3]);
+    for( ; j <= n - v_float64::nlanes; j += v_float64::nlanes )
+        v_store(y + j, v_fma(c0, vx_load(x + j), v_fma(c1, vx_load(y1 + j),
+                       v_fma(c2, vx_load(y2 + j), c3*vx_load(y3 + j)))));
+#endif
+    for( ; j < n; j++ )
+        y[j] = c[0]*x[j] + c[1]*y1[j] + c[2]*y2[j] + c[3]*y3[j];
+}
+
+// Filters the columns [j0, j1) of the single-channel buffer in place. The signal is extended
+// by its first (last) sample, which is the steady state of the filter, so the first (last) row
+// stays unchanged.
+template<typename WT> static void
+recursiveGaussianCols(Mat& buf, int j0, int j1, const WT* c)
+{
+    int n = buf.rows, len = j1 - j0;
+    for( int i = 1; i < n; i++ )
+        recursiveRow(buf.ptr<WT>(i) + j0, buf.ptr<WT>(i) + j0, buf.ptr<WT>(i-1) + j0,
+                     buf.ptr<WT>(std::max(i-2, 0)) + j0, buf.ptr<WT>(std::max(i-3, 0)) + j0, c, len);
+    for( int i = n - 2; i >= 0; i-- )
+        recursiveRow(buf.ptr<WT>(i) + j0, buf.ptr<WT>(i) + j0, buf.ptr<WT>(i+1) + j0,
+                     buf.ptr<WT>(std::min(i+2, n-1)) + j0, buf.ptr<WT>(std::min(i+3, n-1)) + j0, c, len);
+}
+
+template<typename WT> static void
+recursiveGaussianBlur_(const Mat& src, Mat& dst, double sigmaX, double sigmaY, int borderType)
+{
+    int wtype = CV_MAKETYPE(DataType<WT>::depth, src.channels());
+    // the padding covers the support of the exact kernels, see createGaussianKernels()
+    int px = cvCeil(sigmaX*4) + 3, py = cvCeil(sigmaY*4) + 3;
+    double cx[4], cy[4];
+    getRecursiveGaussianCoeffs(sigmaX, cx);
+    getRecursiveGaussianCoeffs(sigmaY, cy);
+
+    // the gain of the rounded coefficients is restored, for the large sigma the float rounding
+    // of 1 - (a1 + a2 + a3) alone gives the visible bias of the output
+    WT wcx[4], wcy[4];
+    for( int k = 1; k < 4; k++ )
+    {
+        wcx[k] = (WT)cx[k];
+        wcy[k] = (WT)cy[k];
+    }
+    wcx[0] = (WT)(1 - ((double)wcx[1] + (double)wcx[2] + (double)wcx[3]));
+    wcy[0] = (WT)(1 - ((double)wcy[1] + (double)wcy[2] + (double)wcy[3]));
+
+    Mat buf;
+    copyMakeBorder(src, buf, py, py, px, px, borderType);
+    buf.convertTo(buf, wtype);
+
+    // vertical pass: all the columns are processed at once, the rows are independent
+    Mat buf1 = buf.reshape(1);
+    int ncols = buf1.cols, nblocks = (ncols + CV_RECURSIVE_GAUSSIAN_COL_BLOCK - 1)/CV_RECURSIVE_GAUSSIAN_COL_BLOCK;
+    parallel_for_(Range(0, nblocks), [&](const Range& r)
+    {
+        int j0 = r.start*CV_RECURSIVE_GAUSSIAN_COL_BLOCK;
+        int j1 = std::min(r.end*CV_RECURSIVE_GAUSSIAN_COL_BLOCK, ncols);
+        recursiveGaussianCols<WT>(buf1, j0, j1, wcy);
+    });
+
+    // horizontal pass: the bands of rows are transposed, filtered as columns and transposed back
+    int rows = src.rows, cols = src.cols;
+    nblocks = (rows + CV_RECURSIVE_GAUSSIAN_ROW_BLOCK - 1)/CV_RECURSIVE_GAUSSIAN_ROW_BLOCK;
+    parallel_for_(Range(0, nblocks), [&](const Range& r)
+    {
+        Mat band, filtered;
+        for( int b = r.start; b < r.end; b++ )
+        {
+            int i0 = b*CV_RECURSIVE_GAUSSIAN_ROW_BLOCK, i1 = std::min(i0 + CV_RECURSIVE_GAUSSIAN_ROW_BLOCK, rows);
+            transpose(buf.rowRange(py + i0, py + i1), band);
+            Mat band1 = band.reshape(1);
+            recursiveGaussianCols<WT>(band1, 0, band1.cols, wcx);
+            transpose(band.rowRange(px, px + cols), filtered);
+            filtered.convertTo(dst.rowRange(i0, i1), dst.type());
+        }
+    });
+}
+
+void recursiveGaussianBlur(InputArray _src, OutputArray _dst, double sigmaX, double sigmaY, int borderType)
+{
+    CV_INSTRUMENT_REGION();
+
+    CV_Assert( !_src.empty() && _src.dims() <= 2 );
+    int type = _src.type(), depth = CV_MAT_DEPTH(type), cn = CV_MAT_CN(type);
+    CV_Assert( (depth == CV_8U || depth == CV_16U || depth == CV_16S || depth == CV_32F || depth == CV_64F) && cn <= 4 );
+    if( sigmaY <= 0 )
+        sigmaY = sigmaX;
+    CV_Assert( sigmaX > 0 && sigmaY > 0 );
+
+    // the source is copied to the padded buffer first, so the operation can be in-place
+    Mat src = _src.getMat();
+    _dst.create(src.size(), type);
+    Mat dst = _dst.getMat();
+
+    if( depth == CV_64F )
+        recursiveGaussianBlur_<double>(src, dst, sigmaX, sigmaY, borderType);
+    else
+        recursiveGaussianBlur_<float>(src, dst, sigmaX, sigmaY, borderType);
+}
+
+} // namespace cv
@@ -485,6 +485,51 @@ TEST(Imgproc_FindContours, border)
     ASSERT_EQ(0, cvtest::norm(img, img_draw_contours, NORM_INF));
 }
 
+TEST(Imgproc_FindContours, parallel_bands)
+{
+    // the large images are scanned by several threads, the contours and the hierarchy
+    // must be the same as found by the serial raster scan
+    RNG& rng = theRNG();
+    Mat blobs = Mat::zeros(1000, 1200, CV_8U), noise(blobs.size(), CV_8U);
+    // few enough contours for RETR_TREE, which many contours keep in the serial scan
+    for (int i = 0; i < 40; i++)
+    {
+        Point center(rng.uniform(0, blobs.cols), rng.uniform(0, blobs.rows));
+        Size axes(rng.uniform(2, 200), rng.uniform(2, 200));
+        // the nested rings make the holes with the components inside
+        ellipse(blobs, center, axes, rng.uniform(0, 180), 0, 360, Scalar::all(i % 2 ? 0 : 255), -1);
+    }
+    // the noise in the narrow strip crosses all the seams of the bands, but keeps the serial scan short
+    Mat strip = noise.colRange(500, 560);
+    noise = Scalar::all(0);
+    rng.fill(strip, RNG::UNIFORM, 0, 256);
+    Mat images[] = { blobs, blobs ^ (noise > 250), noise > 128 };
+
+    for (int k = 0; k < 3; k++)
+    {
+        for (int mode = RETR_EXTERNAL; mode <= RETR_TREE; mode++)
+        {
+            for (int method = CHAIN_APPROX_NONE; method <= CHAIN_APPROX_SIMPLE; method++)
+            {
+                SCOPED_TRACE(cv::format("image=%d mode=%d method=%d", k, mode, method));
+                std::vector<std::vector<Point> > contours[2];
+                std::vector<Vec4i> hierarchy[2];
+                const int nthreads[] = { 1, 4 };
+                for (int t = 0; t < 2; t++)
+                {
+                    ThreadsScope threads(nthreads[t]);
+                    cv::findContours(images[k], contours[t], hierarchy[t], mode, method, Point(3, -2));
+                }
+
+                ASSERT_EQ(contours[0].size(), contours[1].size());
+                for (size_t i = 0; i < contours[0].size(); i++)
+                    ASSERT_EQ(contours[0][i], contours[1][i]) << i;
+                ASSERT_EQ(hierarchy[0], hierarchy[1]);
+            }
+        }
+    }
+}
+
 TEST(Imgproc_PointPolygonTest, regression_10222)
 {
     vector<Point> contour;
@@ -2021,6 +2021,35 @@ TEST(Imgproc_GaussianBlur, borderTypes)
     EXPECT_EQ(27, dst.at<uchar>(0, 0));
 }
 
+TEST(Imgproc_GaussianBlur, recursive)
+{
+    RNG& rng = theRNG();
+    const int types[] = { CV_8UC1, CV_16UC3, CV_16SC1, CV_32FC1, CV_32FC4, CV_64FC1 };
+    for( size_t i = 0; i < sizeof(types)/sizeof(types[0]); i++ )
+    {
+        int type = types[i], depth = CV_MAT_DEPTH(type);
+        double sigmaX = 20, sigmaY = 30;
+        SCOPED_TRACE(cv::format("type=%d", type));
+
+        Mat src(240, 320, type), exact, dst;
+        cvtest::randUni(rng, src, Scalar::all(0), Scalar::all(depth == CV_16S ? 100 : 255));
+        cv::GaussianBlur(src, src, Size(7, 7), 0);
+        // the explicit kernel size disables the recursive filter
+        int kx = cvRound(sigmaX*(depth == CV_8U ? 3 : 4)*2 + 1)|1, ky = cvRound(sigmaY*(depth == CV_8U ? 3 : 4)*2 + 1)|1;
+        cv::GaussianBlur(src, exact, Size(kx, ky), sigmaX, sigmaY);
+
+        cv::recursiveGaussianBlur(src, dst, sigmaX, sigmaY);
+        EXPECT_LE(cvtest::norm(exact, dst, NORM_INF), depth <= CV_16S ? 1 : 0.5);
+
+        Mat dst2;
+        cv::GaussianBlur(src, dst2, Size(), sigmaX, sigmaY);
+        EXPECT_EQ(0, cvtest::norm(dst, dst2, NORM_INF));
+
+        cv::recursiveGaussianBlur(src, src, sigmaX, sigmaY);
+        EXPECT_EQ(0, cvtest::norm(dst, src, NORM_INF));
+    }
+}
+
 TEST(Imgproc_Morphology, iterated)
 {
     RNG& rng = theRNG();
@@ -2055,6 +2084,44 @@ TEST(Imgproc_Morphology, iterated)
     }
 }
 
+TEST(Imgproc_Morphology, large_rect_kernel)
+{
+    RNG& rng = theRNG();
+    const int types[] = { CV_8UC1, CV_8UC3, CV_16UC1, CV_16SC4, CV_32FC1, CV_64FC2 };
+    const int borders[] = { BORDER_CONSTANT, BORDER_REPLICATE, BORDER_REFLECT_101, BORDER_CONSTANT|BORDER_ISOLATED };
+    for( int iter = 0; iter < 40; iter++ )
+    {
+        int type = types[iter % 6], borderType = borders[iter % 4];
+        Size ksize(rng.uniform(15, 50), rng.uniform(1, 50));
+        if( iter % 2 )
+            std::swap(ksize.width, ksize.height);
+        Point anchor(rng.uniform(-1, ksize.width), rng.uniform(-1, ksize.height));
+        Scalar borderValue = iter % 3 == 0 ? Scalar::all(50) : morphologyDefaultBorderValue();
+        SCOPED_TRACE(cv::format("type=%d ksize=%dx%d border=%d", type, ksize.width, ksize.height, borderType));
+
+        Mat whole(rng.uniform(20, 200), rng.uniform(20, 200), type);
+        cvtest::randUni(rng, whole, Scalar::all(0), Scalar::all(200));
+        Rect roi(rng.uniform(0, 10), rng.uniform(0, 10), 0, 0);
+        roi.width = rng.uniform(1, whole.cols - roi.x);
+        roi.height = rng.uniform(1, whole.rows - roi.y);
+        Mat src = whole(roi);
+
+        // the zero column makes the structuring element non-rectangular and
+        // disables the van Herk path without changing the result
+        Mat kernel = getStructuringElement(MORPH_RECT, ksize), kernel0 = Mat::zeros(ksize.height, ksize.width + 1, CV_8U);
+        kernel.copyTo(kernel0.colRange(0, ksize.width));
+        Point anchor0 = anchor.x < 0 ? Point(ksize.width/2, anchor.y) : anchor;
+
+        for( int op = MORPH_ERODE; op <= MORPH_DILATE; op++ )
+        {
+            Mat dst, ref;
+            cv::morphologyEx(src, dst, op, kernel, anchor, 1, borderType, borderValue);
+            cv::morphologyEx(src, ref, op, kernel0, anchor0, 1, borderType, borderValue);
+            EXPECT_EQ(0, cvtest::norm(dst, ref, NORM_INF));
+        }
+    }
+}
+
 TEST(Imgproc_Sobel, borderTypes)
 {
     int kernelSize = 3;
@@ -2356,4 +2423,88 @@ TEST(Imgproc, filter_empty_src_16857)
 }
 
 
+TEST(Imgproc_Filter, parallel_bands)
+{
+    // the large images are filtered by the horizontal bands in parallel. The bands depend on the image size
+    // and the kernel only, so the results must not depend on the number of threads. The narrow strips
+    // across the band boundaries are filtered serially, they read the same rows around them.
+    RNG& rng = theRNG();
+    Mat a0(1100, 1300, CV_8UC3), f0(1100, 1300, CV_32FC1);
+    rng.fill(a0, RNG::UNIFORM, 0, 256);
+    rng.fill(f0, RNG::UNIFORM, -1, 1);
+    Mat kernel2D(5, 5, CV_32F), kx(1, 7, CV_32F), ky(1, 5, CV_32F);
+    rng.fill(kernel2D, RNG::UNIFORM, -1, 1);
+    rng.fill(kx, RNG::UNIFORM, -1, 1);
+    rng.fill(ky, RNG::UNIFORM, -1, 1);
+    Mat se = getStructuringElement(MORPH_ELLIPSE, Size(7, 5));
+
+    struct Filter
+    {
+        const char* name;
+        bool floatSums;  // the running sums of the floating-point box filters start anew in each band
+        std::function<void(const Mat& a, const Mat& f, Mat& d)> apply;
+    };
+    const Filter filters[] = {
+        { "filter2D", false, [&](const Mat& a, const Mat&, Mat& d) { cv::filter2D(a, d, CV_16S, kernel2D); } },
+        { "sepFilter2D", false, [&](const Mat&, const Mat& f, Mat& d)
+            { cv::sepFilter2D(f, d, -1, kx, ky, Point(-1, -1), 0, BORDER_REFLECT); } },
+        { "boxFilter", false, [&](const Mat& a, const Mat&, Mat& d) { cv::boxFilter(a, d, -1, Size(9, 9)); } },
+        { "sqrBoxFilter", true, [&](const Mat&, const Mat& f, Mat& d) { cv::sqrBoxFilter(f, d, -1, Size(5, 5)); } },
+        { "GaussianBlur", false, [&](const Mat&, const Mat& f, Mat& d) { cv::GaussianBlur(f, d, Size(11, 11), 2.0); } },
+        { "erode", false, [&](const Mat& a, const Mat&, Mat& d) { cv::erode(a, d, se); } },
+        { "dilate", false, [&](const Mat& a, const Mat&, Mat& d)
+            { cv::dilate(a, d, se, Point(-1, -1), 1, BORDER_REPLICATE); } },
+    };
+    const int nfilters = (int)(sizeof(filters)/sizeof(filters[0]));
+
+    for (int roi = 0; roi < 2; roi++)
+    {
+        SCOPED_TRACE(roi ? "ROI" : "whole image");
+        Rect r = roi ? Rect(5, 7, 1280, 1080) : Rect(0, 0, a0.cols, a0.rows);
+        Mat a = a0(r), f = f0(r);
+
+        std::vector<Mat> results[2];
+        const int nthreads[] = { 1, 4 };
+        for (int t = 0; t < 2; t++)
+        {
+            ThreadsScope threads(nthreads[t]);
+            std::vector<Mat>& res = results[t];
+            Mat d;
+            for (int i = 0; i < nfilters; i++)
+            {
+                filters[i].apply(a, f, d);
+                res.push_back(d.clone());
+            }
+            // the iterations read the rows outside of the strips below
+            cv::erode(a, d, se, Point(-1, -1), 2);
+            res.push_back(d.clone());
+            // in-place, the bands read the rows written by the other bands
+            d = a0.clone();
+            Mat droi = d(r);
+            cv::dilate(droi, droi, Mat()); res.push_back(d);
+            d = f0.clone();
+            droi = d(r);
+            cv::GaussianBlur(droi, droi, Size(5, 5), 1.0); res.push_back(d);
+        }
+
+        ASSERT_EQ(results[0].size(), results[1].size());
+        for (size_t i = 0; i < results[0].size(); i++)
+            EXPECT_EQ(0, cvtest::norm(results[0][i], results[1][i], NORM_INF)) << i;
+
+        // the strip is too small to be split, it crosses the boundary of the bands at about 2/11 of the image
+        const Range strip(130, 270);
+        for (int i = 0; i < nfilters; i++)
+        {
+            SCOPED_TRACE(filters[i].name);
+            Mat d;
+            filters[i].apply(a.rowRange(strip), f.rowRange(strip), d);
+            double err = cvtest::norm(d, results[0][i].rowRange(strip), NORM_INF);
+            if (filters[i].floatSums)
+                EXPECT_LE(err, 1e-5);
+            else
+                EXPECT_EQ(0, err);
+        }
+    }
+}
+
 }} // namespace
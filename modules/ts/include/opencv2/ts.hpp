@@ -740,6 +740,17 @@ struct DefaultRngAuto
     DefaultRngAuto& operator=(const DefaultRngAuto&);
 };
 
+//! sets the number of threads used by OpenCV, the previous number is restored on the scope exit
+struct ThreadsScope
+{
+    const int old_threads;
+
+    explicit ThreadsScope(int threads) : old_threads(cv::getNumThreads()) { if (threads > 0) cv::setNumThreads(threads); }
+    ~ThreadsScope() { cv::setNumThreads(old_threads); }
+
+    ThreadsScope& operator=(const ThreadsScope&);
+};
+
 
 // test images generation functions
 void fillGradient(Mat& img, int delta = 5);
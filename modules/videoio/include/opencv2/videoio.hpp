@@ -182,6 +182,10 @@ enum VideoCaptureProperties {
        CAP_PROP_BITRATE       =47, //!< (read-only) Video bitrate in kbits/s
        CAP_PROP_ORIENTATION_META=48, //!< (read-only) Frame rotation defined by stream meta (applicable for FFmpeg back-end only)
        CAP_PROP_ORIENTATION_AUTO=49, //!< if true - rotates output frames of CvCapture considering video file's metadata  (applicable for FFmpeg back-end only) (https://github.com/opencv/opencv/issues/15499)
+       CAP_PROP_PREFETCH_FRAMES=50, //!< Number of frames decoded ahead by a background thread. 0 (default) disables prefetching. The frames are always retrieved from the channel 0.
+       CAP_PROP_PREFETCH_DROP=51, //!< if true - the oldest prefetched frame is dropped when the prefetch queue is full (live sources), otherwise decoding is paused (default)
+       CAP_PROP_PREFETCH_QUEUE_DEPTH=52, //!< (read-only) Number of prefetched frames waiting in the queue
+       CAP_PROP_PREFETCH_DROPPED_FRAMES=53, //!< (read-only) Number of frames dropped by the prefetch queue, see CAP_PROP_PREFETCH_DROP
 #ifndef CV_DOXYGEN
        CV__CAP_PROP_LATEST
 #endif
@@ -196,7 +200,9 @@ enum VideoWriterProperties {
   VIDEOWRITER_PROP_NSTRIPES = 3,   //!< Number of stripes for parallel encoding. -1 for auto detection.
   VIDEOWRITER_PROP_IS_COLOR = 4,   //!< If it is not zero, the encoder will expect and encode color frames, otherwise it
                                    //!< will work with grayscale frames.
-  VIDEOWRITER_PROP_DEPTH = 5       //!< Defaults to CV_8U.
+  VIDEOWRITER_PROP_DEPTH = 5,      //!< Defaults to CV_8U.
+  VIDEOWRITER_PROP_FRAME_THREADS = 6 //!< Number of frames encoded concurrently by background threads (built-in MJPEG writer only).
+                                     //!< 0 or 1 (default) - frames are encoded by the calling thread, -1 - use cv::getNumThreads().
 };
 
 //! @} videoio_flags_base
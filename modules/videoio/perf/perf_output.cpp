@@ -44,4 +44,35 @@ PERF_TEST_P(VideoWriter_Writing, WriteFrame,
   remove(outfile.c_str());
 }
 
+typedef perf::TestBaseWithParam<int> VideoWriter_MJPEG_FrameThreads;
+
+PERF_TEST_P(VideoWriter_MJPEG_FrameThreads, WriteFrame, testing::Values(0, 2, 4, 8))
+{
+  const int frameThreads = GetParam();
+  const Size size(1280, 720);
+  // gradients with some noise, closer to the natural images than the pure noise
+  Mat image(size, CV_8UC3), noise(size, CV_8UC3);
+  for (int y = 0; y < size.height; y++)
+      for (int x = 0; x < size.width; x++)
+          image.at<Vec3b>(y, x) = Vec3b((uchar)(x / 5), (uchar)(y / 3), (uchar)((x + y) / 8));
+  randu(noise, Scalar::all(0), Scalar::all(32));
+  image += noise;
+
+  const string outfile = cv::tempfile(".avi");
+  VideoWriter writer(outfile, CAP_OPENCV_MJPEG, VideoWriter::fourcc('M', 'J', 'P', 'G'), 25, size,
+                     { VIDEOWRITER_PROP_FRAME_THREADS, frameThreads });
+  if (!writer.isOpened())
+      throw SkipTestException("Video file can not be opened");
+
+  const int frames = 32;
+  TEST_CYCLE()
+  {
+      for (int i = 0; i < frames; i++)
+          writer << image;
+  }
+  writer.release();
+  SANITY_CHECK_NOTHING();
+  remove(outfile.c_str());
+}
+
 } // namespace
@@ -385,7 +385,16 @@ VideoCapture& VideoCapture::operator >> (UMat& image)
 bool VideoCapture::set(int propId, double value)
 {
     CV_CheckNE(propId, (int)CAP_PROP_BACKEND, "Can't set read-only property");
-    bool ret = !icap.empty() ? icap->setProperty(propId, value) : false;
+    bool ret = false;
+    if (propId == CAP_PROP_PREFETCH_FRAMES)
+    {
+        if (isOpened())
+            ret = setupPrefetchCapture(icap, cvRound(value));
+    }
+    else
+    {
+        ret = !icap.empty() ? icap->setProperty(propId, value) : false;
+    }
     if (!ret && throwOnFail)
     {
         CV_Error_(Error::StsError, ("could not set prop %d = %f", propId, value));
@@ -329,6 +329,9 @@ Ptr<IVideoCapture> createXINECapture(const std::string &filename);
 
 Ptr<IVideoCapture> createAndroidCapture_file(const std::string &filename);
 
+//! Wraps the capture to decode frames ahead by a background thread (frames > 0) or unwraps it (see CAP_PROP_PREFETCH_FRAMES)
+bool setupPrefetchCapture(Ptr<IVideoCapture>& capture, int frames);
+
 bool VideoCapture_V4L_waitAny(
         const std::vector<VideoCapture>& streams,
         CV_OUT std::vector<int>& ready,
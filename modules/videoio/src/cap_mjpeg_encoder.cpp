@@ -46,6 +46,9 @@
 #include <deque>
 #include <iostream>
 #include <cstdlib>
+#include <condition_variable>
+#include <mutex>
+#include <thread>
 
 #if CV_NEON
 #define WITH_NEON
@@ -385,6 +388,55 @@ private:
     int m_last_bit_len;
 };
 
+// In-memory JPEG stream with the same interface as AVIWriteContainer,
+// used to encode frames concurrently and write them into the container later
+class mjpeg_frame_stream
+{
+public:
+    void jputStreamShort(int val)
+    {
+        data.push_back((uchar)(val >> 8));
+        data.push_back((uchar)val);
+    }
+
+    void putStreamBytes(const uchar* buf, int count)
+    {
+        data.insert(data.end(), buf, buf + count);
+    }
+
+    void putStreamByte(int val)
+    {
+        data.push_back((uchar)val);
+    }
+
+    void jputStream(unsigned currval)
+    {
+        for (int shift = 24; shift >= 0; shift -= 8)
+        {
+            uchar v = (uchar)(currval >> shift);
+            data.push_back(v);
+            if( v == 255 )
+                data.push_back(0);
+        }
+    }
+
+    void jflushStream(unsigned currval, int bitIdx)
+    {
+        currval |= (1 << bitIdx)-1;
+        while( bitIdx < 32 )
+        {
+            uchar v = (uchar)(currval >> 24);
+            data.push_back(v);
+            if( v == 255 )
+                data.push_back(0);
+            currval <<= 8;
+            bitIdx += 8;
+        }
+    }
+
+    std::vector<uchar> data;
+};
+
 class MotionJpegWriter : public IVideoWriter
 {
 public:
@@ -393,15 +445,26 @@ public:
         rawstream = false;
         nstripes = -1;
         quality = 0;
+        frameThreads = 0;
+        nextJob = 0;
+        stopping = false;
     }
 
-    MotionJpegWriter(const String& filename, double fps, Size size, bool iscolor)
+    MotionJpegWriter(const String& filename, double fps, Size size, bool iscolor, int frame_threads = 0)
     {
         rawstream = false;
+        frameThreads = 0;
+        nextJob = 0;
+        stopping = false;
         open(filename, fps, size, iscolor);
         nstripes = -1;
+        setFrameThreads(frame_threads);
+    }
+    ~MotionJpegWriter()
+    {
+        close();
+        stopWorkers();
     }
-    ~MotionJpegWriter() { close(); }
 
     virtual int getCaptureDomain() const CV_OVERRIDE { return cv::CAP_OPENCV_MJPEG; }
 
@@ -410,6 +473,16 @@ public:
         if( !container.isOpenedStream() )
             return;
 
+        try
+        {
+            writeEncodedFrames(0);
+        }
+        catch (const std::exception& e)
+        {
+            // called from the destructor, so the error can't be thrown
+            CV_LOG_ERROR(NULL, "MJPEG: can't encode frame: " << e.what());
+        }
+
         if( !container.isEmptyFrameOffset() && !rawstream )
         {
             container.endWriteChunk(); // end LIST 'movi'
@@ -451,7 +524,6 @@ public:
     void write(InputArray _img) CV_OVERRIDE
     {
         Mat img = _img.getMat();
-        size_t chunkPointer = container.getStreamPos();
         int input_channels = img.channels();
         int colorspace = -1;
         int imgWidth = img.cols;
@@ -484,21 +556,17 @@ public:
         else
             CV_Error(CV_StsBadArg, "Invalid combination of specified video colorspace and the input image colorspace");
 
-        if( !rawstream ) {
-            int avi_index = container.getAVIIndex(0, dc);
-            container.startWriteChunk(avi_index);
+        if( !workers.empty() )
+        {
+            submitFrame(img, colorspace);
+            // keep the encoding threads busy, but limit the number of buffered frames
+            writeEncodedFrames(2*workers.size());
+            return;
         }
 
+        size_t chunkPointer = startFrameChunk();
         writeFrameData(img.data, (int)img.step, colorspace, input_channels);
-
-        if( !rawstream )
-        {
-            size_t tempChunkPointer = container.getStreamPos();
-            size_t moviPointer = container.getMoviPointer();
-            container.pushFrameOffset(chunkPointer - moviPointer);
-            container.pushFrameSize(tempChunkPointer - chunkPointer - 8);       // Size excludes '00dc' and size field
-            container.endWriteChunk(); // end '00dc'
-        }
+        endFrameChunk(chunkPointer);
     }
 
     double getProperty(int propId) const CV_OVERRIDE
@@ -512,6 +580,8 @@ public:
         }
         if( propId == VIDEOWRITER_PROP_NSTRIPES )
             return nstripes;
+        if( propId == VIDEOWRITER_PROP_FRAME_THREADS )
+            return (double)workers.size();
         return 0.;
     }
 
@@ -529,18 +599,58 @@ public:
             return true;
         }
 
+        if( propId == VIDEOWRITER_PROP_FRAME_THREADS )
+        {
+            writeEncodedFrames(0);
+            setFrameThreads(cvRound(value));
+            return true;
+        }
+
         return false;
     }
 
     void writeFrameData( const uchar* data, int step, int colorspace, int input_channels );
 
 protected:
+    // frame-level pipeline: frames are encoded by the worker threads into memory,
+    // and written into the container in the submission order by the caller thread
+    struct FrameJob
+    {
+        Mat image;
+        int colorspace;
+        double quality;
+        mjpeg_frame_stream output;
+        mjpeg_buffer_keeper buffers;
+        bool done;
+        bool failed;
+    };
+
+    size_t startFrameChunk();
+    void endFrameChunk(size_t chunkPointer);
+    void alignStream();
+
+    void setFrameThreads(int threads);
+    void stopWorkers();
+    void workerLoop();
+    void submitFrame(const Mat& img, int colorspace);
+    void writeEncodedFrames(size_t maxPending);
+
     double quality;
     bool rawstream;
     mjpeg_buffer_keeper buffers_list;
     double nstripes;
 
     AVIWriteContainer container;
+
+    int frameThreads;
+    std::vector<std::thread> workers;
+    std::mutex jobsMutex;
+    std::condition_variable jobAdded;
+    std::condition_variable jobDone;
+    std::deque<Ptr<FrameJob> > jobs;  // in the submission order
+    size_t nextJob;                    // index of the first job which is not taken by workers
+    std::vector<Ptr<FrameJob> > freeJobs;
+    bool stopping;
 };
 
 #define DCT_DESCALE(x, n) (((x) + (((int)1) << ((n) - 1))) >> (n))
@@ -1150,7 +1260,7 @@ public:
         unsigned (&_huff_dc_tab)[2][16],
         unsigned (&_huff_ac_tab)[2][256],
         short (&_fdct_qtab)[2][64],
-        uchar* _cat_table,
+        const uchar* _cat_table,
         mjpeg_buffer_keeper& _buffer_list,
         double nstripes
     ) :
@@ -1375,27 +1485,34 @@ private:
 
 const int MjpegEncoder::default_stripes_count = 4;
 
-void MotionJpegWriter::writeFrameData( const uchar* data, int step, int colorspace, int input_channels )
+struct CatTable
 {
-    //double total_cvt = 0, total_dct = 0;
-    static bool init_cat_table = false;
-    const int CAT_TAB_SIZE = 4096;
-    static uchar cat_table[CAT_TAB_SIZE*2+1];
-    if( !init_cat_table )
+    enum { CAT_TAB_SIZE = 4096 };
+    uchar data[CAT_TAB_SIZE*2+1];
+
+    CatTable()
     {
         for( int i = -CAT_TAB_SIZE; i <= CAT_TAB_SIZE; i++ )
         {
             Cv32suf a;
             a.f = (float)i;
-            cat_table[i+CAT_TAB_SIZE] = ((a.i >> 23) & 255) - (126 & (i ? -1 : 0));
+            data[i+CAT_TAB_SIZE] = (uchar)(((a.i >> 23) & 255) - (126 & (i ? -1 : 0)));
         }
-        init_cat_table = true;
     }
+};
 
-    //double total_dct = 0, total_cvt = 0;
-    int width = container.getWidth();
-    int height = container.getHeight();
-    int channels = container.getChannels();
+static const uchar* getCatTable()
+{
+    static const CatTable table;  // thread-safe initialization, frames may be encoded concurrently
+    return table.data;
+}
+
+// Encodes the frame as JPEG image into the stream (AVIWriteContainer or mjpeg_frame_stream)
+template<typename Stream> static
+void encodeFrame( Stream& container, mjpeg_buffer_keeper& buffers_list, int width, int height, int channels,
+                  double quality, double nstripes, const uchar* data, int step, int colorspace, int input_channels )
+{
+    const uchar* cat_table = getCatTable();
 
     CV_Assert( data && width > 0 && height > 0 );
 
@@ -1523,13 +1640,185 @@ void MotionJpegWriter::writeFrameData( const uchar* data, int step, int colorspa
     /*printf("total dct = %.1fms, total cvt = %.1fms\n",
      total_dct*1000./cv::getTickFrequency(),
      total_cvt*1000./cv::getTickFrequency());*/
+}
 
+void MotionJpegWriter::writeFrameData( const uchar* data, int step, int colorspace, int input_channels )
+{
+    encodeFrame(container, buffers_list, container.getWidth(), container.getHeight(), container.getChannels(),
+                quality, nstripes, data, step, colorspace, input_channels);
+    alignStream();
+}
+
+void MotionJpegWriter::alignStream()
+{
     size_t pos = container.getStreamPos();
     size_t pos1 = (pos + 3) & ~3;
     for( ; pos < pos1; pos++ )
         container.putStreamByte(0);
 }
 
+size_t MotionJpegWriter::startFrameChunk()
+{
+    size_t chunkPointer = container.getStreamPos();
+    if( !rawstream ) {
+        int avi_index = container.getAVIIndex(0, dc);
+        container.startWriteChunk(avi_index);
+    }
+    return chunkPointer;
+}
+
+void MotionJpegWriter::endFrameChunk(size_t chunkPointer)
+{
+    if( !rawstream )
+    {
+        size_t tempChunkPointer = container.getStreamPos();
+        size_t moviPointer = container.getMoviPointer();
+        container.pushFrameOffset(chunkPointer - moviPointer);
+        container.pushFrameSize(tempChunkPointer - chunkPointer - 8);       // Size excludes '00dc' and size field
+        container.endWriteChunk(); // end '00dc'
+    }
+}
+
+void MotionJpegWriter::setFrameThreads(int threads)
+{
+    if( threads < 0 )
+        threads = cv::getNumThreads();
+    if( threads == (int)workers.size() || (threads <= 1 && workers.empty()) )
+        return;
+    stopWorkers();
+    frameThreads = threads;
+    if( threads <= 1 )
+        return;
+    stopping = false;
+    for( int i = 0; i < threads; i++ )
+        workers.push_back(std::thread(&MotionJpegWriter::workerLoop, this));
+}
+
+void MotionJpegWriter::stopWorkers()
+{
+    {
+        std::lock_guard<std::mutex> lock(jobsMutex);
+        stopping = true;
+        jobAdded.notify_all();
+    }
+    for( size_t i = 0; i < workers.size(); i++ )
+        workers[i].join();
+    workers.clear();
+    frameThreads = 0;
+}
+
+void MotionJpegWriter::workerLoop()
+{
+    const int width = container.getWidth();
+    const int height = container.getHeight();
+    const int channels = container.getChannels();
+
+    std::unique_lock<std::mutex> lock(jobsMutex);
+    for(;;)
+    {
+        while( !stopping && nextJob >= jobs.size() )
+            jobAdded.wait(lock);
+        if( nextJob >= jobs.size() )
+            break;  // stopping
+        Ptr<FrameJob> job = jobs[nextJob++];
+        lock.unlock();
+
+        bool failed = false;
+        try
+        {
+            const Mat& img = job->image;
+            job->output.data.clear();
+            job->buffers.reset();
+            // frames are the units of parallelism, so each frame is encoded as a single stripe
+            encodeFrame(job->output, job->buffers, width, height, channels,
+                        job->quality, 1, img.data, (int)img.step, job->colorspace, img.channels());
+        }
+        catch (...)
+        {
+            failed = true;  // reported by writeEncodedFrames()
+        }
+
+        lock.lock();
+        job->failed = failed;
+        job->done = true;
+        jobDone.notify_all();
+    }
+}
+
+void MotionJpegWriter::submitFrame(const Mat& img, int colorspace)
+{
+    Ptr<FrameJob> job;
+    {
+        std::lock_guard<std::mutex> lock(jobsMutex);
+        if( !freeJobs.empty() )
+        {
+            job = freeJobs.back();
+            freeJobs.pop_back();
+        }
+    }
+    if( !job )
+        job = makePtr<FrameJob>();
+    img.copyTo(job->image);  // the caller may reuse the frame buffer
+    job->colorspace = colorspace;
+    job->quality = quality;
+    job->done = false;
+    job->failed = false;
+
+    std::lock_guard<std::mutex> lock(jobsMutex);
+    jobs.push_back(job);
+    jobAdded.notify_one();
+}
+
+void MotionJpegWriter::writeEncodedFrames(size_t maxPending)
+{
+    std::unique_lock<std::mutex> lock(jobsMutex);
+    while( !jobs.empty() )
+    {
+        Ptr<FrameJob> job = jobs.front();
+        if( !job->done )
+        {
+            if( jobs.size() <= maxPending )
+                break;
+            jobDone.wait(lock);
+            continue;
+        }
+        jobs.pop_front();
+        nextJob--;
+        lock.unlock();
+
+        try
+        {
+            if( job->failed )
+            {
+                // the frame is encoded again by this thread, so the error gets to the caller
+                // of write() like without the frame threads instead of dropping the frame
+                const Mat& img = job->image;
+                job->output.data.clear();
+                job->buffers.reset();
+                encodeFrame(job->output, job->buffers, container.getWidth(), container.getHeight(),
+                            container.getChannels(), job->quality, 1, img.data, (int)img.step,
+                            job->colorspace, img.channels());
+            }
+
+            const std::vector<uchar>& bytes = job->output.data;
+            size_t chunkPointer = startFrameChunk();
+            container.putStreamBytes(bytes.data(), (int)bytes.size());
+            alignStream();
+            endFrameChunk(chunkPointer);
+        }
+        catch (...)
+        {
+            lock.lock();
+            freeJobs.push_back(job);
+            throw;
+        }
+
+        lock.lock();
+        freeJobs.push_back(job);
+    }
+}
+
+
 }
 
 Ptr<IVideoWriter> createMotionJpegWriter(const std::string& filename, int fourcc,
@@ -1540,7 +1829,8 @@ Ptr<IVideoWriter> createMotionJpegWriter(const std::string& filename, int fourcc
         return Ptr<IVideoWriter>();
 
     const bool isColor = params.get(VIDEOWRITER_PROP_IS_COLOR, true);
-    Ptr<IVideoWriter> iwriter = makePtr<mjpeg::MotionJpegWriter>(filename, fps, frameSize, isColor);
+    const int frameThreads = params.get(VIDEOWRITER_PROP_FRAME_THREADS, 0);
+    Ptr<IVideoWriter> iwriter = makePtr<mjpeg::MotionJpegWriter>(filename, fps, frameSize, isColor, frameThreads);
     if( !iwriter->isOpened() )
         iwriter.release();
     return iwriter;
@@ -0,0 +1,318 @@
+// This file is part of OpenCV project.
+// It is subject to the license terms in the LICENSE file found in the top-level directory
+// of this distribution and at http://opencv.org/license.html.
+
+#include "precomp.hpp"
+
+#include <condition_variable>
+#include <deque>
+#include <mutex>
+#include <thread>
+
+namespace cv {
+
+namespace {
+
+/** Decodes frames of the wrapped capture ahead of the consumer by a background thread.
+ *
+ * Decoded frames are kept in a bounded queue. Frame buffers are recycled through a pool:
+ * the retrieved frames share the pooled buffer with the caller, and a buffer is reused only
+ * after all external references to it have been released.
+ */
+class PrefetchCapture CV_FINAL : public IVideoCapture
+{
+public:
+    PrefetchCapture(const Ptr<IVideoCapture>& source_, int frames) :
+        source(source_), capacity((size_t)std::max(frames, 1)), dropOldest(false),
+        stopping(false), eof(false), generation(0), droppedFrames(0), hasCurrent(false)
+    {
+        CV_Assert(source);
+        posFrames = source->getProperty(CAP_PROP_POS_FRAMES);
+        posMsec = source->getProperty(CAP_PROP_POS_MSEC);
+        worker = std::thread(&PrefetchCapture::run, this);
+    }
+
+    ~PrefetchCapture()
+    {
+        stop();
+    }
+
+    // stops the background thread and returns the wrapped capture. Prefetched frames are lost.
+    Ptr<IVideoCapture> detach()
+    {
+        stop();
+        Ptr<IVideoCapture> res = source;
+        source.release();
+        return res;
+    }
+
+    double getProperty(int propId) const CV_OVERRIDE
+    {
+        {
+            std::lock_guard<std::mutex> lock(queueMutex);
+            switch (propId)
+            {
+            case CAP_PROP_PREFETCH_FRAMES: return (double)capacity;
+            case CAP_PROP_PREFETCH_DROP: return dropOldest ? 1 : 0;
+            case CAP_PROP_PREFETCH_QUEUE_DEPTH: return (double)queue.size();
+            case CAP_PROP_PREFETCH_DROPPED_FRAMES: return (double)droppedFrames;
+            // the source is ahead of the consumer
+            case CAP_PROP_POS_FRAMES: return posFrames;
+            case CAP_PROP_POS_MSEC: return posMsec;
+            default: break;
+            }
+        }
+        std::lock_guard<std::mutex> lock(sourceMutex);
+        return source ? source->getProperty(propId) : 0;
+    }
+
+    bool setProperty(int propId, double value) CV_OVERRIDE
+    {
+        switch (propId)
+        {
+        case CAP_PROP_PREFETCH_FRAMES:
+        {
+            if (value < 1)
+                return false;  // see VideoCapture::set()
+            std::lock_guard<std::mutex> lock(queueMutex);
+            capacity = (size_t)cvRound(value);
+            queueNotFull.notify_all();
+            return true;
+        }
+        case CAP_PROP_PREFETCH_DROP:
+        {
+            std::lock_guard<std::mutex> lock(queueMutex);
+            dropOldest = value != 0;
+            queueNotFull.notify_all();
+            return true;
+        }
+        case CAP_PROP_PREFETCH_QUEUE_DEPTH:
+        case CAP_PROP_PREFETCH_DROPPED_FRAMES:
+            return false;  // read-only
+        default:
+            break;
+        }
+
+        // the worker doesn't decode while the source is locked
+        std::lock_guard<std::mutex> sourceLock(sourceMutex);
+        if (!source || !source->setProperty(propId, value))
+            return false;
+        // seek, format change, etc: prefetched frames are not valid anymore
+        std::lock_guard<std::mutex> lock(queueMutex);
+        generation++;
+        while (!queue.empty())
+        {
+            recycle(queue.front().image);
+            queue.pop_front();
+        }
+        eof = false;
+        posFrames = source->getProperty(CAP_PROP_POS_FRAMES);
+        posMsec = source->getProperty(CAP_PROP_POS_MSEC);
+        queueNotFull.notify_all();
+        return true;
+    }
+
+    bool grabFrame() CV_OVERRIDE
+    {
+        std::unique_lock<std::mutex> lock(queueMutex);
+        if (hasCurrent)
+        {
+            recycle(current);
+            current.release();
+            hasCurrent = false;
+        }
+        while (queue.empty() && !eof && !stopping)
+            queueNotEmpty.wait(lock);
+        if (queue.empty())
+            return false;
+        Frame& frame = queue.front();
+        current = frame.image;
+        posFrames = frame.posFrames;
+        posMsec = frame.posMsec;
+        hasCurrent = true;
+        queue.pop_front();
+        queueNotFull.notify_one();
+        return true;
+    }
+
+    bool retrieveFrame(int channel, OutputArray image) CV_OVERRIDE
+    {
+        if (!hasCurrent || channel != 0)
+            return false;
+        if (image.kind() == _InputArray::MAT && !image.fixedSize() && !image.fixedType())
+            image.getMatRef() = current;  // shared with the pool until the caller releases it
+        else
+            current.copyTo(image);
+        return true;
+    }
+
+    bool isOpened() const CV_OVERRIDE
+    {
+        std::lock_guard<std::mutex> lock(sourceMutex);
+        return source && source->isOpened();
+    }
+
+    int getCaptureDomain() CV_OVERRIDE
+    {
+        std::lock_guard<std::mutex> lock(sourceMutex);
+        return source ? source->getCaptureDomain() : CAP_ANY;
+    }
+
+private:
+    struct Frame
+    {
+        Mat image;
+        double posFrames;
+        double posMsec;
+    };
+
+    void stop()
+    {
+        {
+            std::lock_guard<std::mutex> lock(queueMutex);
+            stopping = true;
+            queueNotFull.notify_all();
+            queueNotEmpty.notify_all();
+        }
+        if (worker.joinable())
+            worker.join();
+    }
+
+    // queueMutex must be held
+    void recycle(const Mat& m)
+    {
+        if (m.empty())
+            return;
+        if (pool.size() >= capacity + 2)
+            pool.erase(pool.begin());  // still referenced by the caller for too long
+        pool.push_back(m);
+    }
+
+    // queueMutex must be held
+    Mat takeBuffer()
+    {
+        for (size_t i = 0; i < pool.size(); i++)
+        {
+            // the references are released by other threads, so the counter is read atomically
+            if (pool[i].u && CV_XADD(&pool[i].u->refcount, 0) == 1)  // no external references
+            {
+                Mat m = pool[i];
+                pool.erase(pool.begin() + i);
+                return m;
+            }
+        }
+        return Mat();
+    }
+
+    void run()
+    {
+        for (;;)
+        {
+            Frame frame;
+            {
+                std::unique_lock<std::mutex> lock(queueMutex);
+                while (!stopping && !dropOldest && queue.size() >= capacity)
+                    queueNotFull.wait(lock);
+                if (stopping)
+                    break;
+                frame.image = takeBuffer();
+            }
+
+            bool ok = false;
+            int frameGeneration = 0;
+            {
+                std::lock_guard<std::mutex> sourceLock(sourceMutex);
+                {
+                    std::lock_guard<std::mutex> lock(queueMutex);
+                    frameGeneration = generation;
+                }
+                try
+                {
+                    ok = source->grabFrame() && source->retrieveFrame(0, frame.image) && !frame.image.empty();
+                    if (ok)
+                    {
+                        frame.posFrames = source->getProperty(CAP_PROP_POS_FRAMES);
+                        frame.posMsec = source->getProperty(CAP_PROP_POS_MSEC);
+                    }
+                }
+                catch (const std::exception& e)
+                {
+                    CV_LOG_WARNING(NULL, "VIDEOIO: exception in frame prefetching thread: " << e.what());
+                    ok = false;
+                }
+                catch (...)
+                {
+                    CV_LOG_WARNING(NULL, "VIDEOIO: unknown exception in frame prefetching thread");
+                    ok = false;
+                }
+            }
+
+            std::unique_lock<std::mutex> lock(queueMutex);
+            if (frameGeneration != generation)
+            {
+                recycle(frame.image);  // the stream has been changed by setProperty()
+                continue;
+            }
+            if (!ok)
+            {
+                eof = true;
+                queueNotEmpty.notify_all();
+                // wait for seek
+                while (!stopping && frameGeneration == generation)
+                    queueNotFull.wait(lock);
+                continue;
+            }
+            if (queue.size() >= capacity)
+            {
+                // dropOldest mode: keep the latest frames for the live sources
+                recycle(queue.front().image);
+                queue.pop_front();
+                droppedFrames++;
+            }
+            queue.push_back(frame);
+            queueNotEmpty.notify_one();
+        }
+    }
+
+    Ptr<IVideoCapture> source;
+    mutable std::mutex sourceMutex;  // held by the worker while a frame is decoded
+    mutable std::mutex queueMutex;   // guards the fields below
+    std::condition_variable queueNotEmpty;
+    std::condition_variable queueNotFull;
+    std::deque<Frame> queue;
+    std::vector<Mat> pool;
+    size_t capacity;
+    bool dropOldest;
+    bool stopping;
+    bool eof;
+    int generation;
+    int64 droppedFrames;
+    double posFrames;  // position of the current (last grabbed) frame
+    double posMsec;
+
+    // used by the consumer thread only
+    Mat current;
+    bool hasCurrent;
+
+    std::thread worker;
+};
+
+} // namespace
+
+bool setupPrefetchCapture(Ptr<IVideoCapture>& capture, int frames)
+{
+    CV_Assert(capture);
+    PrefetchCapture* prefetch = dynamic_cast<PrefetchCapture*>(capture.get());
+    if (prefetch)
+    {
+        if (frames > 0)
+            return prefetch->setProperty(CAP_PROP_PREFETCH_FRAMES, frames);
+        capture = prefetch->detach();
+        return true;
+    }
+    if (frames > 0)
+        capture = makePtr<PrefetchCapture>(capture, frames);
+    return true;
+}
+
+} // cv::
@@ -557,6 +557,119 @@ TEST(Videoio, exceptions)
     EXPECT_THROW(cap.open("this_does_not_exist.avi", CAP_OPENCV_MJPEG), Exception);
 }
 
+TEST(Videoio, prefetch_frames)
+{
+    const string video_file = cv::tempfile("prefetch.avi");
+    const int frame_count = 30;
+    {
+        VideoWriter writer(video_file, CAP_OPENCV_MJPEG, VideoWriter::fourcc('M', 'J', 'P', 'G'), 25., Size(64, 48), true);
+        ASSERT_TRUE(writer.isOpened());
+        Mat img(48, 64, CV_8UC3);
+        for (int i = 0; i < frame_count; i++)
+        {
+            img.setTo(Scalar::all(i * 8));
+            putText(img, cv::format("%d", i), Point(4, 40), FONT_HERSHEY_SIMPLEX, 1, Scalar(0, 0, 255), 2);
+            writer << img;
+        }
+    }
+
+    std::vector<Mat> ref;
+    {
+        VideoCapture cap(video_file, CAP_OPENCV_MJPEG);
+        ASSERT_TRUE(cap.isOpened());
+        Mat frame;
+        while (cap.read(frame))
+            ref.push_back(frame.clone());
+    }
+    ASSERT_EQ((size_t)frame_count, ref.size());
+
+    VideoCapture cap(video_file, CAP_OPENCV_MJPEG);
+    ASSERT_TRUE(cap.isOpened());
+    ASSERT_TRUE(cap.set(CAP_PROP_PREFETCH_FRAMES, 4));
+    EXPECT_EQ(4, cap.get(CAP_PROP_PREFETCH_FRAMES));
+    EXPECT_EQ(CAP_OPENCV_MJPEG, cap.get(CAP_PROP_BACKEND));
+
+    Mat frame;
+    for (int i = 0; i < frame_count / 2; i++)
+    {
+        ASSERT_TRUE(cap.read(frame)) << i;
+        EXPECT_EQ(0, cvtest::norm(ref[i], frame, NORM_INF)) << i;
+        EXPECT_LE(cap.get(CAP_PROP_PREFETCH_QUEUE_DEPTH), 4);
+    }
+
+    // seek flushes the prefetched frames
+    ASSERT_TRUE(cap.set(CAP_PROP_POS_FRAMES, 5));
+    ASSERT_TRUE(cap.read(frame));
+    EXPECT_EQ(0, cvtest::norm(ref[5], frame, NORM_INF));
+
+    // disable prefetching: the frames from the queue are skipped
+    ASSERT_TRUE(cap.set(CAP_PROP_PREFETCH_FRAMES, 0));
+    EXPECT_EQ(0, cap.get(CAP_PROP_PREFETCH_QUEUE_DEPTH));
+    ASSERT_TRUE(cap.set(CAP_PROP_PREFETCH_FRAMES, 2));
+    ASSERT_TRUE(cap.set(CAP_PROP_POS_FRAMES, 20));
+    int count = 0;
+    while (cap.read(frame))
+    {
+        EXPECT_EQ(0, cvtest::norm(ref[20 + count], frame, NORM_INF)) << count;
+        count++;
+    }
+    EXPECT_EQ(frame_count - 20, count);
+    EXPECT_EQ(0, cap.get(CAP_PROP_PREFETCH_DROPPED_FRAMES));
+
+    cap.release();
+    remove(video_file.c_str());
+}
+
+TEST(Videoio, mjpeg_writer_frame_threads)
+{
+    const Size size(64, 48);
+    const int frame_count = 20;
+    std::vector<Mat> frames;
+    for (int i = 0; i < frame_count; i++)
+    {
+        Mat img(size, CV_8UC3, Scalar::all(i * 10));
+        putText(img, cv::format("%d", i), Point(4, 40), FONT_HERSHEY_SIMPLEX, 1, Scalar(0, 0, 255), 2);
+        frames.push_back(img);
+    }
+
+    std::vector<std::vector<Mat> > results(2);
+    for (int k = 0; k < 2; k++)
+    {
+        const string video_file = cv::tempfile(".avi");
+        {
+            std::vector<int> params;
+            if (k == 1)
+            {
+                params.push_back(VIDEOWRITER_PROP_FRAME_THREADS);
+                params.push_back(4);
+            }
+            VideoWriter writer(video_file, CAP_OPENCV_MJPEG, VideoWriter::fourcc('M', 'J', 'P', 'G'), 25., size, params);
+            ASSERT_TRUE(writer.isOpened());
+            EXPECT_EQ(k == 1 ? 4 : 0, writer.get(VIDEOWRITER_PROP_FRAME_THREADS));
+            Mat img;
+            for (int i = 0; i < frame_count; i++)
+            {
+                frames[i].copyTo(img);  // the buffer is reused by the caller
+                writer << img;
+            }
+        }
+        VideoCapture cap(video_file, CAP_OPENCV_MJPEG);
+        ASSERT_TRUE(cap.isOpened());
+        EXPECT_EQ(frame_count, cap.get(CAP_PROP_FRAME_COUNT));
+        Mat frame;
+        while (cap.read(frame))
+            results[k].push_back(frame.clone());
+        cap.release();
+        remove(video_file.c_str());
+    }
+
+    // the frames are written in the submission order, and the encoded data doesn't depend on the threads number
+    ASSERT_EQ((size_t)frame_count, results[0].size());
+    ASSERT_EQ(results[0].size(), results[1].size());
+    for (int i = 0; i < frame_count; i++)
+        EXPECT_EQ(0, cvtest::norm(results[0][i], results[1][i], NORM_INF)) << i;
+}
+
 
 typedef Videoio_Writer Videoio_Writer_bad_fourcc;
 